@@ -85,6 +85,16 @@ public:
 	FORCEINLINE bool IsADefaultListener() const { return IsDefaultListener; }
 	FORCEINLINE void SetIsDefaultListener(bool bIsDefaultListener) { IsDefaultListener = bIsDefaultListener; }
 	FORCEINLINE void SetUseDefaultListeners(bool UseDefaultListeners) { bUseDefaultListeners = UseDefaultListeners; }
+
+	// position is uploaded by WwiserR's position manager once per frame, instead of on every transform update
+	FORCEINLINE void SetDeferPositionUpdates(bool bDefer) { bDeferPositionUpdates = bDefer; }
+	FORCEINLINE bool IsDeferringPositionUpdates() const { return bDeferPositionUpdates; }
+
+	// re-applies the room, reverb sends and game object settings after WwiserR's AkComponent pool re-registered the game object
+	void OnReregisteredWithWwise();
+
+private:
+	bool bDeferPositionUpdates = false;
 	// WWISERR END
 
 public:
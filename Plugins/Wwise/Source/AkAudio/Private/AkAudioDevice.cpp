@@ -1864,6 +1864,9 @@ void FAkAudioDevice::IndexRoom(class UAkRoomComponent* ComponentToAdd)
 {
 	RoomIndex.Update(ComponentToAdd);
 	SAComponentAddedRemoved(ComponentToAdd->GetWorld());
+	// WWISERR BEGIN
+	OnRoomIndexChanged.Broadcast(ComponentToAdd);
+	// WWISERR END
 }
 
 /** Remove a UAkRoomComponent from the linked list. */
@@ -1872,6 +1875,9 @@ void FAkAudioDevice::UnindexRoom(class UAkRoomComponent* ComponentToRemove)
 	if (RoomIndex.Remove(ComponentToRemove))
 	{
 		SAComponentAddedRemoved(ComponentToRemove->GetWorld());
+		// WWISERR BEGIN
+		OnRoomIndexChanged.Broadcast(ComponentToRemove);
+		// WWISERR END
 	}
 }
 
@@ -1879,6 +1885,9 @@ void FAkAudioDevice::ReindexRoom(class UAkRoomComponent* ComponentToAdd)
 {
 	RoomIndex.Update(ComponentToAdd);
 	SAComponentAddedRemoved(ComponentToAdd->GetWorld());
+	// WWISERR BEGIN
+	OnRoomIndexChanged.Broadcast(ComponentToAdd);
+	// WWISERR END
 }
 
 /** Return true if any UAkRoomComponents have been added to the prioritized list of rooms **/
@@ -645,6 +645,30 @@ void UAkComponent::BeginPlay()
 		AAkSpotReflector::UpdateSpotReflectors(this);
 }
 
+// WWISERR BEGIN
+void UAkComponent::OnReregisteredWithWwise()
+{
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	if (!AkAudioDevice) return;
+
+	// the sound engine forgot the room and aux sends of the previous registration, drop the cached state so it is sent again
+	CurrentRoom.Reset();
+	ReverbFadeControls.Empty();
+	CurrentAuxSendValues.Empty();
+
+	AkAudioDevice->SetGameObjectRadius(this, outerRadius, innerRadius);
+	SetAttenuationScalingFactor(AttenuationScalingFactor);
+	UpdateSpatialAudioRoom(GetComponentLocation());
+
+	if (bUseReverbVolumes && AkAudioDevice->GetMaxAuxBus() > 0)
+	{
+		UpdateAkLateReverbComponentList(GetComponentLocation());
+		for (auto& ReverbFadeControl : ReverbFadeControls)
+			ReverbFadeControl.ForceCurrentToTargetValue();
+	}
+}
+// WWISERR END
+
 void UAkComponent::SetAttenuationScalingFactor(float Value)
 {
 	AttenuationScalingFactor = Value;
@@ -661,7 +685,9 @@ void UAkComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags,
 
 	// If we're a listener, our position will be updated from Tick instead of here.
 	// This is because PlayerController->GetAudioListenerPosition caches its value, and it can be out of sync
-	if(!IsDefaultListener)
+	// WWISERR BEGIN
+	if(!IsDefaultListener && !bDeferPositionUpdates)
+	// WWISERR END
 		UpdateGameObjectPosition();
 }
 
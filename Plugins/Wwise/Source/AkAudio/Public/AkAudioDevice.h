@@ -96,6 +96,10 @@ public:
 	FORCEINLINE TArray<TWeakObjectPtr<UAkPortalComponent>>* GetPortals(UWorld* World) { return WorldPortalsMap.Find(World); }
 	AKRESULT SetSwitch(AkSwitchGroupID in_SwitchGroup, AkSwitchStateID in_SwitchState, UAkComponent* in_pComponent);
 	void AddDefaultListener(UAkComponent* in_pListener, UWorld* world, bool bSilent);
+
+	/** broadcast when a room is (re/un)indexed, so cached room queries can be invalidated */
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnRoomIndexChanged, class UAkRoomComponent*);
+	FOnRoomIndexChanged OnRoomIndexChanged;
 // WWISERR END
 
 	UE_NONCOPYABLE(FAkAudioDevice);
@@ -11,6 +11,12 @@
 #include "Config/DebugTheme.h"
 #include "AudioConfig.generated.h"
 
+UENUM()
+enum class EStaticSoundEmitterSpatialIndex : uint8
+{
+	OctreePerLoop	UMETA(ToolTip = "one octree per static sound loop, traversed once per loop"),
+	SharedGrid		UMETA(ToolTip = "one hashed grid holding the emitters of all static sound loops, traversed once per tick")
+};
 
 /**
  * Game Configuration
@@ -40,15 +46,143 @@ public:
 	UPROPERTY(Config, BlueprintReadOnly, EditDefaultsOnly, Category = "Audio Globals", meta = (AllowedClasses = "/Script/AkAudio.AkAudioEvent"))
 	FSoftObjectPath UnmuteAllEvent;
 
+	/** maximum amount of sound emitters that are distance culled per frame and per world. Remaining due emitters are deferred to the next
+	frame. (0 = unlimited) */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Distance Culling", meta = (ClampMin = 0))
+	int32 MaxDistanceCullsPerFrame = 256;
+
+	/** time budget (in milliseconds) per frame to recull all loops of sound emitters after the listener teleported or the listeners changed.
+	Emitters are reculled nearest first, the remaining emitters are deferred to the next frame. (0 = unlimited) */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Distance Culling", meta = (ClampMin = 0.f))
+	float RecullBudgetMs = 0.5f;
+
+	/** sound emitters take AkComponents from a per world pool instead of creating and destroying them (opt-in, reused AkComponents are
+	re-registered with Wwise) */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "AkComponent Pool")
+	bool bUseAkComponentPool = false;
+
+	/** amount of AkComponents created up front when a level's actors are initialized */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "AkComponent Pool", meta = (ClampMin = 0, EditCondition = "bUseAkComponentPool"))
+	int32 AkComponentPoolPrewarmSize = 32;
+
+	/** maximum amount of idle AkComponents kept per world, released AkComponents exceeding this amount are destroyed */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "AkComponent Pool", meta = (ClampMin = 0, EditCondition = "bUseAkComponentPool"))
+	int32 AkComponentPoolMaxSize = 256;
+
+	/** positions of sound emitters and world listeners are uploaded to Wwise in one pass per frame, instead of on every transform update */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Position Upload")
+	bool bBatchPositionUploads = true;
+
+	/** minimum distance (cm) a game object has to move since its last upload before its position is uploaded again */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Position Upload", meta = (ClampMin = 0.f, EditCondition = "bBatchPositionUploads"))
+	float PositionUploadLocationEpsilon = 1.f;
+
+	/** minimum angle (degrees) a game object has to rotate since its last upload before its position is uploaded again */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Position Upload", meta = (ClampMin = 0.f, EditCondition = "bBatchPositionUploads"))
+	float PositionUploadRotationEpsilon = 1.f;
+
+	/** sound emitters with bQueueOneShots post their one shots in one flush at the end of the frame, after deduplication and instance caps */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "OneShot Queue")
+	bool bUseOneShotQueue = true;
+
+	/** queued one shots within this radius (cm) of another post of the same event are dropped */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "OneShot Queue", meta = (ClampMin = 0.f, EditCondition = "bUseOneShotQueue"))
+	float OneShotDedupeRadius = 100.f;
+
+	/** time window (in seconds) in which earlier posts of the same event are still considered for deduplication. (0 = current frame only) */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "OneShot Queue", meta = (ClampMin = 0.f, EditCondition = "bUseOneShotQueue", Units = "Seconds"))
+	float OneShotDedupeWindow = .05f;
+
+	/** maximum amount of instances of the same event posted per frame, nearest to a listener first. (0 = unlimited) */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "OneShot Queue", meta = (ClampMin = 0, EditCondition = "bUseOneShotQueue"))
+	int32 OneShotMaxInstancesPerEvent = 4;
+
+	/** per event overrides of OneShotMaxInstancesPerEvent. (0 = unlimited) */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "OneShot Queue", meta = (EditCondition = "bUseOneShotQueue"))
+	TMap<TSoftObjectPtr<class UAkAudioEvent>, int32> OneShotMaxInstancesOverrides{};
+
+	/** Rtpcs set on sound emitters are sent to Wwise in one flush per frame, the last value written in a frame is sent */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Rtpcs")
+	bool bBatchRtpcUpdates = true;
+
 	UPROPERTY(Config, EditDefaultsOnly, Category = "Static Sound Manager")
 	bool bSpreadOverMultipleFrames = true;
 
 	UPROPERTY(Config, EditDefaultsOnly, Category = "Static Sound Manager", meta = (EditCondition = "bSpreadOverMultipleFrames"))
 	TArray<float> DistanceTresholds{5000.f, 10000.f};
 
+	/** instead of updating one distance range per frame, give each static sound loop an update period derived from its
+	activation range and the listener speed, and update the loops that are due within a per frame time budget */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Static Sound Manager")
+	bool bAdaptiveScheduling = false;
+
+	/** time budget (ms) per frame for updating static sound loops. At least one due loop is updated every frame */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Static Sound Manager", meta = (ClampMin = 0.f, EditCondition = "bAdaptiveScheduling"))
+	float AdaptiveSchedulingBudgetMs = 0.5f;
+
+	/** shortest and longest update period (seconds) of a static sound loop */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Static Sound Manager", meta = (ClampMin = 0.f, EditCondition = "bAdaptiveScheduling"))
+	float AdaptiveSchedulingMinUpdatePeriod = 0.f;
+
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Static Sound Manager", meta = (ClampMin = 0.f, EditCondition = "bAdaptiveScheduling"))
+	float AdaptiveSchedulingMaxUpdatePeriod = 1.f;
+
+	/** spatial index used to find the static sound emitters in range, per distance range */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Static Sound Manager")
+	EStaticSoundEmitterSpatialIndex StaticSoundEmitterSpatialIndex = EStaticSoundEmitterSpatialIndex::OctreePerLoop;
+
+	/** per map overrides of StaticSoundEmitterSpatialIndex, e.g. to compare both layouts on the same map */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Static Sound Manager", meta = (AllowedClasses = "/Script/Engine.World"))
+	TMap<FSoftObjectPath, EStaticSoundEmitterSpatialIndex> StaticSoundEmitterSpatialIndexOverrides{};
+
+	/** cell size (cm) of the shared grid */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Static Sound Manager", meta = (ClampMin = 100.f))
+	float StaticSoundEmitterGridCellSize = 2500.f;
+
+	/** bake the static sound emitters of a level when it's saved or cooked, and bulk build the index from them at runtime instead of
+	 *  inserting each component on BeginPlay. Only emitters listing their loops in StaticSoundLoops are baked */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Static Sound Manager")
+	bool bUseBakedStaticSoundEmitters = true;
+
+	/** queue the registration of static sound emitters and ambient bed weights, e.g. when a World Partition cell streams in, and
+	 *  apply it in batches before the managers tick. Queued removals are also applied before garbage collection */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Emitter Registration")
+	bool bBatchEmitterRegistration = true;
+
+	/** time budget (ms) per frame for applying queued registrations, larger batches are spread over multiple frames */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Emitter Registration", meta = (ClampMin = 0.f, EditCondition = "bBatchEmitterRegistration"))
+	float EmitterRegistrationBudgetMs = 1.f;
+
 	/** aux bus without listener relative routing to allow crossfading when passing through portals **/
 	UPROPERTY(Config, BlueprintReadOnly, EditDefaultsOnly, Category = "Ambient Bed Manager", meta = (AllowedClasses = "/Script/AkAudio.AkAuxBus"))
 	FSoftObjectPath DefaultAmbientBedPassthroughBuss;
+
+	/** bake ambient bed weights marked bBakeIntoWeightField into a sparse weight field of their level when it's saved or cooked,
+	 *  sampled at runtime instead of registering each component */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Ambient Bed Manager")
+	bool bUseBakedAmbientWeightFields = true;
+
+	/** horizontal size of the weight field cells (in Centimeters), weights within a cell are merged at their weighted centroid */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Ambient Bed Manager", meta = (ClampMin = "100.0", EditCondition = "bUseBakedAmbientWeightFields"))
+	float AmbientWeightFieldCellSize = 1000.f;
+
+	/** update ambient bed groups playing in the listener's room every frame, groups playing in adjacent rooms (connected by a portal)
+	 *  at AdjacentRoomAmbientBedUpdateRate, and all other groups only when their reference position or the listener moved more than
+	 *  DistantAmbientBedMovementThreshold */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Ambient Bed Manager")
+	bool bUseAmbientBedLOD = true;
+
+	/** updates per second of ambient bed groups playing in a room adjacent to the listener's room */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Ambient Bed Manager", meta = (ClampMin = "1.0", EditCondition = "bUseAmbientBedLOD"))
+	float AdjacentRoomAmbientBedUpdateRate = 10.f;
+
+	/** other ambient bed groups are updated when their reference position or the listener moved more than this distance (in Centimeters) */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Ambient Bed Manager", meta = (ClampMin = "0.0", EditCondition = "bUseAmbientBedLOD"))
+	float DistantAmbientBedMovementThreshold = 200.f;
+
+	/** the ambient bed room listeners are only rotated when the spatial audio listener rotated more than this angle (in Degrees) */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Ambient Bed Manager", meta = (ClampMin = "0.0"))
+	float AmbientRoomListenerRotationEpsilon = 1.f;
 };
 
 /**
@@ -0,0 +1,68 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#include "Core/AllocationCounter.h"
+
+#if !UE_BUILD_SHIPPING
+#include "HAL/MemoryBase.h"
+
+bool FAllocationCounter::s_isEnabled = false;
+std::atomic<uint64> FAllocationCounter::s_numAllocations{ 0 };
+thread_local int32 FAllocationCounter::s_scopeDepth = 0;
+
+// forwards everything to the allocator it replaced, counts the allocations of threads inside a FAllocationCounter::FScope
+class FCountingMallocProxy final : public FMalloc
+{
+	FMalloc* m_innerMalloc;
+
+	FORCEINLINE static void Count()
+	{
+		if (FAllocationCounter::s_scopeDepth > 0)
+		{
+			FAllocationCounter::s_numAllocations.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+public:
+	explicit FCountingMallocProxy(FMalloc* InnerMalloc) : m_innerMalloc(InnerMalloc) {}
+
+	void* Malloc(SIZE_T Size, uint32 Alignment) override { Count(); return m_innerMalloc->Malloc(Size, Alignment); }
+	void* TryMalloc(SIZE_T Size, uint32 Alignment) override { Count(); return m_innerMalloc->TryMalloc(Size, Alignment); }
+	void* Realloc(void* Original, SIZE_T Size, uint32 Alignment) override
+	{
+		if (Size > 0) { Count(); }
+		return m_innerMalloc->Realloc(Original, Size, Alignment);
+	}
+	void* TryRealloc(void* Original, SIZE_T Size, uint32 Alignment) override
+	{
+		if (Size > 0) { Count(); }
+		return m_innerMalloc->TryRealloc(Original, Size, Alignment);
+	}
+	void Free(void* Original) override { m_innerMalloc->Free(Original); }
+
+	SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return m_innerMalloc->QuantizeSize(Count, Alignment); }
+	bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return m_innerMalloc->GetAllocationSize(Original, SizeOut); }
+	void Trim(bool bTrimThreadCaches) override { m_innerMalloc->Trim(bTrimThreadCaches); }
+	void SetupTLSCachesOnCurrentThread() override { m_innerMalloc->SetupTLSCachesOnCurrentThread(); }
+	void ClearAndDisableTLSCachesOnCurrentThread() override { m_innerMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+	void InitializeStatsMetadata() override { m_innerMalloc->InitializeStatsMetadata(); }
+	void UpdateStats() override { m_innerMalloc->UpdateStats(); }
+	void GetAllocatorStats(FGenericMemoryStats& OutStats) override { m_innerMalloc->GetAllocatorStats(OutStats); }
+	void DumpAllocatorStats(FOutputDevice& Ar) override { m_innerMalloc->DumpAllocatorStats(Ar); }
+	bool IsInternallyThreadSafe() const override { return m_innerMalloc->IsInternallyThreadSafe(); }
+	bool ValidateHeap() override { return m_innerMalloc->ValidateHeap(); }
+	const TCHAR* GetDescriptiveName() override { return m_innerMalloc->GetDescriptiveName(); }
+	void OnMallocInitialized() override { m_innerMalloc->OnMallocInitialized(); }
+	void OnPreFork() override { m_innerMalloc->OnPreFork(); }
+	void OnPostFork() override { m_innerMalloc->OnPostFork(); }
+};
+
+void FAllocationCounter::Enable()
+{
+	if (s_isEnabled || GMalloc == nullptr) { return; }
+
+	// never deleted, allocations made through it can be freed at any later time
+	static FCountingMallocProxy* countingMalloc = new FCountingMallocProxy(GMalloc);
+	GMalloc = countingMalloc;
+	s_isEnabled = true;
+}
+#endif
@@ -0,0 +1,48 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * AllocationCounter
+ * -----------------
+ *
+ * - counts the heap allocations (mallocs and reallocs) made inside FAllocationCounter::FScope, on any thread
+ * - allocations are seen through a forwarding FMalloc, installed over GMalloc when counting is first enabled and kept for the rest
+ *   of the session. Nothing is counted before that
+ * - scopes are per thread, tasks started inside a scope (ParallelFor,...) need their own scope
+ * - not available in shipping builds, WR_COUNT_ALLOCATIONS_SCOPE() compiles out
+ */
+
+#if !UE_BUILD_SHIPPING
+class WWISERR_API FAllocationCounter
+{
+public:
+	// counts the allocations of this thread while in scope
+	struct FScope
+	{
+		FScope() { s_scopeDepth++; }
+		~FScope() { s_scopeDepth--; }
+	};
+
+	/** installs the counting FMalloc, call on the game thread */
+	static void Enable();
+	FORCEINLINE static bool IsEnabled() { return s_isEnabled; }
+
+	/** allocations counted since the counter was enabled */
+	FORCEINLINE static uint64 GetNumAllocations() { return s_numAllocations.load(std::memory_order_relaxed); }
+
+protected:
+	friend class FCountingMallocProxy;
+
+	static bool s_isEnabled;
+	static std::atomic<uint64> s_numAllocations;
+	static thread_local int32 s_scopeDepth;
+};
+
+#define WR_COUNT_ALLOCATIONS_SCOPE() FAllocationCounter::FScope PREPROCESSOR_JOIN(allocationCounterScope, __LINE__)
+#else
+#define WR_COUNT_ALLOCATIONS_SCOPE()
+#endif
@@ -5,6 +5,12 @@
 #include "Managers/GlobalSoundEmitterManager.h"
 #include "Managers/StaticSoundEmitterManager.h"
 #include "Managers/AmbientBedManager.h"
+#include "Managers/DistanceCullingManager.h"
+#include "Managers/AkComponentPoolManager.h"
+#include "Managers/GameObjectPositionManager.h"
+#include "Managers/OneShotQueueManager.h"
+#include "Managers/RepeatingOneShotManager.h"
+#include "Managers/RtpcFlushManager.h"
 #include "Managers/MusicManager.h"
 //#include "SoundEmitters/PooledSoundEmitterComponent.h"
 #include "Core/AudioUtils.h"
@@ -109,8 +115,14 @@ void UAudioSubsystem::InitializeOnClient()
 	ClientBindDelegates();
 
 	InitializeGlobalEmitterManager();
+	InitializeAkComponentPoolManager(audioConfig);
+	InitializeGameObjectPositionManager(audioConfig);
+	InitializeRtpcFlushManager(audioConfig);
 	//InitializePooledEmitterManager();
 	InitializeListenerManager(audioConfig);
+	InitializeDistanceCullingManager();
+	InitializeOneShotQueueManager(audioConfig);
+	InitializeRepeatingOneShotManager();
 	InitializeMusicManager(audioConfig);
 	InitializeStaticSoundEmitterManager();
 	InitializeAmbientBedManager();
@@ -170,8 +182,14 @@ void UAudioSubsystem::DeinitializeOnClient()
 	DeinitializeAmbientBedManager();
 	DeinitializeStaticSoundEmitterManager();
 	DeinitializeMusicManager();
+	DeinitializeRepeatingOneShotManager();
+	DeinitializeOneShotQueueManager();
+	DeinitializeDistanceCullingManager();
 	DeinitializeListenerManager();
 	//DeinitializePooledEmitterManager();
+	DeinitializeRtpcFlushManager();
+	DeinitializeGameObjectPositionManager();
+	DeinitializeAkComponentPoolManager();
 	DeinitializeGlobalEmitterManager();
 	WR_DBG_INST_NET(Log, "deinitialized (client)");
 }
@@ -291,6 +309,110 @@ void UAudioSubsystem::DeinitializeAmbientBedManager()
 	}
 }
 
+void UAudioSubsystem::InitializeDistanceCullingManager()
+{
+	static const FName distanceCullingManagerName{ TEXT("DistanceCullingManager") };
+	m_distanceCullingManager = NewObject<UDistanceCullingManager>(this, distanceCullingManagerName);
+	m_distanceCullingManager->Initialize(ListenerManager);
+}
+
+void UAudioSubsystem::InitializeAkComponentPoolManager(const UWwiserRGameSettings* AudioConfig)
+{
+	if (!AudioConfig->bUseAkComponentPool) { return; }
+
+	static const FName akComponentPoolManagerName{ TEXT("AkComponentPoolManager") };
+	m_akComponentPoolManager = NewObject<UAkComponentPoolManager>(this, akComponentPoolManagerName);
+	m_akComponentPoolManager->Initialize();
+}
+
+void UAudioSubsystem::DeinitializeAkComponentPoolManager()
+{
+	if (IsValid(m_akComponentPoolManager))
+	{
+		m_akComponentPoolManager->Deinitialize();
+		m_akComponentPoolManager = nullptr;
+	}
+}
+
+void UAudioSubsystem::InitializeGameObjectPositionManager(const UWwiserRGameSettings* AudioConfig)
+{
+	if (!AudioConfig->bBatchPositionUploads) { return; }
+
+	static const FName gameObjectPositionManagerName{ TEXT("GameObjectPositionManager") };
+	m_gameObjectPositionManager = NewObject<UGameObjectPositionManager>(this, gameObjectPositionManagerName);
+	m_gameObjectPositionManager->Initialize();
+}
+
+void UAudioSubsystem::DeinitializeGameObjectPositionManager()
+{
+	if (IsValid(m_gameObjectPositionManager))
+	{
+		m_gameObjectPositionManager->Deinitialize();
+		m_gameObjectPositionManager = nullptr;
+	}
+}
+
+void UAudioSubsystem::InitializeOneShotQueueManager(const UWwiserRGameSettings* AudioConfig)
+{
+	if (!AudioConfig->bUseOneShotQueue) { return; }
+
+	static const FName oneShotQueueManagerName{ TEXT("OneShotQueueManager") };
+	m_oneShotQueueManager = NewObject<UOneShotQueueManager>(this, oneShotQueueManagerName);
+	m_oneShotQueueManager->Initialize(ListenerManager);
+}
+
+void UAudioSubsystem::DeinitializeOneShotQueueManager()
+{
+	if (IsValid(m_oneShotQueueManager))
+	{
+		m_oneShotQueueManager->Deinitialize();
+		m_oneShotQueueManager = nullptr;
+	}
+}
+
+void UAudioSubsystem::InitializeRtpcFlushManager(const UWwiserRGameSettings* AudioConfig)
+{
+	if (!AudioConfig->bBatchRtpcUpdates) { return; }
+
+	static const FName rtpcFlushManagerName{ TEXT("RtpcFlushManager") };
+	m_rtpcFlushManager = NewObject<URtpcFlushManager>(this, rtpcFlushManagerName);
+	m_rtpcFlushManager->Initialize();
+}
+
+void UAudioSubsystem::DeinitializeRtpcFlushManager()
+{
+	if (IsValid(m_rtpcFlushManager))
+	{
+		m_rtpcFlushManager->Deinitialize();
+		m_rtpcFlushManager = nullptr;
+	}
+}
+
+void UAudioSubsystem::InitializeRepeatingOneShotManager()
+{
+	static const FName repeatingOneShotManagerName{ TEXT("RepeatingOneShotManager") };
+	m_repeatingOneShotManager = NewObject<URepeatingOneShotManager>(this, repeatingOneShotManagerName);
+	m_repeatingOneShotManager->Initialize();
+}
+
+void UAudioSubsystem::DeinitializeRepeatingOneShotManager()
+{
+	if (IsValid(m_repeatingOneShotManager))
+	{
+		m_repeatingOneShotManager->Deinitialize();
+		m_repeatingOneShotManager = nullptr;
+	}
+}
+
+void UAudioSubsystem::DeinitializeDistanceCullingManager()
+{
+	if (IsValid(m_distanceCullingManager))
+	{
+		m_distanceCullingManager->Deinitialize();
+		m_distanceCullingManager = nullptr;
+	}
+}
+
 void UAudioSubsystem::ClientBindDelegates()
 {
 	//static const FName funcBeginPlay{ "ClientBeginPlay" };
@@ -58,6 +58,12 @@ protected:
 	UPROPERTY(Transient) class UGlobalSoundEmitterManager* m_globalSoundEmitterManager = nullptr;
 	UPROPERTY(Transient) class UStaticSoundEmitterManager* m_staticSoundEmitterManager = nullptr;
 	UPROPERTY(Transient) class UAmbientBedManager* m_ambientBedManager = nullptr;
+	UPROPERTY(Transient) class UDistanceCullingManager* m_distanceCullingManager = nullptr;
+	UPROPERTY(Transient) class UAkComponentPoolManager* m_akComponentPoolManager = nullptr;
+	UPROPERTY(Transient) class UGameObjectPositionManager* m_gameObjectPositionManager = nullptr;
+	UPROPERTY(Transient) class UOneShotQueueManager* m_oneShotQueueManager = nullptr;
+	UPROPERTY(Transient) class URepeatingOneShotManager* m_repeatingOneShotManager = nullptr;
+	UPROPERTY(Transient) class URtpcFlushManager* m_rtpcFlushManager = nullptr;
 	//UPROPERTY(Transient) class UPooledSoundEmitterManager* m_pooledSoundEmitterManager{};
 
 	bool m_isAppForeground = true;
@@ -164,6 +170,18 @@ protected:
 	void DeinitializeStaticSoundEmitterManager();
 	void InitializeAmbientBedManager();
 	void DeinitializeAmbientBedManager();
+	void InitializeDistanceCullingManager();
+	void DeinitializeDistanceCullingManager();
+	void InitializeAkComponentPoolManager(const UWwiserRGameSettings* AudioConfig);
+	void DeinitializeAkComponentPoolManager();
+	void InitializeGameObjectPositionManager(const UWwiserRGameSettings* AudioConfig);
+	void DeinitializeGameObjectPositionManager();
+	void InitializeOneShotQueueManager(const UWwiserRGameSettings* AudioConfig);
+	void DeinitializeOneShotQueueManager();
+	void InitializeRepeatingOneShotManager();
+	void DeinitializeRepeatingOneShotManager();
+	void InitializeRtpcFlushManager(const UWwiserRGameSettings* AudioConfig);
+	void DeinitializeRtpcFlushManager();
 
 	void ClientBindDelegates();
 
@@ -200,6 +218,12 @@ public:
 	FORCEINLINE UGlobalSoundEmitterManager* GetGlobalSoundEmitterManager() const { return m_globalSoundEmitterManager; }
 	FORCEINLINE UStaticSoundEmitterManager* GetStaticSoundEmitterManager() const { return m_staticSoundEmitterManager; }
 	FORCEINLINE UAmbientBedManager* GetAmbientSoundManager() const { return m_ambientBedManager; }
+	FORCEINLINE UDistanceCullingManager* GetDistanceCullingManager() const { return m_distanceCullingManager; }
+	FORCEINLINE UAkComponentPoolManager* GetAkComponentPoolManager() const { return m_akComponentPoolManager; }
+	FORCEINLINE UGameObjectPositionManager* GetGameObjectPositionManager() const { return m_gameObjectPositionManager; }
+	FORCEINLINE UOneShotQueueManager* GetOneShotQueueManager() const { return m_oneShotQueueManager; }
+	FORCEINLINE URepeatingOneShotManager* GetRepeatingOneShotManager() const { return m_repeatingOneShotManager; }
+	FORCEINLINE URtpcFlushManager* GetRtpcFlushManager() const { return m_rtpcFlushManager; }
 	//FORCEINLINE UPooledSoundEmitterManager* GetPooledSoundEmitterManager() const { return m_pooledSoundEmitterManager; }
 
 	UFUNCTION(BlueprintCallable, BlueprintCosmetic, BlueprintPure, Category = "WwiserR|Audio Subsystem")
@@ -2,6 +2,8 @@
 
 #include "AudioUtils.h"
 #include "AkComponent.h"
+#include "AkRtpc.h"
+#include "Algo/BinarySearch.h"
 
 DEFINE_LOG_CATEGORY(LogWwiserR);
 
@@ -45,3 +47,59 @@ void UAudioUtils::DrawDebugArrow(UWorld* world, const FVector& Start, const FVec
 	DrawDebugLine(world, Start, End, Color);
 	DrawDebugCone(world, End, -Direction, Length / 10.f, 0.25f, .25f, 6, Color);
 }
+
+#pragma region FRtpcTable
+int32 FRtpcTable::Set(UAkRtpc* Rtpc, float Value, int32 InterpolationTimeMs, float Epsilon)
+{
+	const AkRtpcID shortID = Rtpc->GetShortID();
+	const int32 index = LowerBound(shortID);
+
+	if (!Entries.IsValidIndex(index) || Entries[index].ShortID != shortID)
+	{
+		Entries.Insert(FEmitterRtpc(Rtpc, shortID), index);
+	}
+	else if (FMath::Abs(Value - Entries[index].Value) <= Epsilon)
+	{
+		return INDEX_NONE;
+	}
+
+	FEmitterRtpc& entry = Entries[index];
+	entry.Value = Value;
+	entry.InterpolationTimeMs = InterpolationTimeMs;	// the last write in a frame is sent
+	return index;
+}
+
+bool FRtpcTable::Remove(AkRtpcID ShortID)
+{
+	const int32 index = LowerBound(ShortID);
+	if (!Entries.IsValidIndex(index) || Entries[index].ShortID != ShortID) { return false; }
+
+	NumDirty -= Entries[index].bDirty ? 1 : 0;
+	Entries.RemoveAt(index, 1, false);
+	return true;
+}
+
+void FRtpcTable::MarkDirty(int32 Index)
+{
+	FEmitterRtpc& entry = Entries[Index];
+	NumDirty += entry.bDirty ? 0 : 1;
+	entry.bDirty = true;
+}
+
+void FRtpcTable::ClearDirty()
+{
+	if (NumDirty == 0) { return; }
+
+	for (FEmitterRtpc& entry : Entries)
+	{
+		entry.bDirty = false;
+	}
+
+	NumDirty = 0;
+}
+
+int32 FRtpcTable::LowerBound(AkRtpcID ShortID) const
+{
+	return Algo::LowerBoundBy(Entries, ShortID, &FEmitterRtpc::ShortID);
+}
+#pragma endregion
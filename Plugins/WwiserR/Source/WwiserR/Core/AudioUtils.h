@@ -9,6 +9,7 @@
 #pragma region Log Macros
 
 DECLARE_LOG_CATEGORY_EXTERN(LogWwiserR, Log, All);
+DECLARE_STATS_GROUP(TEXT("WwiserR"), STATGROUP_WwiserR, STATCAT_Advanced);
 
 namespace WR_Log
 {
@@ -100,31 +101,37 @@ enum class EFoot : uint8
 	Right
 };
 
-// keeps track of Rtpcs posted on sound emitters
-USTRUCT() struct WWISERR_API FActiveRtpc
+// Rtpc set on a sound emitter, replayed on newly registered game objects
+struct FEmitterRtpc
 {
-	GENERATED_BODY()
-
-public:
 	class UAkRtpc*	Rtpc{};
+	AkRtpcID		ShortID = AK_INVALID_RTPC_ID;
 	float			Value{};
+	int32			InterpolationTimeMs{};
+	bool			bDirty{};	// not sent to the game object yet
 
-public:
-	FActiveRtpc() {}
-	FActiveRtpc(UAkRtpc* in_Rtpc, float in_Value) : Rtpc(in_Rtpc), Value(in_Value) {}
-
+	FEmitterRtpc() {}
+	FEmitterRtpc(UAkRtpc* a_Rtpc, AkRtpcID a_ShortID) : Rtpc(a_Rtpc), ShortID(a_ShortID) {}
 };
 
-FORCEINLINE uint32 GetTypeHash(const FActiveRtpc& ActiveRtpc)
+// compact table of Rtpcs set on a sound emitter, sorted on Rtpc short ID
+struct WWISERR_API FRtpcTable
 {
-	uint32 Hash = FCrc::MemCrc32(&ActiveRtpc, sizeof(ActiveRtpc));
-	return Hash;
-}
+	TArray<FEmitterRtpc> Entries{};
+	int32 NumDirty = 0;
 
-inline bool operator==(const FActiveRtpc& a, const FActiveRtpc& b)
-{
-	return GetTypeHash(a) == GetTypeHash(b);
-}
+	/** returns the index of the entry if it was added or its value changed more than Epsilon, INDEX_NONE otherwise */
+	int32 Set(UAkRtpc* Rtpc, float Value, int32 InterpolationTimeMs, float Epsilon);
+	bool Remove(AkRtpcID ShortID);
+	void MarkDirty(int32 Index);
+	void ClearDirty();
+
+	FORCEINLINE void Empty() { Entries.Empty(); NumDirty = 0; }
+	FORCEINLINE bool HasDirtyEntries() const { return NumDirty > 0; }
+
+protected:
+	int32 LowerBound(AkRtpcID ShortID) const;
+};
 
 // keeps track of all looping events posted on sound emitters
 USTRUCT()
@@ -143,11 +150,11 @@ public:
 	TMap<class UAkRtpc*, float>	RtpcsOnPlayingID{};
 
 	bool	bIsVirtual{};
-	float	NextCullTime{};
+	double	NextCullTime{};	// world time in seconds, double precision to avoid drift in long sessions
 
 public:
 	FPlayingAudioLoop(UAkAudioEvent* a_AkEvent, bool a_bQueryAndPostEnvironmentSwitches, AkPlayingID a_PlayingID, bool a_bIsVirtual,
-		float a_AttenuationRangeBuffer, float a_NextCullTime)
+		float a_AttenuationRangeBuffer, double a_NextCullTime)
 		: AkEvent(a_AkEvent)
 		, LastPlayingID(a_PlayingID)
 		, AttenuationRangeBuffer(a_AttenuationRangeBuffer)
@@ -0,0 +1,233 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#include "DistanceCullingKernel.h"
+#include "Math/VectorRegister.h"
+#include "Core/AudioUtils.h"
+
+#if !UE_BUILD_SHIPPING
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#endif
+
+#pragma region Batches
+void FCullingListenerBatch::Reset(const FVector& a_Origin)
+{
+	Origin = a_Origin;
+	PosX.Reset();
+	PosY.Reset();
+	PosZ.Reset();
+	MaxSpeed.Reset();
+}
+
+void FCullingListenerBatch::Add(const FVector& Position, float a_MaxSpeed)
+{
+	const FVector relativePosition = Position - Origin;
+
+	PosX.Add(relativePosition.X);
+	PosY.Add(relativePosition.Y);
+	PosZ.Add(relativePosition.Z);
+	MaxSpeed.Add(a_MaxSpeed);
+}
+
+void FCullingLoopBatch::Reset(const FVector& a_Origin)
+{
+	Origin = a_Origin;
+	PosX.Reset();
+	PosY.Reset();
+	PosZ.Reset();
+	CullRange.Reset();
+	EmitterMaxSpeed.Reset();
+	bInRange.Reset();
+	NextCullTime.Reset();
+}
+
+int32 FCullingLoopBatch::Add(const FVector& CullingLocation, float a_CullRange, float a_EmitterMaxSpeed)
+{
+	const FVector relativePosition = CullingLocation - Origin;
+
+	PosX.Add(relativePosition.X);
+	PosY.Add(relativePosition.Y);
+	PosZ.Add(relativePosition.Z);
+	CullRange.Add(a_CullRange);
+	EmitterMaxSpeed.Add(a_EmitterMaxSpeed);
+	bInRange.Add(false);
+
+	return NextCullTime.Add(INFINITY);
+}
+#pragma endregion
+
+#pragma region Kernels
+namespace WR_DistanceCulling
+{
+	static void CullLoopRangeScalar(
+		const FCullingListenerBatch& Listeners, FCullingLoopBatch& Loops, double CurrentTime, int32 StartIndex, int32 EndIndex)
+	{
+		const int32 numListeners = Listeners.Num();
+
+		for (int32 i = StartIndex; i < EndIndex; i++)
+		{
+			const float cullRange = Loops.CullRange[i];
+			const float cullRangeSquared = cullRange * cullRange;
+			bool bInRange = false;
+			float minInterval = TNumericLimits<float>::Max();
+
+			for (int32 l = 0; l < numListeners; l++)
+			{
+				const float dx = Loops.PosX[i] - Listeners.PosX[l];
+				const float dy = Loops.PosY[i] - Listeners.PosY[l];
+				const float dz = Loops.PosZ[i] - Listeners.PosZ[l];
+				const float distanceSquared = dx * dx + dy * dy + dz * dz;
+
+				bInRange |= distanceSquared < cullRangeSquared;
+
+				const float maxRelativeSpeed = Loops.EmitterMaxSpeed[i] + Listeners.MaxSpeed[l];
+
+				if (maxRelativeSpeed > 0.f)
+				{
+					const float minDistanceToTravel = FMath::Abs(FMath::Sqrt(distanceSquared) - cullRange);
+					minInterval = FMath::Min(minInterval, minDistanceToTravel / maxRelativeSpeed);
+				}
+			}
+
+			Loops.bInRange[i] = bInRange;
+			Loops.NextCullTime[i] = minInterval < TNumericLimits<float>::Max() ? CurrentTime + minInterval : INFINITY;
+		}
+	}
+
+	void CullLoopsScalar(const FCullingListenerBatch& Listeners, FCullingLoopBatch& Loops, double CurrentTime)
+	{
+		CullLoopRangeScalar(Listeners, Loops, CurrentTime, 0, Loops.Num());
+	}
+
+	void CullLoopsVectorized(const FCullingListenerBatch& Listeners, FCullingLoopBatch& Loops, double CurrentTime)
+	{
+		const int32 numLoops = Loops.Num();
+		const int32 numListeners = Listeners.Num();
+		const int32 numVectorized = numLoops & ~3;
+
+		const VectorRegister4Float zero = VectorZeroFloat();
+		const VectorRegister4Float maxInterval = VectorSetFloat1(TNumericLimits<float>::Max());
+
+		for (int32 i = 0; i < numVectorized; i += 4)
+		{
+			const VectorRegister4Float loopX = VectorLoad(&Loops.PosX[i]);
+			const VectorRegister4Float loopY = VectorLoad(&Loops.PosY[i]);
+			const VectorRegister4Float loopZ = VectorLoad(&Loops.PosZ[i]);
+			const VectorRegister4Float cullRange = VectorLoad(&Loops.CullRange[i]);
+			const VectorRegister4Float cullRangeSquared = VectorMultiply(cullRange, cullRange);
+			const VectorRegister4Float emitterMaxSpeed = VectorLoad(&Loops.EmitterMaxSpeed[i]);
+
+			VectorRegister4Float inRangeMask = zero;
+			VectorRegister4Float minInterval = maxInterval;
+
+			for (int32 l = 0; l < numListeners; l++)
+			{
+				const VectorRegister4Float dx = VectorSubtract(loopX, VectorSetFloat1(Listeners.PosX[l]));
+				const VectorRegister4Float dy = VectorSubtract(loopY, VectorSetFloat1(Listeners.PosY[l]));
+				const VectorRegister4Float dz = VectorSubtract(loopZ, VectorSetFloat1(Listeners.PosZ[l]));
+				const VectorRegister4Float distanceSquared = VectorMultiplyAdd(dx, dx, VectorMultiplyAdd(dy, dy, VectorMultiply(dz, dz)));
+
+				inRangeMask = VectorBitwiseOr(inRangeMask, VectorCompareLT(distanceSquared, cullRangeSquared));
+
+				// lanes without relative speed never need to be culled by this listener
+				const VectorRegister4Float maxRelativeSpeed = VectorAdd(emitterMaxSpeed, VectorSetFloat1(Listeners.MaxSpeed[l]));
+				const VectorRegister4Float minDistanceToTravel = VectorAbs(VectorSubtract(VectorSqrt(distanceSquared), cullRange));
+				const VectorRegister4Float interval = VectorSelect(VectorCompareGT(maxRelativeSpeed, zero),
+					VectorDivide(minDistanceToTravel, maxRelativeSpeed), maxInterval);
+
+				minInterval = VectorMin(minInterval, interval);
+			}
+
+			const int32 inRangeBits = VectorMaskBits(inRangeMask);
+			alignas(16) float intervals[4];
+			VectorStoreAligned(minInterval, intervals);
+
+			for (int32 j = 0; j < 4; j++)
+			{
+				Loops.bInRange[i + j] = (inRangeBits >> j) & 1;
+				Loops.NextCullTime[i + j] = intervals[j] < TNumericLimits<float>::Max() ? CurrentTime + intervals[j] : INFINITY;
+			}
+		}
+
+		CullLoopRangeScalar(Listeners, Loops, CurrentTime, numVectorized, numLoops);
+	}
+} // namespace WR_DistanceCulling
+#pragma endregion
+
+#pragma region Benchmark
+#if !UE_BUILD_SHIPPING
+namespace Private_DistanceCullingKernel
+{
+	static void FillBenchmarkBatches(FRandomStream& Random, int32 NumLoops, FCullingListenerBatch& Listeners, FCullingLoopBatch& Loops)
+	{
+		static const float worldExtent = 200000.f;	// 2 km
+
+		Listeners.Reset(FVector::ZeroVector);
+		Loops.Reset(FVector::ZeroVector);
+
+		// distance probe, 2 world listeners and 1 default listener
+		Listeners.Add(FVector::ZeroVector, 1200.f);
+		Listeners.Add(Random.GetUnitVector() * worldExtent * 0.5f, 600.f);
+		Listeners.Add(Random.GetUnitVector() * worldExtent * 0.5f, 0.f);
+		Listeners.Add(Random.GetUnitVector() * worldExtent * 0.5f, 2000.f);
+
+		for (int32 i = 0; i < NumLoops; i++)
+		{
+			const FVector location(Random.FRandRange(-worldExtent, worldExtent),
+				Random.FRandRange(-worldExtent, worldExtent), Random.FRandRange(-1000.f, 1000.f));
+
+			Loops.Add(location, Random.FRandRange(500.f, 10000.f), Random.RandRange(0, 3) == 0 ? Random.FRandRange(0.f, 1000.f) : 0.f);
+		}
+	}
+
+	static void RunBenchmark(const TArray<FString>& Args)
+	{
+		const int32 iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100;
+		const int32 batchSizes[] = { 1000, 10000, 50000 };
+		const double currentTime = 3600. * 24.;	// a long session, to expose float time precision issues
+
+		FRandomStream random(1337);
+		FCullingListenerBatch listeners;
+		FCullingLoopBatch scalarLoops;
+
+		for (const int32 numLoops : batchSizes)
+		{
+			FillBenchmarkBatches(random, numLoops, listeners, scalarLoops);
+			FCullingLoopBatch vectorizedLoops = scalarLoops;
+
+			double startTime = FPlatformTime::Seconds();
+			for (int32 i = 0; i < iterations; i++)
+			{
+				WR_DistanceCulling::CullLoopsScalar(listeners, scalarLoops, currentTime);
+			}
+			const double scalarMs = (FPlatformTime::Seconds() - startTime) * 1000. / iterations;
+
+			startTime = FPlatformTime::Seconds();
+			for (int32 i = 0; i < iterations; i++)
+			{
+				WR_DistanceCulling::CullLoopsVectorized(listeners, vectorizedLoops, currentTime);
+			}
+			const double vectorizedMs = (FPlatformTime::Seconds() - startTime) * 1000. / iterations;
+
+			int32 numMismatches = 0;
+			for (int32 i = 0; i < numLoops; i++)
+			{
+				if (scalarLoops.bInRange[i] != vectorizedLoops.bInRange[i]
+					|| !WR_DistanceCulling::IsSameCullTime(scalarLoops.NextCullTime[i], vectorizedLoops.NextCullTime[i]))
+				{
+					numMismatches++;
+				}
+			}
+
+			WR_DBG_STATIC_FUNC(Log, "%6i loops x %i listeners : scalar reference %.4f ms, vectorized %.4f ms (x%.2f), mismatches: %i",
+				numLoops, listeners.Num(), scalarMs, vectorizedMs, vectorizedMs > 0. ? scalarMs / vectorizedMs : 0., numMismatches);
+		}
+	}
+
+	static FAutoConsoleCommand CCmd_DistanceCulling_Benchmark(TEXT("WwiserR.DistanceCulling.Benchmark"),
+		TEXT("Checks the vectorized distance culling kernel against its scalar reference at 1k/10k/50k synthetic loops. ")
+		TEXT("See WwiserR.DistanceCulling.EmitterBenchmark for the speedup over the per emitter path. (optional: iterations, default 100)"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunBenchmark), ECVF_Cheat);
+} // namespace Private_DistanceCullingKernel
+#endif
+#pragma endregion
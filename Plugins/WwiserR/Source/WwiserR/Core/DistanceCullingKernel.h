@@ -0,0 +1,63 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * DistanceCullingKernel
+ * ---------------------
+ *
+ * - data oriented distance culling path: listeners and loop records are stored as structures of arrays
+ * - computes in-range flags and next cull times for a whole batch of loops against all listeners at once, 4 loops per SIMD register
+ * - positions are stored relative to a shared origin (usually the distance probe) to keep float precision in large worlds
+ */
+
+// listener positions and maximum speeds, gathered once per frame
+struct WWISERR_API FCullingListenerBatch
+{
+	FVector			Origin = FVector::ZeroVector;
+	TArray<float>	PosX{};
+	TArray<float>	PosY{};
+	TArray<float>	PosZ{};
+	TArray<float>	MaxSpeed{};
+
+	FORCEINLINE int32 Num() const { return PosX.Num(); }
+
+	void Reset(const FVector& a_Origin);
+	void Add(const FVector& Position, float a_MaxSpeed);
+};
+
+// loop records to cull, results are written to bInRange and NextCullTime
+struct WWISERR_API FCullingLoopBatch
+{
+	FVector			Origin = FVector::ZeroVector;
+	TArray<float>	PosX{};
+	TArray<float>	PosY{};
+	TArray<float>	PosZ{};
+	TArray<float>	CullRange{};
+	TArray<float>	EmitterMaxSpeed{};
+
+	TArray<uint8>	bInRange{};
+	TArray<double>	NextCullTime{};
+
+	FORCEINLINE int32 Num() const { return PosX.Num(); }
+
+	void Reset(const FVector& a_Origin);
+	int32 Add(const FVector& CullingLocation, float a_CullRange, float a_EmitterMaxSpeed);
+};
+
+namespace WR_DistanceCulling
+{
+	/** reference implementation, one loop and listener at a time */
+	WWISERR_API void CullLoopsScalar(const FCullingListenerBatch& Listeners, FCullingLoopBatch& Loops, double CurrentTime);
+
+	/** SIMD implementation, 4 loops at a time against each listener */
+	WWISERR_API void CullLoopsVectorized(const FCullingListenerBatch& Listeners, FCullingLoopBatch& Loops, double CurrentTime);
+
+	/** loops without relative speed are never culled again, their cull times are INFINITY and can't be subtracted */
+	FORCEINLINE bool IsSameCullTime(double A, double B, double Tolerance = 1.e-3)
+	{
+		return A == B || FMath::IsNearlyEqual(A, B, Tolerance);
+	}
+}
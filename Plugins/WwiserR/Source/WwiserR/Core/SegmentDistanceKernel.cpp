@@ -0,0 +1,384 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#include "SegmentDistanceKernel.h"
+#include "Math/VectorRegister.h"
+#include "Algo/Sort.h"
+#include "Core/AudioUtils.h"
+
+#if !UE_BUILD_SHIPPING
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#endif
+
+namespace Private_SegmentDistanceKernel
+{
+	// padding segments, far enough to never be closest without overflowing the squared distance
+	static constexpr float UnreachableCoordinate = 1.e15f;
+
+	static FORCEINLINE float GetBoxDistanceSquared(const FSegmentBVHNode& Node, const FVector3f& Position)
+	{
+		return FVector3f::Max(FVector3f::Max(Node.Min - Position, Position - Node.Max), FVector3f::ZeroVector).SizeSquared();
+	}
+
+	// keeps OutSegments sorted nearest first, with at most MaxSegments entries
+	static FORCEINLINE void InsertClosestSegment(TArray<FClosestSegment>& OutSegments, int32 MaxSegments, const FVector& Point,
+		float DistanceSquared, int32 SegmentIndex)
+	{
+		if (OutSegments.Num() == MaxSegments)
+		{
+			if (DistanceSquared >= OutSegments.Last().DistanceSquared) { return; }
+			OutSegments.Pop(false);
+		}
+
+		int32 insertIndex = OutSegments.Num();
+		while (insertIndex > 0 && OutSegments[insertIndex - 1].DistanceSquared > DistanceSquared) { insertIndex--; }
+
+		FClosestSegment& closestSegment = OutSegments.InsertDefaulted_GetRef(insertIndex);
+		closestSegment.Point = Point;
+		closestSegment.DistanceSquared = DistanceSquared;
+		closestSegment.SegmentIndex = SegmentIndex;
+	}
+
+	static FORCEINLINE float GetWorstDistanceSquared(const TArray<FClosestSegment>& OutSegments, int32 MaxSegments)
+	{
+		return OutSegments.Num() == MaxSegments ? OutSegments.Last().DistanceSquared : TNumericLimits<float>::Max();
+	}
+} // namespace Private_SegmentDistanceKernel
+
+#pragma region Build
+void FSegmentBVH::Reset()
+{
+	m_origin = FVector::ZeroVector;
+	m_startX.Reset();
+	m_startY.Reset();
+	m_startZ.Reset();
+	m_dirX.Reset();
+	m_dirY.Reset();
+	m_dirZ.Reset();
+	m_invLengthSquared.Reset();
+	m_segmentIndices.Reset();
+	m_nodes.Reset();
+	m_numSegments = 0;
+}
+
+void FSegmentBVH::Build(TConstArrayView<FVector> Points, bool bClosedLoop)
+{
+	Reset();
+	if (Points.IsEmpty()) { return; }
+
+	// a single point is a degenerate segment
+	const int32 numPoints = Points.Num();
+	m_numSegments = numPoints == 1 ? 1 : (bClosedLoop && numPoints > 2 ? numPoints : numPoints - 1);
+	m_origin = Points[0];
+
+	TArray<FVector3f> starts;
+	TArray<FVector3f> ends;
+	TArray<int32> segments;
+	starts.Reserve(m_numSegments);
+	ends.Reserve(m_numSegments);
+	segments.Reserve(m_numSegments);
+
+	for (int32 i = 0; i < m_numSegments; i++)
+	{
+		starts.Emplace(Points[i] - m_origin);
+		ends.Emplace(Points[(i + 1) % numPoints] - m_origin);
+		segments.Add(i);
+	}
+
+	const int32 numSlots = Align(m_numSegments, SegmentsPerBlock);
+	m_startX.Reserve(numSlots);
+	m_startY.Reserve(numSlots);
+	m_startZ.Reserve(numSlots);
+	m_dirX.Reserve(numSlots);
+	m_dirY.Reserve(numSlots);
+	m_dirZ.Reserve(numSlots);
+	m_invLengthSquared.Reserve(numSlots);
+	m_segmentIndices.Reserve(numSlots);
+	m_nodes.Reserve(2 * numSlots / SegmentsPerBlock);
+
+	m_nodes.AddDefaulted();
+	BuildNode(0, segments, starts, ends, 0, m_numSegments);
+}
+
+void FSegmentBVH::BuildNode(int32 NodeIndex, TArray<int32>& Segments, const TArray<FVector3f>& Starts, const TArray<FVector3f>& Ends,
+	int32 First, int32 Num)
+{
+	FVector3f boundsMin(TNumericLimits<float>::Max());
+	FVector3f boundsMax(TNumericLimits<float>::Lowest());
+	FVector3f centroidsMin(TNumericLimits<float>::Max());
+	FVector3f centroidsMax(TNumericLimits<float>::Lowest());
+
+	for (int32 i = First; i < First + Num; i++)
+	{
+		const FVector3f& start = Starts[Segments[i]];
+		const FVector3f& end = Ends[Segments[i]];
+		const FVector3f centroid = (start + end) * 0.5f;
+
+		boundsMin = FVector3f::Min(boundsMin, FVector3f::Min(start, end));
+		boundsMax = FVector3f::Max(boundsMax, FVector3f::Max(start, end));
+		centroidsMin = FVector3f::Min(centroidsMin, centroid);
+		centroidsMax = FVector3f::Max(centroidsMax, centroid);
+	}
+
+	m_nodes[NodeIndex].Min = boundsMin;
+	m_nodes[NodeIndex].Max = boundsMax;
+
+	if (Num <= SegmentsPerBlock)
+	{
+		m_nodes[NodeIndex].Index = m_segmentIndices.Num() / SegmentsPerBlock;
+		m_nodes[NodeIndex].NumBlocks = 1;
+		AddBlock(MakeArrayView(Segments.GetData() + First, Num), Starts, Ends);
+		return;
+	}
+
+	// median split on the longest axis of the centroids, the first half is kept a multiple of full blocks
+	const FVector3f centroidsExtent = centroidsMax - centroidsMin;
+	const int32 axis = centroidsExtent.X >= centroidsExtent.Y
+		? (centroidsExtent.X >= centroidsExtent.Z ? 0 : 2)
+		: (centroidsExtent.Y >= centroidsExtent.Z ? 1 : 2);
+
+	Algo::Sort(MakeArrayView(Segments.GetData() + First, Num), [&Starts, &Ends, axis](int32 A, int32 B)
+		{
+			return Starts[A][axis] + Ends[A][axis] < Starts[B][axis] + Ends[B][axis];
+		});
+
+	const int32 numFirst = FMath::Max(SegmentsPerBlock, (Num / 2) & ~(SegmentsPerBlock - 1));
+	const int32 firstChild = m_nodes.AddDefaulted(2);
+
+	m_nodes[NodeIndex].Index = firstChild;
+	m_nodes[NodeIndex].NumBlocks = 0;
+
+	BuildNode(firstChild, Segments, Starts, Ends, First, numFirst);
+	BuildNode(firstChild + 1, Segments, Starts, Ends, First + numFirst, Num - numFirst);
+}
+
+void FSegmentBVH::AddBlock(TConstArrayView<int32> Segments, const TArray<FVector3f>& Starts, const TArray<FVector3f>& Ends)
+{
+	for (int32 i = 0; i < SegmentsPerBlock; i++)
+	{
+		if (i < Segments.Num())
+		{
+			const FVector3f& start = Starts[Segments[i]];
+			const FVector3f direction = Ends[Segments[i]] - start;
+			const float lengthSquared = direction.SizeSquared();
+
+			m_startX.Add(start.X);
+			m_startY.Add(start.Y);
+			m_startZ.Add(start.Z);
+			m_dirX.Add(direction.X);
+			m_dirY.Add(direction.Y);
+			m_dirZ.Add(direction.Z);
+			m_invLengthSquared.Add(lengthSquared > UE_KINDA_SMALL_NUMBER ? 1.f / lengthSquared : 0.f);
+			m_segmentIndices.Add(Segments[i]);
+		}
+		else
+		{
+			m_startX.Add(Private_SegmentDistanceKernel::UnreachableCoordinate);
+			m_startY.Add(Private_SegmentDistanceKernel::UnreachableCoordinate);
+			m_startZ.Add(Private_SegmentDistanceKernel::UnreachableCoordinate);
+			m_dirX.Add(0.f);
+			m_dirY.Add(0.f);
+			m_dirZ.Add(0.f);
+			m_invLengthSquared.Add(0.f);
+			m_segmentIndices.Add(INDEX_NONE);
+		}
+	}
+}
+#pragma endregion
+
+#pragma region Queries
+void FSegmentBVH::TestBlock(int32 Block, const FVector3f& Position, int32 MaxSegments, TArray<FClosestSegment>& OutSegments) const
+{
+	const int32 i = Block * SegmentsPerBlock;
+
+	const VectorRegister4Float zero = VectorZeroFloat();
+	const VectorRegister4Float one = VectorOneFloat();
+
+	const VectorRegister4Float startX = VectorLoad(&m_startX[i]);
+	const VectorRegister4Float startY = VectorLoad(&m_startY[i]);
+	const VectorRegister4Float startZ = VectorLoad(&m_startZ[i]);
+	const VectorRegister4Float dirX = VectorLoad(&m_dirX[i]);
+	const VectorRegister4Float dirY = VectorLoad(&m_dirY[i]);
+	const VectorRegister4Float dirZ = VectorLoad(&m_dirZ[i]);
+
+	// projection of the position on each segment, clamped to its end points
+	const VectorRegister4Float toPositionX = VectorSubtract(VectorSetFloat1(Position.X), startX);
+	const VectorRegister4Float toPositionY = VectorSubtract(VectorSetFloat1(Position.Y), startY);
+	const VectorRegister4Float toPositionZ = VectorSubtract(VectorSetFloat1(Position.Z), startZ);
+
+	const VectorRegister4Float dot = VectorMultiplyAdd(toPositionX, dirX, VectorMultiplyAdd(toPositionY, dirY, VectorMultiply(toPositionZ, dirZ)));
+	const VectorRegister4Float t = VectorMin(VectorMax(VectorMultiply(dot, VectorLoad(&m_invLengthSquared[i])), zero), one);
+
+	const VectorRegister4Float offsetX = VectorSubtract(toPositionX, VectorMultiply(t, dirX));
+	const VectorRegister4Float offsetY = VectorSubtract(toPositionY, VectorMultiply(t, dirY));
+	const VectorRegister4Float offsetZ = VectorSubtract(toPositionZ, VectorMultiply(t, dirZ));
+	const VectorRegister4Float distanceSquared =
+		VectorMultiplyAdd(offsetX, offsetX, VectorMultiplyAdd(offsetY, offsetY, VectorMultiply(offsetZ, offsetZ)));
+
+	alignas(16) float distancesSquared[4];
+	alignas(16) float ts[4];
+	VectorStoreAligned(distanceSquared, distancesSquared);
+	VectorStoreAligned(t, ts);
+
+	for (int32 j = 0; j < SegmentsPerBlock; j++)
+	{
+		if (m_segmentIndices[i + j] == INDEX_NONE
+			|| distancesSquared[j] >= Private_SegmentDistanceKernel::GetWorstDistanceSquared(OutSegments, MaxSegments))
+		{
+			continue;
+		}
+
+		const FVector3f point(m_startX[i + j] + ts[j] * m_dirX[i + j], m_startY[i + j] + ts[j] * m_dirY[i + j],
+			m_startZ[i + j] + ts[j] * m_dirZ[i + j]);
+
+		Private_SegmentDistanceKernel::InsertClosestSegment(OutSegments, MaxSegments, m_origin + FVector(point), distancesSquared[j],
+			m_segmentIndices[i + j]);
+	}
+}
+
+int32 FSegmentBVH::FindClosestSegments(const FVector& Position, int32 MaxSegments, TArray<FClosestSegment>& OutSegments) const
+{
+	OutSegments.Reset();
+	if (IsEmpty() || MaxSegments < 1) { return 0; }
+
+	const FVector3f position(Position - m_origin);
+
+	TArray<int32, TInlineAllocator<64>> stack;
+	stack.Add(0);
+
+	while (!stack.IsEmpty())
+	{
+		const FSegmentBVHNode& node = m_nodes[stack.Pop(false)];
+
+		if (Private_SegmentDistanceKernel::GetBoxDistanceSquared(node, position)
+			>= Private_SegmentDistanceKernel::GetWorstDistanceSquared(OutSegments, MaxSegments))
+		{
+			continue;
+		}
+
+		if (node.NumBlocks > 0)
+		{
+			for (int32 block = node.Index; block < node.Index + node.NumBlocks; block++)
+			{
+				TestBlock(block, position, MaxSegments, OutSegments);
+			}
+
+			continue;
+		}
+
+		// the nearest child is visited first, so farther nodes are more likely to be skipped
+		const bool bFirstIsNearer = Private_SegmentDistanceKernel::GetBoxDistanceSquared(m_nodes[node.Index], position)
+			<= Private_SegmentDistanceKernel::GetBoxDistanceSquared(m_nodes[node.Index + 1], position);
+
+		stack.Add(bFirstIsNearer ? node.Index + 1 : node.Index);
+		stack.Add(bFirstIsNearer ? node.Index : node.Index + 1);
+	}
+
+	return OutSegments.Num();
+}
+
+int32 FSegmentBVH::FindClosestSegmentsScalar(const FVector& Position, int32 MaxSegments, TArray<FClosestSegment>& OutSegments) const
+{
+	OutSegments.Reset();
+	if (IsEmpty() || MaxSegments < 1) { return 0; }
+
+	const FVector3f position(Position - m_origin);
+
+	for (int32 i = 0; i < m_segmentIndices.Num(); i++)
+	{
+		if (m_segmentIndices[i] == INDEX_NONE) { continue; }
+
+		const FVector3f start(m_startX[i], m_startY[i], m_startZ[i]);
+		const FVector3f direction(m_dirX[i], m_dirY[i], m_dirZ[i]);
+		const float t = FMath::Clamp(FVector3f::DotProduct(position - start, direction) * m_invLengthSquared[i], 0.f, 1.f);
+		const FVector3f point = start + t * direction;
+
+		Private_SegmentDistanceKernel::InsertClosestSegment(OutSegments, MaxSegments, m_origin + FVector(point),
+			FVector3f::DistSquared(position, point), m_segmentIndices[i]);
+	}
+
+	return OutSegments.Num();
+}
+#pragma endregion
+
+#pragma region Benchmark
+#if !UE_BUILD_SHIPPING
+namespace Private_SegmentDistanceKernel
+{
+	// meandering river, as a spline sampled into segments
+	static void FillBenchmarkPolyline(FRandomStream& Random, int32 NumSegments, TArray<FVector>& Points)
+	{
+		Points.Reset(NumSegments + 1);
+
+		FVector point = FVector::ZeroVector;
+		float heading = 0.f;
+
+		for (int32 i = 0; i <= NumSegments; i++)
+		{
+			Points.Add(point);
+			heading += Random.FRandRange(-0.3f, 0.3f);
+			point += FVector(FMath::Cos(heading), FMath::Sin(heading), Random.FRandRange(-0.02f, 0.02f)) * 250.f;
+		}
+	}
+
+	static void RunBenchmark(const TArray<FString>& Args)
+	{
+		const int32 numQueries = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+		const int32 numSegmentsPerPolyline[] = { 100, 1000, 10000 };
+		const int32 maxSegments[] = { 1, 4 };
+
+		FRandomStream random(1337);
+		TArray<FVector> points;
+		TArray<FVector> queries;
+		FSegmentBVH bvh;
+		TArray<FClosestSegment> scalarSegments;
+		TArray<FClosestSegment> bvhSegments;
+
+		for (const int32 numSegments : numSegmentsPerPolyline)
+		{
+			FillBenchmarkPolyline(random, numSegments, points);
+			bvh.Build(points);
+
+			const FBox bounds(points);
+			queries.Reset(numQueries);
+
+			for (int32 i = 0; i < numQueries; i++)
+			{
+				queries.Add(random.RandPointInBox(bounds.ExpandBy(5000.f)));
+			}
+
+			for (const int32 n : maxSegments)
+			{
+				double scalarSum = 0.;
+				double startTime = FPlatformTime::Seconds();
+				for (const FVector& query : queries)
+				{
+					bvh.FindClosestSegmentsScalar(query, n, scalarSegments);
+					scalarSum += scalarSegments.Last().DistanceSquared;
+				}
+				const double scalarMs = (FPlatformTime::Seconds() - startTime) * 1000. / numQueries;
+
+				double bvhSum = 0.;
+				startTime = FPlatformTime::Seconds();
+				for (const FVector& query : queries)
+				{
+					bvh.FindClosestSegments(query, n, bvhSegments);
+					bvhSum += bvhSegments.Last().DistanceSquared;
+				}
+				const double bvhMs = (FPlatformTime::Seconds() - startTime) * 1000. / numQueries;
+
+				WR_DBG_STATIC_FUNC(Log, "%5i segments, N = %i : scalar %.4f ms, vectorized bvh %.4f ms (x%.2f), closest %s, %.1f KB",
+					numSegments, n, scalarMs, bvhMs, bvhMs > 0. ? scalarMs / bvhMs : 0.,
+					FMath::IsNearlyEqual(scalarSum, bvhSum, FMath::Max(1., scalarSum) * 1.e-4) ? TEXT("matches") : TEXT("differs"),
+					bvh.GetAllocatedSize() / 1024.f);
+			}
+		}
+	}
+
+	static FAutoConsoleCommand CCmd_SegmentDistance_Benchmark(TEXT("WwiserR.SegmentDistance.Benchmark"),
+		TEXT("Compares closest segment queries by testing all segments with the vectorized segment hierarchy, at 100/1k/10k segments. ")
+		TEXT("(optional: queries, default 1000)"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunBenchmark), ECVF_Cheat);
+} // namespace Private_SegmentDistanceKernel
+#endif
+#pragma endregion
@@ -0,0 +1,76 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * SegmentDistanceKernel
+ * ---------------------
+ *
+ * - closest points on a polyline (e.g. a sampled spline), segments are stored as structures of arrays relative to a shared origin
+ * - segments are ordered by a bounding volume hierarchy, each leaf holds a block of 4 segments that is tested in one SIMD register
+ * - queries return the N closest segments to a position, nodes farther than the N-th closest segment found so far are skipped
+ */
+
+// closest point on one segment of a FSegmentBVH
+struct WWISERR_API FClosestSegment
+{
+	FVector Point = FVector::ZeroVector;
+	float DistanceSquared = TNumericLimits<float>::Max();
+	int32 SegmentIndex = INDEX_NONE;	// index of the segment's start point in the polyline
+};
+
+struct FSegmentBVHNode
+{
+	FVector3f Min{};
+	FVector3f Max{};
+	int32 Index = 0;		// first child (the second child follows it) or, for leaves, first block of 4 segments
+	int32 NumBlocks = 0;	// 0 for inner nodes
+};
+
+class WWISERR_API FSegmentBVH
+{
+public:
+	static constexpr int32 SegmentsPerBlock = 4;
+
+protected:
+	FVector m_origin = FVector::ZeroVector;
+
+	// per segment, padded to blocks of 4 with unreachable segments
+	TArray<float> m_startX{};
+	TArray<float> m_startY{};
+	TArray<float> m_startZ{};
+	TArray<float> m_dirX{};
+	TArray<float> m_dirY{};
+	TArray<float> m_dirZ{};
+	TArray<float> m_invLengthSquared{};
+	TArray<int32> m_segmentIndices{};	// INDEX_NONE for padding
+
+	TArray<FSegmentBVHNode> m_nodes{};
+	int32 m_numSegments = 0;
+
+public:
+	/** builds the hierarchy over the segments between consecutive points, and between the last and first point if bClosedLoop */
+	void Build(TConstArrayView<FVector> Points, bool bClosedLoop = false);
+	void Reset();
+
+	/** fills OutSegments with up to MaxSegments closest segments, nearest first. Returns the number found */
+	int32 FindClosestSegments(const FVector& Position, int32 MaxSegments, TArray<FClosestSegment>& OutSegments) const;
+
+	/** reference implementation, tests all segments one at a time */
+	int32 FindClosestSegmentsScalar(const FVector& Position, int32 MaxSegments, TArray<FClosestSegment>& OutSegments) const;
+
+	FORCEINLINE int32 NumSegments() const { return m_numSegments; }
+	FORCEINLINE bool IsEmpty() const { return m_numSegments == 0; }
+	FORCEINLINE SIZE_T GetAllocatedSize() const
+	{
+		return m_startX.GetAllocatedSize() * 7 + m_segmentIndices.GetAllocatedSize() + m_nodes.GetAllocatedSize();
+	}
+
+protected:
+	void BuildNode(int32 NodeIndex, TArray<int32>& Segments, const TArray<FVector3f>& Starts, const TArray<FVector3f>& Ends,
+		int32 First, int32 Num);
+	void AddBlock(TConstArrayView<int32> Segments, const TArray<FVector3f>& Starts, const TArray<FVector3f>& Ends);
+	void TestBlock(int32 Block, const FVector3f& Position, int32 MaxSegments, TArray<FClosestSegment>& OutSegments) const;
+};
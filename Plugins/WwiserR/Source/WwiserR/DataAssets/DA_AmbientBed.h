@@ -56,6 +56,19 @@ public:
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Spatialization")
 	float PortalCrossfadeTime = .5f;
+
+	/** the distance and weight Rtpcs (0 - 100) are only sent when they changed more than this value */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Updates", meta = (ClampMin = 0.f, ClampMax = 10.f))
+	float RtpcEpsilon = .5f;
+
+	/** the portal crossfade aux sends (0 - 1) are only sent when they changed more than this value */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Updates", meta = (ClampMin = 0.f, ClampMax = 1.f))
+	float AuxSendEpsilon = .02f;
+
+	/** Rtpcs and aux sends are sent at most this many times per second (0 = every frame).
+		Rtpcs are interpolated over the update interval to hide the lower rate **/
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Updates", meta = (ClampMin = 0.f))
+	float MaxUpdateRate = 15.f;
 };
 
 FORCEINLINE uint32 GetTypeHash(const UDA_AmbientBed& DA_AmbientBed)
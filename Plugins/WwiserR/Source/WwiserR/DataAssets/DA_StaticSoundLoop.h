@@ -43,6 +43,23 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Distance Culling")
 	float ActivationRangeOverride = -1.f;
 
+	/** fraction of the activation range the reference position has to move before the instances to play are selected again.
+	Emitters being added or removed and changed instance limits always trigger a new selection. 0 = select every tick */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Distance Culling", meta = (ClampMin = 0.f, ClampMax = 1.f))
+	float ReselectionDistanceFraction = 0.05f;
+
+	/** play the selected instances on one game object owned by the static sound manager, with one position per instance
+	(SetMultiplePositions), instead of one game object and voice per emitter. Emitters don't get their own AkComponent.
+	The game object takes the room and world listener sends of the emitter closest to the listener, switches and Rtpcs set on the
+	emitters are not applied: only use for loops without per emitter game syncs */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Multiple Positions")
+	bool bUseMultiplePositions = false;
+
+	/** MultiSources sums the instances like separate voices, MultiDirections only keeps their directions and the volume of the
+	closest one */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Multiple Positions", meta = (EditCondition = "bUseMultiplePositions"))
+	AkMultiPositionType MultiPositionType = AkMultiPositionType::MultiSources;
+
 	bool operator==(const UDA_StaticSoundLoop& Other) const
 	{
 		return LoopEvent == Other.LoopEvent && MaxInstances == Other.MaxInstances && MaxInstancesPerQuadrant == Other.MaxInstancesPerQuadrant;
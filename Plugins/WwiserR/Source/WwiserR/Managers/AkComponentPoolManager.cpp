@@ -0,0 +1,268 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#include "AkComponentPoolManager.h"
+#include "Core/AudioUtils.h"
+#include "Config/AudioConfig.h"
+#include "AkAudioDevice.h"
+#include "AkComponent.h"
+#include "AkComponentCallbackManager.h"
+
+#pragma region CVars
+namespace Private_AkComponentPoolManager
+{
+	static TAutoConsoleVariable<bool> CVar_AkComponentPool_DebugConsole(TEXT("WwiserR.AkComponentPool.DebugToConsole"), false,
+		TEXT("Log AkComponent pool prewarming and reuse statistics. (0 = off, 1 = on)"), ECVF_Cheat);
+
+	bool bDebugConsole = false;
+
+	static void OnAkComponentPoolManagerUpdate()
+	{
+		bDebugConsole = CVar_AkComponentPool_DebugConsole.GetValueOnGameThread();
+	}
+
+	FAutoConsoleVariableSink CAkComponentPoolManagerConsoleSink(FConsoleCommandDelegate::CreateStatic(&OnAkComponentPoolManagerUpdate));
+} // namespace Private_AkComponentPoolManager
+#pragma endregion
+
+void UAkComponentPoolManager::Initialize()
+{
+	const UWwiserRGameSettings* audioConfig = GetDefault<UWwiserRGameSettings>();
+	m_prewarmSize = audioConfig->AkComponentPoolPrewarmSize;
+	m_maxPoolSize = FMath::Max(audioConfig->AkComponentPoolMaxSize, m_prewarmSize);
+
+	FWorldDelegates::OnWorldInitializedActors.AddUObject(this, &UAkComponentPoolManager::OnWorldInitializedActors);
+	FWorldDelegates::OnWorldCleanup.AddUObject(this, &UAkComponentPoolManager::OnWorldCleanup);
+
+	WR_DBG_NET(Log, "initialized (%s)", *UAudioUtils::GetClientOrServerString(GetWorld()));
+}
+
+void UAkComponentPoolManager::Deinitialize()
+{
+	FWorldDelegates::OnWorldInitializedActors.RemoveAll(this);
+	FWorldDelegates::OnWorldCleanup.RemoveAll(this);
+
+	TArray<UWorld*> worlds;
+	m_worldPools.GetKeys(worlds);
+
+	for (UWorld* world : worlds)
+	{
+		OnWorldCleanup(world, true, true);
+	}
+
+	WR_DBG_NET(Log, "deinitialized (%s)", *UAudioUtils::GetClientOrServerString(GetWorld()));
+}
+
+UAkComponent* UAkComponentPoolManager::AcquireAkComponent(USceneComponent* AttachParent)
+{
+	if (!IsValid(AttachParent)) { return nullptr; }
+
+	UWorld* world = AttachParent->GetWorld();
+	if (!IsValid(world)) { return nullptr; }
+
+	FAkComponentPool& pool = m_worldPools.FindOrAdd(world);
+	UAkComponent* akComponent = nullptr;
+
+	while (!pool.Available.IsEmpty() && !IsValid(akComponent))
+	{
+		akComponent = pool.Available.Pop(false);
+	}
+
+	if (IsValid(akComponent))
+	{
+		akComponent->AttachToComponent(AttachParent, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+		ResetAkComponent(akComponent, AttachParent);
+
+#if !UE_BUILD_SHIPPING
+		m_dbgNumReused++;
+#endif
+	}
+	else
+	{
+		// freshly registered, nothing to reset but its name in the profiler
+		akComponent = CreateAkComponent(world);
+		akComponent->AttachToComponent(AttachParent, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+		RegisterWithOwnerName(akComponent, AttachParent);
+	}
+
+	return akComponent;
+}
+
+void UAkComponentPoolManager::ReleaseAkComponent(UAkComponent* AkComponent)
+{
+	if (!IsValid(AkComponent)) { return; }
+
+	if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
+	{
+		AkAudioDevice->StopGameObject(AkComponent);
+	}
+
+	FAkComponentPool* pool = m_worldPools.Find(AkComponent->GetWorld());
+
+	if (pool == nullptr)
+	{
+		AkComponent->DestroyComponent();
+		return;
+	}
+
+	ReturnToPool(AkComponent, *pool);
+}
+
+void UAkComponentPoolManager::ReleaseAkComponentWhenDone(UAkComponent* AkComponent)
+{
+	if (!IsValid(AkComponent)) { return; }
+
+	if (!AkComponent->HasActiveEvents())
+	{
+		return ReleaseAkComponent(AkComponent);
+	}
+
+	FAkComponentPool* pool = m_worldPools.Find(AkComponent->GetWorld());
+
+	if (pool == nullptr)
+	{
+		AkComponent->DestroyComponent();
+		return;
+	}
+
+	// keep playing at the last position of the destroyed emitter
+	AkComponent->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	AkComponent->OnAllEventsEnded.BindUObject(this, &UAkComponentPoolManager::OnDrainingAkComponentEnded);
+	pool->Draining.Add(AkComponent);
+}
+
+UAkComponent* UAkComponentPoolManager::CreateAkComponent(UWorld* World)
+{
+	static const FName pooledAkComponentName{ TEXT("PooledAkComponent") };
+	UAkComponent* akComponent = NewObject<UAkComponent>(World, MakeUniqueObjectName(World, UAkComponent::StaticClass(), pooledAkComponentName));
+	check(akComponent);
+
+	akComponent->SetAutoDestroy(false);
+	akComponent->RegisterComponentWithWorld(World);
+
+#if !UE_BUILD_SHIPPING
+	m_dbgNumCreated++;
+#endif
+
+	return akComponent;
+}
+
+void UAkComponentPoolManager::ResetAkComponent(UAkComponent* AkComponent, const USceneComponent* AttachParent)
+{
+	// re-registering resets all game syncs, listeners and game object settings
+	RegisterWithOwnerName(AkComponent, AttachParent);
+	AkComponent->OnReregisteredWithWwise();
+}
+
+void UAkComponentPoolManager::RegisterWithOwnerName(UAkComponent* AkComponent, const USceneComponent* AttachParent)
+{
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	if (!AkAudioDevice) { return; }
+
+	FString gameObjectName{};
+
+	if (const AActor* owner = AttachParent->GetOwner())
+	{
+#if WITH_EDITOR
+		gameObjectName = owner->GetActorLabel() + TEXT(".");
+#else
+		gameObjectName = owner->GetName() + TEXT(".");
+#endif
+	}
+
+	gameObjectName += AttachParent->GetName();
+
+	// the only way to rename the game object in the profiler
+	const AkGameObjectID gameObjectID = AkComponent->GetAkGameObjectID();
+	AkAudioDevice->UnregisterComponent(AkComponent);
+	AkAudioDevice->RegisterGameObject(gameObjectID, gameObjectName);
+
+	if (FAkComponentCallbackManager* callbackManager = AkAudioDevice->GetCallbackManager())
+	{
+		callbackManager->RegisterGameObject(gameObjectID);
+	}
+
+	AkComponent->SetUseDefaultListeners(true);
+	AkComponent->UpdateGameObjectPosition();
+}
+
+void UAkComponentPoolManager::ReturnToPool(UAkComponent* AkComponent, FAkComponentPool& Pool)
+{
+	if (AkComponent->OnAllEventsEnded.IsBound())
+	{
+		AkComponent->OnAllEventsEnded.Unbind();
+	}
+
+	if (Pool.Available.Num() >= m_maxPoolSize)
+	{
+		AkComponent->DestroyComponent();
+		return;
+	}
+
+	AkComponent->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	Pool.Available.Add(AkComponent);
+}
+
+void UAkComponentPoolManager::OnDrainingAkComponentEnded(const UAkComponent* AkComponent)
+{
+	FAkComponentPool* pool = m_worldPools.Find(AkComponent->GetWorld());
+	if (pool == nullptr) { return; }
+
+	const int32 index = pool->Draining.Find(const_cast<UAkComponent*>(AkComponent));
+
+	if (index != INDEX_NONE)
+	{
+		UAkComponent* akComponent = pool->Draining[index];
+		pool->Draining.RemoveAtSwap(index);
+		ReturnToPool(akComponent, *pool);
+	}
+}
+
+void UAkComponentPoolManager::OnWorldInitializedActors(const UWorld::FActorsInitializedParams& Params)
+{
+	UWorld* world = Params.World;
+
+	if (!IsValid(world) || !world->IsGameWorld() || world->GetNetMode() == ENetMode::NM_DedicatedServer || GetWorld() != world)
+	{
+		return;
+	}
+
+	FAkComponentPool& pool = m_worldPools.FindOrAdd(world);
+
+	while (pool.Available.Num() < m_prewarmSize)
+	{
+		pool.Available.Add(CreateAkComponent(world));
+	}
+
+	if (Private_AkComponentPoolManager::bDebugConsole)
+	{
+		WR_DBG_FUNC(Log, "prewarmed %i AkComponents in %s", pool.Available.Num(), *world->GetName());
+	}
+}
+
+void UAkComponentPoolManager::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	FAkComponentPool* pool = m_worldPools.Find(World);
+	if (pool == nullptr) { return; }
+
+	for (UAkComponent* akComponent : pool->Available)
+	{
+		if (IsValid(akComponent)) { akComponent->DestroyComponent(); }
+	}
+
+	for (UAkComponent* akComponent : pool->Draining)
+	{
+		if (IsValid(akComponent)) { akComponent->DestroyComponent(); }
+	}
+
+#if !UE_BUILD_SHIPPING
+	if (Private_AkComponentPoolManager::bDebugConsole)
+	{
+		WR_DBG_FUNC(Log, "%s: %i AkComponents created, %i reused", *GetNameSafe(World), m_dbgNumCreated, m_dbgNumReused);
+	}
+
+	m_dbgNumCreated = 0;
+	m_dbgNumReused = 0;
+#endif
+
+	m_worldPools.Remove(World);
+}
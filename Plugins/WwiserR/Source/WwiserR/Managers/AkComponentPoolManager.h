@@ -0,0 +1,72 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Engine/World.h"
+#include "AkComponentPoolManager.generated.h"
+
+class UAkComponent;
+
+// pooled AkComponents within one world
+USTRUCT()
+struct WWISERR_API FAkComponentPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TArray<UAkComponent*> Available{};	// registered, detached and idle
+	UPROPERTY() TArray<UAkComponent*> Draining{};	// released by destroyed emitters, returned to the pool when all their events ended
+};
+
+/**
+ * AkComponentPoolManager
+ * ----------------------
+ *
+ * - per world pool of pre-registered AkComponents, handed out to sound emitters instead of creating and registering a new AkComponent each
+ *   time an emitter becomes audible
+ * - reused AkComponents are re-registered with Wwise, which resets their game syncs and listeners, under the name of the emitter's owning
+ *   actor so they can still be identified in the Wwise profiler. Their cached room and reverb sends are reset and sent again.
+ * - opt-in (bUseAkComponentPool in the WwiserR project settings)
+ * - prewarmed to a configurable size when the actors of a game world are initialized, to avoid first-use spikes
+ */
+UCLASS(ClassGroup = "WwiserR")
+class WWISERR_API UAkComponentPoolManager : public UObject
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY() TMap<UWorld*, FAkComponentPool> m_worldPools{};
+
+	int32 m_prewarmSize = 0;
+	int32 m_maxPoolSize = 0;
+
+#if !UE_BUILD_SHIPPING
+	uint32 m_dbgNumCreated = 0;
+	uint32 m_dbgNumReused = 0;
+#endif
+
+public:
+	void Initialize();
+	void Deinitialize();
+
+	/** hands out a registered AkComponent attached to AttachParent, named after AttachParent and its owner */
+	UAkComponent* AcquireAkComponent(USceneComponent* AttachParent);
+
+	/** stops and detaches AkComponent, and returns it to the pool of its world */
+	void ReleaseAkComponent(UAkComponent* AkComponent);
+
+	/** detaches AkComponent but lets its events play out, before returning it to the pool */
+	void ReleaseAkComponentWhenDone(UAkComponent* AkComponent);
+
+protected:
+	UAkComponent* CreateAkComponent(UWorld* World);
+	void ResetAkComponent(UAkComponent* AkComponent, const USceneComponent* AttachParent);
+	/** re-registers the game object as <owner>.<AttachParent>, the name it had before pooling */
+	void RegisterWithOwnerName(UAkComponent* AkComponent, const USceneComponent* AttachParent);
+	void ReturnToPool(UAkComponent* AkComponent, FAkComponentPool& Pool);
+	void OnDrainingAkComponentEnded(const UAkComponent* AkComponent);
+
+	void OnWorldInitializedActors(const UWorld::FActorsInitializedParams& Params);
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+};
@@ -3,6 +3,7 @@
 
 #include "Managers/AmbientBedManager.h"
 #include "Managers/SoundListenerManager.h"
+#include "Managers/AmbientWeightField.h"
 #include "DataAssets/DA_AmbientBed.h"
 #include "Core/AudioSubsystem.h"
 #include "Core/AudioUtils.h"
@@ -11,8 +12,27 @@
 #include "AkAudioDevice.h"
 #include "AkComponent.h"
 #include "AkRoomComponent.h"
+#include "AkAcousticPortal.h"
 #include "AkAudioEvent.h"
 #include "AkAuxBus.h"
+#include "Algo/Sort.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreaming.h"
+#include "Async/ParallelFor.h"
+
+#if !UE_BUILD_SHIPPING
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Async/TaskGraphInterfaces.h"
+#endif
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ambient Weight Registrations Applied"), STAT_WwiserR_AmbientWeightRegistrationsApplied, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ambient Weight Registrations Pending"), STAT_WwiserR_AmbientWeightRegistrationsPending, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ambient Weight Room Queries"), STAT_WwiserR_AmbientWeightRoomQueries, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ambient Weight Room Queries Saved"), STAT_WwiserR_AmbientWeightRoomQueriesSaved, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ambient Bed Sound Engine Calls Saved"), STAT_WwiserR_AmbientBedSoundEngineCallsSaved, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ambient Bed Groups Updated"), STAT_WwiserR_AmbientBedGroupsUpdated, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ambient Bed Groups Skipped"), STAT_WwiserR_AmbientBedGroupsSkipped, STATGROUP_WwiserR);
 
 namespace Private_AmbientBeds
 {
@@ -30,6 +50,15 @@ namespace Private_AmbientBeds
 	bool bViewPortStats = false;
 	bool bConsoleStats = false;
 
+	// in-range weights per aggregation task
+	static constexpr int32 AggregationChunkSize = 256;
+
+	// values at the ends of their range are always sent, so beds fade out completely and crossfades end exactly
+	static bool ShouldSendValue(float Value, float SentValue, float Epsilon, float MinValue, float MaxValue)
+	{
+		return FMath::Abs(Value - SentValue) > Epsilon || (Value != SentValue && (Value <= MinValue || Value >= MaxValue));
+	}
+
 	static void OnAmbientSoundWeightManager()
 	{
 		bDebugDrawSpatialization = CVar_AmbientSoundWeight_DebugDrawSpatialization.GetValueOnGameThread();
@@ -41,6 +70,108 @@ namespace Private_AmbientBeds
 	FAutoConsoleVariableSink CStaticAmbientBedsConsoleSink(FConsoleCommandDelegate::CreateStatic(&OnAmbientSoundWeightManager));
 } // Private_AmbientBeds
 
+namespace Private_AmbientBeds
+{
+	/** accumulates the work items in chunks of AggregationChunkSize, each into its own accumulator. Returns the number of chunks */
+	template<typename TFindRoom>
+	static int32 AggregateWeights(TConstArrayView<FAmbientWeightWorkItem> WorkItems, TArray<FAmbientBedAccumulator>& Accumulators,
+		TFindRoom&& FindRoom)
+	{
+		const int32 numChunks = FMath::DivideAndRoundUp(WorkItems.Num(), AggregationChunkSize);
+		if (Accumulators.Num() < numChunks) { Accumulators.SetNum(numChunks); }
+
+		ParallelFor(numChunks, [&](int32 ChunkIndex)
+			{
+				FAmbientBedAccumulator& accumulator = Accumulators[ChunkIndex];
+				accumulator.Reset();
+
+				const int32 lastItem = FMath::Min(WorkItems.Num(), (ChunkIndex + 1) * AggregationChunkSize);
+
+				for (int32 i = ChunkIndex * AggregationChunkSize; i < lastItem; i++)
+				{
+					const FAmbientWeightWorkItem& workItem = WorkItems[i];
+
+					if (UAkRoomComponent* room = FindRoom(workItem, accumulator))
+					{
+						accumulator.Add(workItem.GroupIndex, room, workItem.WeightedRelativePosition, workItem.Weight, workItem.NumWeights);
+					}
+				}
+			});
+
+		return numChunks;
+	}
+
+	/** sums the partial sums of all accumulators per bed group and room, in accumulator order */
+	static void MergeAccumulators(TConstArrayView<FAmbientBedAccumulator> Accumulators, int32 NumGroups,
+		TArray<TMap<UAkRoomComponent*, FAmbientBedPartialSum>>& OutGroupSums)
+	{
+		if (OutGroupSums.Num() < NumGroups) { OutGroupSums.SetNum(NumGroups); }
+
+		for (int32 groupIndex = 0; groupIndex < NumGroups; groupIndex++)
+		{
+			OutGroupSums[groupIndex].Reset();
+		}
+
+		for (const FAmbientBedAccumulator& accumulator : Accumulators)
+		{
+			for (const FAmbientBedPartialSum& partialSum : accumulator.PartialSums)
+			{
+				FAmbientBedPartialSum& groupSum = OutGroupSums[partialSum.GroupIndex].FindOrAdd(partialSum.Room);
+				groupSum.GroupIndex = partialSum.GroupIndex;
+				groupSum.Room = partialSum.Room;
+				groupSum.Add(partialSum);
+			}
+		}
+	}
+} // Private_AmbientBeds
+
+#pragma region FAmbientBedAccumulator
+void FAmbientBedPartialSum::Add(const FAmbientBedPartialSum& Other)
+{
+	LocalPosition += Other.LocalPosition;
+	WeightedDistance += Other.WeightedDistance;
+	SummedWeight += Other.SummedWeight;
+	NumWeights += Other.NumWeights;
+}
+
+void FAmbientBedAccumulator::Reset()
+{
+	PartialSums.Reset();
+	NumRoomQueries = 0;
+	NumRoomQueriesSaved = 0;
+}
+
+void FAmbientBedAccumulator::Add(int32 GroupIndex, UAkRoomComponent* Room, const FVector& WeightedRelativePosition, float Weight,
+	uint32 NumWeights)
+{
+	// work items are sorted by group and spatially coherent, so the last partial sum is the likely match
+	FAmbientBedPartialSum* partialSum = nullptr;
+
+	for (int32 i = PartialSums.Num() - 1; i >= 0; i--)
+	{
+		if (PartialSums[i].GroupIndex == GroupIndex && PartialSums[i].Room == Room)
+		{
+			partialSum = &PartialSums[i];
+			break;
+		}
+
+		if (PartialSums[i].GroupIndex != GroupIndex) { break; }
+	}
+
+	if (!partialSum)
+	{
+		partialSum = &PartialSums.AddDefaulted_GetRef();
+		partialSum->GroupIndex = GroupIndex;
+		partialSum->Room = Room;
+	}
+
+	partialSum->LocalPosition += WeightedRelativePosition;
+	partialSum->WeightedDistance += WeightedRelativePosition.Length();
+	partialSum->SummedWeight += Weight;
+	partialSum->NumWeights += NumWeights;
+}
+#pragma endregion
+
 #pragma region TAmbientWeightOctree
 FAmbientWeightOctreeElement::FAmbientWeightOctreeElement(UAmbientBedWeightComponent* a_AmbientSoundWeightComponent)
 	: AmbientSoundWeightComponent(a_AmbientSoundWeightComponent)
@@ -64,6 +195,25 @@ void TAmbientWeightOctree::AddWeight(UAmbientBedWeightComponent* AmbientSoundWei
 #endif
 }
 
+void TAmbientWeightOctree::AddWeights(TConstArrayView<UAmbientBedWeightComponent*> AmbientSoundWeightComponents)
+{
+	if (AmbientSoundWeightComponents.IsEmpty()) { return; }
+
+	// TOctree2 has no bulk build, the batch is inserted as is with a presized id map
+	ObjectToOctreeId.Reserve(ObjectToOctreeId.Num() + AmbientSoundWeightComponents.Num());
+
+	for (UAmbientBedWeightComponent* ambientSoundWeightComponent : AmbientSoundWeightComponents)
+	{
+		AddElement(FAmbientWeightOctreeElement{ ambientSoundWeightComponent });
+	}
+
+	NumElements += AmbientSoundWeightComponents.Num();
+
+#if !UE_BUILD_SHIPPING
+	DebugConsoleStats(AmbientSoundWeightComponents.Last());
+#endif
+}
+
 void TAmbientWeightOctree::RemoveWeight(UAmbientBedWeightComponent* AmbientSoundWeightComponent)
 {
 	const FOctreeElementId2 elementID = ObjectToOctreeId[AmbientSoundWeightComponent->GetUniqueID()];
@@ -77,6 +227,19 @@ void TAmbientWeightOctree::RemoveWeight(UAmbientBedWeightComponent* AmbientSound
 #endif
 }
 
+void TAmbientWeightOctree::UpdateWeight(UAmbientBedWeightComponent* AmbientSoundWeightComponent)
+{
+	const FOctreeElementId2* elementID = ObjectToOctreeId.Find(AmbientSoundWeightComponent->GetUniqueID());
+	if (!elementID || !IsValidElementId(*elementID)
+		|| GetElementById(*elementID).AmbientSoundWeightComponent != AmbientSoundWeightComponent)
+	{
+		return;
+	}
+
+	RemoveElement(*elementID);
+	AddElement(FAmbientWeightOctreeElement{ AmbientSoundWeightComponent });
+}
+
 void TAmbientWeightOctree::DebugConsoleStats(UAmbientBedWeightComponent* AmbientSoundWeightComponent) const
 {
 	if (!Private_AmbientBeds::bConsoleStats) { return; }
@@ -165,6 +328,12 @@ void UAmbientBedEmitterComponent::StartPlay(UDA_AmbientBed* AmbientBed)
 	m_isInListenerRoom = IsInListenerRoom();
 	m_FadePos = m_isInListenerRoom ? 0.f : 1.f;
 	m_isCrossfading = false;
+	m_sentDistanceRtpc = -1.f;
+	m_sentWeightRtpc = -1.f;
+	// the first values are sent right away
+	m_timeSinceRtpcUpdate = FLT_MAX;
+	m_timeSinceAuxSendUpdate = FLT_MAX;
+	m_lastUpdateTime = GetWorld()->GetTimeSeconds();
 
 	SetEmitterListenerRelations();
 
@@ -185,7 +354,15 @@ void UAmbientBedEmitterComponent::Stop()
 	}
 }
 
-void UAmbientBedEmitterComponent::AccumulatePositionAndDistance(UDA_AmbientBed* AmbientBed)
+void UAmbientBedEmitterComponent::AddPartialSum(const FAmbientBedPartialSum& PartialSum)
+{
+	m_localPosition += PartialSum.LocalPosition;
+	m_avgWeightedDistance += PartialSum.WeightedDistance;
+	m_summedWeight += PartialSum.SummedWeight;
+	m_numWeights += PartialSum.NumWeights;
+}
+
+int32 UAmbientBedEmitterComponent::AccumulatePositionAndDistance(UDA_AmbientBed* AmbientBed)
 {
 	WR_ASSERT(IsValid(m_ambientEmitter), "!IsValid(m_ambientAkComp)")
 
@@ -203,15 +380,53 @@ void UAmbientBedEmitterComponent::AccumulatePositionAndDistance(UDA_AmbientBed*
 	const float weightRtpcValue = FMath::Clamp(accumWeight * (100.f + m_avgWeightedDistance),
 		0.f, FMath::Min(100.f, m_maxAccumWeight * 100.f));
 
+	// Rtpcs and aux sends are rate limited, Rtpcs interpolate over the time to the next update (at least a frame), except their first value
+	const double time = GetWorld()->GetTimeSeconds();
+	const float deltaTime = (float)(time - m_lastUpdateTime);
+	m_lastUpdateTime = time;
+
+	const float updateInterval = AmbientBed->MaxUpdateRate > 0.f ? 1.f / AmbientBed->MaxUpdateRate : 0.f;
+	const int32 interpolationTimeMs = FMath::RoundToInt(FMath::Max(updateInterval, deltaTime) * 1000.f);
+	int32 numCallsSaved = 0;
+
+	m_timeSinceRtpcUpdate += deltaTime;
+	const bool bCanUpdateRtpcs = m_timeSinceRtpcUpdate >= updateInterval;
+	bool bRtpcsUpdated = false;
 
 	if (IsValid(m_distanceRtpc))
 	{
-		m_ambientEmitter->SetRTPCValue(m_distanceRtpc, m_avgWeightedDistance, 0, FString());
+		if (bCanUpdateRtpcs
+			&& Private_AmbientBeds::ShouldSendValue(m_avgWeightedDistance, m_sentDistanceRtpc, AmbientBed->RtpcEpsilon, 0.f, 100.f))
+		{
+			m_ambientEmitter->SetRTPCValue(m_distanceRtpc, m_avgWeightedDistance, m_sentDistanceRtpc < 0.f ? 0 : interpolationTimeMs,
+				FString());
+			m_sentDistanceRtpc = m_avgWeightedDistance;
+			bRtpcsUpdated = true;
+		}
+		else
+		{
+			numCallsSaved++;
+		}
 	}
 
 	if (IsValid(m_weightRtpc))
 	{
-		m_ambientEmitter->SetRTPCValue(m_weightRtpc, weightRtpcValue, 0, FString());
+		if (bCanUpdateRtpcs
+			&& Private_AmbientBeds::ShouldSendValue(weightRtpcValue, m_sentWeightRtpc, AmbientBed->RtpcEpsilon, 0.f, 100.f))
+		{
+			m_ambientEmitter->SetRTPCValue(m_weightRtpc, weightRtpcValue, m_sentWeightRtpc < 0.f ? 0 : interpolationTimeMs, FString());
+			m_sentWeightRtpc = weightRtpcValue;
+			bRtpcsUpdated = true;
+		}
+		else
+		{
+			numCallsSaved++;
+		}
+	}
+
+	if (bRtpcsUpdated)
+	{
+		m_timeSinceRtpcUpdate = 0.f;
 	}
 
 	if (m_isInListenerRoom != IsInListenerRoom())
@@ -231,7 +446,7 @@ void UAmbientBedEmitterComponent::AccumulatePositionAndDistance(UDA_AmbientBed*
 		{
 			if (m_isInListenerRoom)
 			{
-				m_FadePos -= GetWorld()->DeltaTimeSeconds / AmbientBed->PortalCrossfadeTime;
+				m_FadePos -= deltaTime / AmbientBed->PortalCrossfadeTime;
 				if (m_FadePos <= 0.f)
 				{
 					m_isCrossfading = false;
@@ -239,29 +454,40 @@ void UAmbientBedEmitterComponent::AccumulatePositionAndDistance(UDA_AmbientBed*
 			}
 			else
 			{
-				m_FadePos += GetWorld()->DeltaTimeSeconds / AmbientBed->PortalCrossfadeTime;
+				m_FadePos += deltaTime / AmbientBed->PortalCrossfadeTime;
 				if (m_FadePos >= 1.f)
 				{
 					m_isCrossfading = false;
 				}
 			}
 		}
-		
-		SetEmitterListenerRelations();
+
+		m_FadePos = FMath::Clamp(m_FadePos, 0.f, 1.f);
+		m_timeSinceAuxSendUpdate += deltaTime;
+
+		// the end of a crossfade is never rate limited
+		if ((!m_isCrossfading || m_timeSinceAuxSendUpdate >= updateInterval)
+			&& Private_AmbientBeds::ShouldSendValue(m_FadePos, m_sentFadePos, AmbientBed->AuxSendEpsilon, 0.f, 1.f))
+		{
+			SetEmitterListenerRelations();
+			m_timeSinceAuxSendUpdate = 0.f;
+		}
+		else
+		{
+			numCallsSaved++;
+		}
 	}
 
 #if !UE_BUILD_SHIPPING
-	{
-		FScopeLock Lock(&AAmbientBedWorldManager::s_critSectDbgValues);
-		AAmbientBedWorldManager::s_dbgViewportValues.Add(this,
-			FDebugValues(m_avgWeightedDistance, weightRtpcValue, m_summedWeight));
-	}
+	AAmbientBedWorldManager::s_dbgViewportValues.Add(this, FDebugValues(m_avgWeightedDistance, weightRtpcValue, m_summedWeight));
 #endif
 
 	m_localPosition = FVector();
 	m_avgWeightedDistance = 0.f;
 	m_summedWeight = 0.f;
 	m_numWeights = 0;
+
+	return numCallsSaved;
 }
 
 void UAmbientBedEmitterComponent::SetEmitterListenerRelations()
@@ -283,6 +509,7 @@ void UAmbientBedEmitterComponent::SetEmitterListenerRelations()
 	pAuxSendValues[1].fControlValue = 1.f - m_FadePos; // UAudioUtils::LogaritmicInterpolation(1.f - m_FadePos);
 		
 	SoundEngine->SetGameObjectAuxSendValues(m_emitterId, pAuxSendValues, 2);
+	m_sentFadePos = m_FadePos;
 	//SoundEngine->SetGameObjectOutputBusVolume(m_emitterId, m_listenerId, 1.f - m_FadePos);
 }
 
@@ -299,13 +526,35 @@ UAmbientBedWeightComponent::UAmbientBedWeightComponent()
 	PrimaryComponentTick.bCanEverTick = false;
 	PrimaryComponentTick.bAllowTickOnDedicatedServer = false;
 	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	// moved weights are reinserted in the octree
+	bWantsOnUpdateTransform = true;
+}
+
+bool UAmbientBedWeightComponent::IsBakedIntoWeightField() const
+{
+	if (!bBakeIntoWeightField || !GetDefault<UWwiserRGameSettings>()->bUseBakedAmbientWeightFields) { return false; }
+
+	const ULevel* level = GetComponentLevel();
+	const UAmbientWeightFieldDatabase* database = IsValid(level) ? level->GetAssetUserData<UAmbientWeightFieldDatabase>() : nullptr;
+
+	return database != nullptr && database->ContainsWeight(this);
+}
+
+bool UAmbientBedWeightComponent::IsEditorOnly() const
+{
+	// cooked levels only keep the baked weight field
+	return IsBakedIntoWeightField() || Super::IsEditorOnly();
 }
 
 void UAmbientBedWeightComponent::BeginPlay()
 {
 	Super::BeginPlay();
-	
-	if (IsValid(AmbientBed) && IsValid(AmbientBed->LoopEvent))
+
+	// in editor worlds, weights unchanged since the level was saved are sampled from the baked weight field
+	m_isBaked = IsBakedIntoWeightField();
+
+	if (!m_isBaked && IsValid(AmbientBed) && IsValid(AmbientBed->LoopEvent))
 	{
 		UWorld* world = GetWorld();
 
@@ -322,7 +571,7 @@ void UAmbientBedWeightComponent::BeginPlay()
 
 void UAmbientBedWeightComponent::EndPlay(EEndPlayReason::Type EndPlayReason)
 {
-	if (EndPlayReason == EEndPlayReason::RemovedFromWorld 
+	if (EndPlayReason == EEndPlayReason::RemovedFromWorld && !m_isBaked
 		&& IsValid(AmbientBed) && IsValid(AmbientBed->LoopEvent))
 	{
 		UWorld* world = GetWorld();
@@ -336,8 +585,24 @@ void UAmbientBedWeightComponent::EndPlay(EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 }
 
+void UAmbientBedWeightComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+
+	if (!m_isInWeightOctree || !HasBegunPlay()) { return; }
+
+	UWorld* world = GetWorld();
+
+	if (UAmbientBedManager* ambientSoundManager = UAudioSubsystem::Get(world)->GetAmbientSoundManager())
+	{
+		ambientSoundManager->UpdateWeightLocation(world, this, AmbientBed);
+	}
+}
+
 void UAmbientBedWeightComponent::SetWeight(float NewWeight)
 {
+	if (m_isBaked) { return; }
+
 	Weight = NewWeight;
 
 	if (m_isInWeightOctree && Weight <= 0.f)
@@ -377,6 +642,22 @@ void AAmbientBedWorldManager::Initialize(USoundListenerManager* SoundListenerMan
 	m_listenerManager = SoundListenerManager;
 	FAmbientBedGroup::s_colorSeed = WEIGHTCOLORSTARTSEED;
 
+	const UWwiserRGameSettings* audioConfig = GetDefault<UWwiserRGameSettings>();
+	m_batchRegistration = audioConfig->bBatchEmitterRegistration;
+	m_registrationBudgetMs = audioConfig->EmitterRegistrationBudgetMs;
+	m_useLOD = audioConfig->bUseAmbientBedLOD;
+	m_adjacentRoomUpdateInterval = 1.f / FMath::Max(audioConfig->AdjacentRoomAmbientBedUpdateRate, 1.f);
+	m_distantMovementThresholdSquared = FMath::Square(audioConfig->DistantAmbientBedMovementThreshold);
+	m_roomListenerRotationEpsilon = FMath::DegreesToRadians(audioConfig->AmbientRoomListenerRotationEpsilon);
+	m_roomListenerRotation = FQuat::Identity;
+	m_adjacentRoomsDirty = true;
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddUObject(this, &AAmbientBedWorldManager::OnPreGarbageCollect);
+
+	if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
+	{
+		m_onRoomIndexChangedHandle = AkAudioDevice->OnRoomIndexChanged.AddUObject(this, &AAmbientBedWorldManager::OnRoomIndexChanged);
+	}
+
 #if !UE_BUILD_SHIPPING
 	s_dbgViewportValues.Empty();
 #endif
@@ -384,6 +665,22 @@ void AAmbientBedWorldManager::Initialize(USoundListenerManager* SoundListenerMan
 
 void AAmbientBedWorldManager::Deinitialize()
 {
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().RemoveAll(this);
+
+	if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
+	{
+		AkAudioDevice->OnRoomIndexChanged.Remove(m_onRoomIndexChangedHandle);
+	}
+
+	m_onRoomIndexChangedHandle.Reset();
+	m_pendingRegistrations.Empty();
+	m_registrationBatch.Empty();
+	m_weightsToAdd.Empty();
+	m_bakedLevels.Empty();
+	m_weightFields.Empty();
+	m_groupLODs.Empty();
+	m_adjacentRoomIDs.Empty();
+
 	m_listenerManager = nullptr;
 }
 
@@ -396,6 +693,8 @@ void AAmbientBedWorldManager::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	ApplyPendingRegistrations(false);
+
 	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
 	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
 	if (UNLIKELY(!AkAudioDevice || !SoundEngine)) { return; }
@@ -414,95 +713,203 @@ void AAmbientBedWorldManager::Tick(float DeltaTime)
 	const FVector listenerPosition = spatialListener->GetComponentLocation();
 	const FVector distanceProbePosition = m_listenerManager->GetDistanceProbePosition();
 
-	// prepare weight components array for efficient parallel access
-	TArray<TPair<FAmbientBedGroup, TSharedPtr<TAmbientWeightOctree>>> m_weightCompsArray;
-	m_weightCompsArray.Reserve(m_weightComps.Num());
+	// prepare bed groups for efficient parallel access
+	m_weightGroups.Reset(m_weightComps.Num() + m_weightFields.Num());
 	for (const auto& weightComp : m_weightComps)
 	{
-		m_weightCompsArray.Emplace(weightComp);
+		m_weightGroups.Emplace(weightComp);
 	}
 
-	TSet<TPair<UAkRoomComponent*, FAmbientBedGroup&>> emittersToCreate;
-	TSet<FAmbientBedGroup*> bedGroupsToKeep;
-	FCriticalSection critSectEmittersToCreate;
+	for (const auto& weightField : m_weightFields)
+	{
+		if (!m_weightComps.Contains(weightField.Key))
+		{
+			m_weightGroups.Emplace(weightField.Key, nullptr);
+		}
+	}
+
+	// skip the bed groups that don't need an update this tick, their emitters keep playing as they are
+	const AkRoomID listenerRoomID = spatialListener->GetSpatialAudioRoomID();
 
-	// process weight components in parallel
-	ParallelFor(m_weightCompsArray.Num(), [&](int32 Index)
+	if (m_adjacentRoomsDirty || listenerRoomID != m_listenerRoomID)
+	{
+		UpdateAdjacentRooms(listenerRoomID);
+	}
+
+	const int32 numGroupsTotal = m_weightGroups.Num();
+	const double time = world->GetTimeSeconds();
+
+	m_weightGroups.RemoveAll([&](const TPair<FAmbientBedGroup, TSharedPtr<TAmbientWeightOctree>>& WeightGroup)
 		{
-			auto& pair = m_weightCompsArray[Index];
-			FAmbientBedGroup& bedGroup = pair.Key;
-			const TSharedPtr<TAmbientWeightOctree> weightOctree = pair.Value;
+			const UDA_AmbientBed* ambientBed = WeightGroup.Key.AmbientBed;
+			return !ShouldUpdateGroup(WeightGroup.Key,
+				FMath::Lerp(distanceProbePosition, listenerPosition, ambientBed->ReferencePositionLerp), listenerPosition, time);
+		});
+
+	m_numGroupsUpdated = m_weightGroups.Num();
+	m_numGroupsSkipped = numGroupsTotal - m_numGroupsUpdated;
+	SET_DWORD_STAT(STAT_WwiserR_AmbientBedGroupsUpdated, m_numGroupsUpdated);
+	SET_DWORD_STAT(STAT_WwiserR_AmbientBedGroupsSkipped, m_numGroupsSkipped);
+
+	const int32 numGroups = m_weightGroups.Num();
+	if (m_groupWorkItems.Num() < numGroups) { m_groupWorkItems.SetNum(numGroups); }
 
-			UDA_AmbientBed* ambientBed = bedGroup.AmbientBed;
+	// 1. gather the in-range weights of each bed group
+	ParallelFor(numGroups, [&](int32 GroupIndex)
+		{
+			const FAmbientBedGroup& bedGroup = m_weightGroups[GroupIndex].Key;
+			const UDA_AmbientBed* ambientBed = bedGroup.AmbientBed;
 			const float range = ambientBed->Range;
 			const float rangeSquared = range * range;
-			const float posLerp = ambientBed->ReferencePositionLerp;
-			const FVector referencePosition = FMath::Lerp(distanceProbePosition, listenerPosition, posLerp);
-
+			const FVector referencePosition = FMath::Lerp(distanceProbePosition, listenerPosition, ambientBed->ReferencePositionLerp);
 			const FBox searchBox(referencePosition - FVector(range), referencePosition + FVector(range));
-			TSet<UAkRoomComponent*> foundRooms;
 
-			weightOctree->FindElementsWithBoundsTest(FBoxCenterAndExtent(searchBox),
-				[&](const FAmbientWeightOctreeElement& WeightElement)
-				{
-					const float distanceToListenerSquared = FVector::DistSquared(referencePosition, WeightElement.BoundingBox.Center);
-					if (distanceToListenerSquared > rangeSquared) { return; }
+			TArray<FAmbientWeightWorkItem>& workItems = m_groupWorkItems[GroupIndex];
+			workItems.Reset();
 
-					// initialize ambient emitter if not present
+			if (const TSharedPtr<TAmbientWeightOctree>& weightOctree = m_weightGroups[GroupIndex].Value)
+			{
+				weightOctree->FindElementsWithBoundsTest(FBoxCenterAndExtent(searchBox),
+					[&](const FAmbientWeightOctreeElement& WeightElement)
 					{
-						FScopeLock Lock(&m_critSectAmbientEmitters);
-						if (!m_playingAmbientBedEmitters.Contains(bedGroup))
-						{
-							{
-								m_playingAmbientBedEmitters.Emplace(bedGroup, TMap<UAkRoomComponent*, UAmbientBedEmitterComponent*>());
-							}
-						}
-					}
+						if (FVector::DistSquared(referencePosition, WeightElement.BoundingBox.Center) > rangeSquared) { return; }
+
+						FAmbientWeightWorkItem& workItem = workItems.AddDefaulted_GetRef();
+						workItem.WeightElement = &WeightElement;
+						workItem.RoomCache = &WeightElement.RoomCache;
+						workItem.Location = WeightElement.BoundingBox.Center;
+						workItem.Weight = WeightElement.AmbientSoundWeightComponent->Weight;
+						workItem.WeightedRelativePosition = workItem.Weight * (workItem.Location - listenerPosition) / range;
+						workItem.GroupIndex = GroupIndex;
+					});
+			}
 
-					// find room components at location and create ambient emitter if necessary
-					TArray<UAkRoomComponent*> roomComps = AkAudioDevice->FindRoomComponentsAtLocation(WeightElement.BoundingBox.Center, world);
-					if (roomComps.IsEmpty()) { return; }
-					UAkRoomComponent* roomComp = roomComps[0];
-					foundRooms.Emplace(roomComp);
-					
-					if (!m_playingAmbientBedEmitters[bedGroup].Contains(roomComp))
-					{
-						FScopeLock Lock(&critSectEmittersToCreate);
-						emittersToCreate.FindOrAdd(
-							TPair<UAkRoomComponent*, FAmbientBedGroup&>(roomComp, bedGroup));
-						bedGroupsToKeep.FindOrAdd(&bedGroup);
-					}
-					else
-					{
-						UpdateEmitterPosition(bedGroup, roomComp, WeightElement, listenerPosition, range);
-					}
+			// baked cells of the loaded levels
+			if (const TArray<TSharedPtr<FAmbientWeightField>>* weightFields = m_weightFields.Find(bedGroup))
+			{
+				for (const TSharedPtr<FAmbientWeightField>& weightField : *weightFields)
+				{
+					weightField->GatherCells(referencePosition, listenerPosition, range, GroupIndex, workItems);
+				}
+			}
+		});
 
-#if !UE_BUILD_SHIPPING
-					if (Private_AmbientBeds::bDebugDrawWeights)
-					{
-						FScopeLock Lock(&m_critSectDbgWeightComps);
-						m_dbgWeightComps.Add(WeightElement.AmbientSoundWeightComponent, &bedGroup);
-					}
-#endif
-				});
+	m_workItems.Reset();
+	for (int32 groupIndex = 0; groupIndex < numGroups; groupIndex++)
+	{
+		m_workItems.Append(m_groupWorkItems[groupIndex]);
+	}
 
-			CleanupUnusedEmitters(bedGroup, foundRooms, bedGroupsToKeep);
+	// 2. accumulate per (bed group, room) partial sums in equally sized chunks of weights, without any shared state
+	const uint32 roomIndexSerial = m_roomIndexSerial;
+
+	const int32 numChunks = Private_AmbientBeds::AggregateWeights(m_workItems, m_accumulators,
+		[AkAudioDevice, world, roomIndexSerial](const FAmbientWeightWorkItem& WorkItem, FAmbientBedAccumulator& Accumulator)
+		{
+			// the room at the weight's location is cached until a room is (re/un)indexed or the weight moved
+			FAmbientWeightRoomCache& roomCache = *WorkItem.RoomCache;
+
+			if (roomCache.Serial != roomIndexSerial)
+			{
+				const TArray<UAkRoomComponent*> roomComps = AkAudioDevice->FindRoomComponentsAtLocation(WorkItem.Location, world);
+
+				roomCache.Room = roomComps.IsEmpty() ? nullptr : roomComps[0];
+				roomCache.Serial = roomIndexSerial;
+				Accumulator.NumRoomQueries++;
+			}
+			else
+			{
+				Accumulator.NumRoomQueriesSaved++;
+			}
+
+			return roomCache.Room;
 		});
 
-	for (auto& emitter : emittersToCreate)
+	// 3. deterministic reduction, in chunk order
+	Private_AmbientBeds::MergeAccumulators(MakeArrayView(m_accumulators.GetData(), numChunks), numGroups, m_groupSums);
+
+	m_numRoomQueries = 0;
+	m_numRoomQueriesSaved = 0;
+
+	for (int32 chunkIndex = 0; chunkIndex < numChunks; chunkIndex++)
+	{
+		m_numRoomQueries += m_accumulators[chunkIndex].NumRoomQueries;
+		m_numRoomQueriesSaved += m_accumulators[chunkIndex].NumRoomQueriesSaved;
+	}
+
+	SET_DWORD_STAT(STAT_WwiserR_AmbientWeightRoomQueries, m_numRoomQueries);
+	SET_DWORD_STAT(STAT_WwiserR_AmbientWeightRoomQueriesSaved, m_numRoomQueriesSaved);
+
+	// 4. apply the sums to the playing emitters, and create emitters for new rooms
+	m_numSoundEngineCallsSaved = 0;
+	TArray<TPair<UAkRoomComponent*, int32>> emittersToCreate;
+	TSet<FAmbientBedGroup*> bedGroupsToKeep;
+
+	for (int32 groupIndex = 0; groupIndex < numGroups; groupIndex++)
+	{
+		FAmbientBedGroup& bedGroup = m_weightGroups[groupIndex].Key;
+		const TMap<UAkRoomComponent*, FAmbientBedPartialSum>& roomSums = m_groupSums[groupIndex];
+
+		TSet<UAkRoomComponent*> foundRooms;
+		foundRooms.Reserve(roomSums.Num());
+
+		if (!roomSums.IsEmpty())
+		{
+			TMap<UAkRoomComponent*, UAmbientBedEmitterComponent*>& roomEmitters = m_playingAmbientBedEmitters.FindOrAdd(bedGroup);
+
+			for (const TPair<UAkRoomComponent*, FAmbientBedPartialSum>& roomSum : roomSums)
+			{
+				foundRooms.Add(roomSum.Key);
+
+				if (UAmbientBedEmitterComponent* const* ambientEmitter = roomEmitters.Find(roomSum.Key))
+				{
+					(*ambientEmitter)->AddPartialSum(roomSum.Value);
+				}
+				else
+				{
+					emittersToCreate.Emplace(roomSum.Key, groupIndex);
+					bedGroupsToKeep.Add(&bedGroup);
+				}
+			}
+		}
+
+		CleanupUnusedEmitters(bedGroup, foundRooms, bedGroupsToKeep);
+	}
+
+	for (const TPair<UAkRoomComponent*, int32>& emitter : emittersToCreate)
 	{
-		CreateAmbientEmitter(emitter.Value, emitter.Key, emitter.Value.AmbientBed);
+		const FAmbientBedGroup& bedGroup = m_weightGroups[emitter.Value].Key;
+		CreateAmbientEmitter(bedGroup, emitter.Key, bedGroup.AmbientBed);
 	}
 
+	SET_DWORD_STAT(STAT_WwiserR_AmbientBedSoundEngineCallsSaved, m_numSoundEngineCallsSaved);
+
 	CleanupRoomListeners();
 	
-	const FQuat listenerRotation = AkAudioDevice->GetSpatialAudioListener()->GetComponentQuat();
-	for (auto& roomListener : m_roomListeners)
+	// new room listeners get the last pushed rotation
+	const FQuat listenerRotation = spatialListener->GetComponentQuat();
+	if (m_roomListenerRotation.AngularDistance(listenerRotation) > m_roomListenerRotationEpsilon)
 	{
-		roomListener.Value->SetWorldRotation(listenerRotation);
+		m_roomListenerRotation = listenerRotation;
+
+		for (auto& roomListener : m_roomListeners)
+		{
+			roomListener.Value->SetWorldRotation(listenerRotation);
+		}
 	}
 
 #if !UE_BUILD_SHIPPING
+	if (Private_AmbientBeds::bDebugDrawWeights)
+	{
+		for (const FAmbientWeightWorkItem& workItem : m_workItems)
+		{
+			if (workItem.WeightElement && workItem.RoomCache->Room)
+			{
+				m_dbgWeightComps.Add(workItem.WeightElement->AmbientSoundWeightComponent, &m_weightGroups[workItem.GroupIndex].Key);
+			}
+		}
+	}
+
 	DebugDrawOnTick(world);
 #endif
 }
@@ -515,7 +922,10 @@ void AAmbientBedWorldManager::DebugDrawOnTick(UWorld* world)
 	{
 		int key = 1;
 		
-		const FString msgLabels{ TEXT("\n\n\n\nDistance Rtpc - Weight Rtpc - Summed Weight\n") };
+		const FString msgLabels = FString::Printf(
+			TEXT("\n\n\n\nRoom queries: %i - saved by cache: %i\nSound engine calls saved: %i\nBed groups updated: %i - skipped: %i\n")
+			TEXT("Distance Rtpc - Weight Rtpc - Summed Weight\n"),
+			m_numRoomQueries, m_numRoomQueriesSaved, m_numSoundEngineCallsSaved, m_numGroupsUpdated, m_numGroupsSkipped);
 		GEngine->AddOnScreenDebugMessage(key, 1.f, FColor::White, msgLabels);
 
 		for (const TPair<UAmbientBedEmitterComponent*, FDebugValues>& emitter : s_dbgViewportValues)
@@ -624,7 +1034,6 @@ void AAmbientBedWorldManager::CreateAmbientEmitter(const FAmbientBedGroup& BedGr
 	ambientComp->m_dbgColor = BedGroup.GroupColor;
 #endif
 
-	FScopeLock Lock(&m_critSectAmbientEmitters);
 	m_playingAmbientBedEmitters[BedGroup].Emplace(RoomComp, ambientComp);
 }
 
@@ -643,28 +1052,14 @@ UAkComponent* AAmbientBedWorldManager::GetOrCreateRoomListener(UAkRoomComponent*
 		roomListener->RegisterComponentWithWorld(GetWorld());
 		roomListener->AttachToComponent(RoomComp, FAttachmentTransformRules::KeepRelativeTransform);
 		roomListener->OcclusionRefreshInterval = 0.f;
+		roomListener->SetWorldRotation(m_roomListenerRotation);
 
-		FScopeLock Lock(&m_critSectRoomListeners);
 		m_roomListeners.Emplace(RoomComp, roomListener);
 	}
 
 	return roomListener;
 }
 
-void AAmbientBedWorldManager::UpdateEmitterPosition(const FAmbientBedGroup& BedGroup,
-	UAkRoomComponent* RoomComp, const FAmbientWeightOctreeElement& WeightElement,
-	const FVector& ListenerPosition, float Range)
-{
-	const float weight = WeightElement.AmbientSoundWeightComponent->Weight;
-	const FVector weightedRelPos = weight * (WeightElement.BoundingBox.Center - ListenerPosition) / Range;
-
-	UAmbientBedEmitterComponent*& ambientEmitter = m_playingAmbientBedEmitters[BedGroup][RoomComp];
-	ambientEmitter->m_localPosition += weightedRelPos;
-	ambientEmitter->m_avgWeightedDistance += weightedRelPos.Length();
-	ambientEmitter->m_summedWeight += weight;
-	ambientEmitter->m_numWeights++;
-}
-
 void AAmbientBedWorldManager::CleanupUnusedEmitters(const FAmbientBedGroup& BedGroup,
 	const TSet<UAkRoomComponent*>& FoundRooms, const TSet<FAmbientBedGroup*>& BedGroupsToKeep)
 {
@@ -680,7 +1075,6 @@ void AAmbientBedWorldManager::CleanupUnusedEmitters(const FAmbientBedGroup& BedG
 #endif
 		}
 
-		FScopeLock Lock(&m_critSectAmbientEmitters);
 		m_playingAmbientBedEmitters.Remove(BedGroup);
 
 		return;
@@ -700,19 +1094,17 @@ void AAmbientBedWorldManager::CleanupUnusedEmitters(const FAmbientBedGroup& BedG
 		}
 		else
 		{
-			emitter.Value->AccumulatePositionAndDistance(BedGroup.AmbientBed);
+			m_numSoundEngineCallsSaved += emitter.Value->AccumulatePositionAndDistance(BedGroup.AmbientBed);
 		}
 	}
 
 	for (UAkRoomComponent* room : toRemove)
 	{
-		FScopeLock Lock(&m_critSectAmbientEmitters);
 		m_playingAmbientBedEmitters[BedGroup].Remove(room);
 	}
 
 	if (m_playingAmbientBedEmitters[BedGroup].IsEmpty() && !BedGroupsToKeep.Contains(&BedGroup))
 	{
-		FScopeLock Lock(&m_critSectAmbientEmitters);
 		m_playingAmbientBedEmitters.Remove(BedGroup);
 	}
 }
@@ -744,6 +1136,133 @@ void AAmbientBedWorldManager::CleanupRoomListeners()
 void AAmbientBedWorldManager::AddWeight(
 	UAmbientBedWeightComponent* AmbientSoundWeightComponent, UDA_AmbientBed* AmbientBed)
 {
+	const FAmbientBedWeightRegistration registration(AmbientSoundWeightComponent, AmbientBed);
+
+	if (!m_batchRegistration)
+	{
+		AddWeightsToOctree(MakeArrayView(&registration, 1));
+		return;
+	}
+
+	// a queued removal cancels out
+	if (const bool* isAdded = m_pendingRegistrations.Find(registration))
+	{
+		if (!*isAdded) { m_pendingRegistrations.Remove(registration); }
+		return;
+	}
+
+	m_pendingRegistrations.Add(registration, true);
+}
+
+void AAmbientBedWorldManager::RemoveWeight(
+	UAmbientBedWeightComponent* AmbientSoundWeightComponent, UDA_AmbientBed* AmbientBed)
+{
+	if (!m_batchRegistration)
+	{
+		RemoveWeightFromOctree(AmbientSoundWeightComponent, AmbientBed);
+		return;
+	}
+
+	// a queued add cancels out
+	const FAmbientBedWeightRegistration registration(AmbientSoundWeightComponent, AmbientBed);
+
+	if (const bool* isAdded = m_pendingRegistrations.Find(registration))
+	{
+		if (*isAdded) { m_pendingRegistrations.Remove(registration); }
+		return;
+	}
+
+	m_pendingRegistrations.Add(registration, false);
+}
+
+void AAmbientBedWorldManager::UpdateWeightLocation(
+	UAmbientBedWeightComponent* AmbientSoundWeightComponent, UDA_AmbientBed* AmbientBed)
+{
+	// queued adds are inserted at their location when applied
+	if (m_pendingRegistrations.Contains(FAmbientBedWeightRegistration(AmbientSoundWeightComponent, AmbientBed))) { return; }
+
+	const FAmbientBedGroup bedGroup{ AmbientBed, GetGroupID(AmbientSoundWeightComponent) };
+
+	if (const TSharedPtr<TAmbientWeightOctree>* weightOctree = m_weightComps.Find(bedGroup))
+	{
+		(*weightOctree)->UpdateWeight(AmbientSoundWeightComponent);
+		m_groupLODs.Remove(bedGroup);
+	}
+}
+
+void AAmbientBedWorldManager::ApplyPendingRegistrations(const bool bRemovalsOnly)
+{
+	SET_DWORD_STAT(STAT_WwiserR_AmbientWeightRegistrationsApplied, 0);
+	SET_DWORD_STAT(STAT_WwiserR_AmbientWeightRegistrationsPending, m_pendingRegistrations.Num());
+	if (m_pendingRegistrations.IsEmpty()) { return; }
+
+	const double startTime = FPlatformTime::Seconds();
+	uint32 numApplied = 0;
+
+	// removals are never deferred, components can be garbage collected once they ended play
+	m_registrationBatch.Reset();
+
+	for (TMap<FAmbientBedWeightRegistration, bool>::TIterator it = m_pendingRegistrations.CreateIterator(); it; ++it)
+	{
+		if (it->Value)
+		{
+			m_registrationBatch.Add(it->Key);
+			continue;
+		}
+
+		RemoveWeightFromOctree(it->Key.AmbientBedWeightComponent, it->Key.AmbientBed);
+		it.RemoveCurrent();
+		numApplied++;
+	}
+
+	if (!bRemovalsOnly)
+	{
+		// adds grouped per bed group, so each octree is filled in one go
+		Algo::Sort(m_registrationBatch, [](const FAmbientBedWeightRegistration& A, const FAmbientBedWeightRegistration& B)
+			{
+				return A.AmbientBed != B.AmbientBed ? A.AmbientBed < B.AmbientBed
+					: GetGroupID(A.AmbientBedWeightComponent) < GetGroupID(B.AmbientBedWeightComponent);
+			});
+
+		for (int32 first = 0; first < m_registrationBatch.Num();)
+		{
+			const FAmbientBedWeightRegistration& firstRegistration = m_registrationBatch[first];
+			int32 last = first + 1;
+
+			while (last < m_registrationBatch.Num() && m_registrationBatch[last].AmbientBed == firstRegistration.AmbientBed
+				&& GetGroupID(m_registrationBatch[last].AmbientBedWeightComponent) == GetGroupID(firstRegistration.AmbientBedWeightComponent))
+			{
+				last++;
+			}
+
+			const TConstArrayView<FAmbientBedWeightRegistration> registrations(&m_registrationBatch[first], last - first);
+			AddWeightsToOctree(registrations);
+
+			for (const FAmbientBedWeightRegistration& registration : registrations)
+			{
+				m_pendingRegistrations.Remove(registration);
+			}
+
+			numApplied += registrations.Num();
+			first = last;
+
+			// the remaining bed groups are added next frame
+			if ((FPlatformTime::Seconds() - startTime) * 1000.0 > m_registrationBudgetMs) { break; }
+		}
+	}
+
+	SET_DWORD_STAT(STAT_WwiserR_AmbientWeightRegistrationsApplied, numApplied);
+	SET_DWORD_STAT(STAT_WwiserR_AmbientWeightRegistrationsPending, m_pendingRegistrations.Num());
+}
+
+void AAmbientBedWorldManager::OnPreGarbageCollect()
+{
+	ApplyPendingRegistrations(true);
+}
+
+void AAmbientBedWorldManager::AddWeightsToOctree(TConstArrayView<FAmbientBedWeightRegistration> Registrations)
+{
+	UDA_AmbientBed* AmbientBed = Registrations[0].AmbientBed;
 	float activationRange = AmbientBed->Range;
 
 #if !UE_BUILD_SHIPPING
@@ -759,8 +1278,7 @@ void AAmbientBedWorldManager::AddWeight(
 		return;
 	}
 #endif
-	const FAmbientBedGroup bedGroup{ AmbientBed,
-		AmbientSoundWeightComponent->bOverrideAmbientBedGroup ? AmbientSoundWeightComponent->GroupId : -1 };
+	const FAmbientBedGroup bedGroup{ AmbientBed, GetGroupID(Registrations[0].AmbientBedWeightComponent) };
 
 	if (!m_weightComps.Contains(bedGroup))
 	{
@@ -768,28 +1286,201 @@ void AAmbientBedWorldManager::AddWeight(
 		m_weightComps.Add(TPair<FAmbientBedGroup, TSharedPtr<TAmbientWeightOctree>>(bedGroup, emitterOctree));
 	}
 
-	m_weightComps[bedGroup]->AddWeight(AmbientSoundWeightComponent);
+	m_weightsToAdd.Reset();
+
+	for (const FAmbientBedWeightRegistration& registration : Registrations)
+	{
+		m_weightsToAdd.Add(registration.AmbientBedWeightComponent);
+	}
+
+	m_weightComps[bedGroup]->AddWeights(m_weightsToAdd);
+	m_groupLODs.Remove(bedGroup);
 }
 
-void AAmbientBedWorldManager::RemoveWeight(
+void AAmbientBedWorldManager::RemoveWeightFromOctree(
 	UAmbientBedWeightComponent* AmbientSoundWeightComponent, UDA_AmbientBed* AmbientBed)
 {
-	const float activationRange = AmbientBed->Range;
-	const FAmbientBedGroup bedGroup{ AmbientBed,
-		AmbientSoundWeightComponent->bOverrideAmbientBedGroup ? AmbientSoundWeightComponent->GroupId : -1 };
+	const FAmbientBedGroup bedGroup{ AmbientBed, GetGroupID(AmbientSoundWeightComponent) };
+	if (!m_weightComps.Contains(bedGroup)) { return; }
 
 	// remove from m_weights and m_ambientEmitters
 	if (m_weightComps[bedGroup]->ObjectToOctreeId.Contains(AmbientSoundWeightComponent->GetUniqueID()))
 	{
 		m_weightComps[bedGroup]->RemoveWeight(AmbientSoundWeightComponent);
+		m_groupLODs.Remove(bedGroup);
 	}
 
 	if (m_weightComps[bedGroup]->NumElements <= 0)
 	{
 		m_weightComps.Remove(bedGroup);
-		m_playingAmbientBedEmitters.Remove(bedGroup);
+
+		// baked cells keep the emitters playing
+		if (!m_weightFields.Contains(bedGroup))
+		{
+			m_playingAmbientBedEmitters.Remove(bedGroup);
+		}
+	}
+}
+
+void AAmbientBedWorldManager::RegisterBakedLevel(ULevel* Level)
+{
+	if (!IsValid(Level) || m_bakedLevels.Contains(Level)) { return; }
+
+	const UAmbientWeightFieldDatabase* database = Level->GetAssetUserData<UAmbientWeightFieldDatabase>();
+	if (!database || database->Layers.IsEmpty()) { return; }
+
+	// baked in level space, streamed levels can be offset
+	const FTransform levelTransform = UAmbientWeightFieldDatabase::GetLevelTransform(Level);
+
+	TArray<TSharedPtr<FAmbientWeightField>>& levelFields = m_bakedLevels.Add(Level);
+	int32 numCells = 0;
+
+	for (const FAmbientWeightFieldLayer& layer : database->Layers)
+	{
+		TSharedPtr<FAmbientWeightField> weightField = MakeShared<FAmbientWeightField>(*database, layer, levelTransform);
+		UDA_AmbientBed* ambientBed = weightField->AmbientBed;
+
+		if (!IsValid(ambientBed) || !IsValid(ambientBed->LoopEvent) || ambientBed->Range <= 0.f || weightField->NumCells() == 0)
+		{
+			continue;
+		}
+
+		levelFields.Add(weightField);
+		const FAmbientBedGroup bedGroup{ ambientBed, weightField->GroupID };
+		m_weightFields.FindOrAdd(bedGroup).Add(weightField);
+		m_groupLODs.Remove(bedGroup);
+		numCells += weightField->NumCells();
+	}
+
+	WR_DBG_FUNC(Log, "%s: %i baked weight field layers, %i cells", *Level->GetOutermost()->GetName(), levelFields.Num(), numCells);
+}
+
+void AAmbientBedWorldManager::UnregisterBakedLevel(ULevel* Level)
+{
+	TArray<TSharedPtr<FAmbientWeightField>> levelFields;
+	if (!m_bakedLevels.RemoveAndCopyValue(Level, levelFields)) { return; }
+
+	for (const TSharedPtr<FAmbientWeightField>& weightField : levelFields)
+	{
+		const FAmbientBedGroup bedGroup{ weightField->AmbientBed, weightField->GroupID };
+		TArray<TSharedPtr<FAmbientWeightField>>* groupFields = m_weightFields.Find(bedGroup);
+		if (!groupFields) { continue; }
+
+		groupFields->Remove(weightField);
+		m_groupLODs.Remove(bedGroup);
+
+		if (groupFields->IsEmpty())
+		{
+			m_weightFields.Remove(bedGroup);
+
+			if (!m_weightComps.Contains(bedGroup))
+			{
+				m_playingAmbientBedEmitters.Remove(bedGroup);
+			}
+		}
 	}
 }
+
+void AAmbientBedWorldManager::OnRoomIndexChanged(UAkRoomComponent* RoomComponent)
+{
+	if (IsValid(RoomComponent) && RoomComponent->GetWorld() != GetWorld()) { return; }
+
+	// 0 is never valid, so elements that were never queried are always refreshed
+	if (++m_roomIndexSerial == 0) { m_roomIndexSerial = 1; }
+
+	// weights can be in a different room now
+	m_adjacentRoomsDirty = true;
+	m_groupLODs.Reset();
+}
+
+void AAmbientBedWorldManager::UpdateAdjacentRooms(const AkRoomID& ListenerRoomID)
+{
+	m_listenerRoomID = ListenerRoomID;
+	m_adjacentRoomIDs.Reset();
+	m_adjacentRoomsDirty = false;
+
+	// the tiers of all bed groups changed
+	m_groupLODs.Reset();
+
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	if (!AkAudioDevice) { return; }
+
+	TArray<TWeakObjectPtr<UAkPortalComponent>>* portals = AkAudioDevice->GetPortals(GetWorld());
+	if (!portals) { return; }
+
+	for (const TWeakObjectPtr<UAkPortalComponent>& portal : *portals)
+	{
+		if (!portal.IsValid()) { continue; }
+
+		if (portal->GetFrontRoomID() == ListenerRoomID)
+		{
+			m_adjacentRoomIDs.AddUnique(portal->GetBackRoomID());
+		}
+		else if (portal->GetBackRoomID() == ListenerRoomID)
+		{
+			m_adjacentRoomIDs.AddUnique(portal->GetFrontRoomID());
+		}
+	}
+}
+
+EAmbientBedLOD AAmbientBedWorldManager::GetGroupLOD(const FAmbientBedGroup& BedGroup) const
+{
+	const TMap<UAkRoomComponent*, UAmbientBedEmitterComponent*>* roomEmitters = m_playingAmbientBedEmitters.Find(BedGroup);
+	if (!roomEmitters) { return EAmbientBedLOD::Distant; }
+
+	EAmbientBedLOD groupLOD = EAmbientBedLOD::Distant;
+
+	for (const TPair<UAkRoomComponent*, UAmbientBedEmitterComponent*>& roomEmitter : *roomEmitters)
+	{
+		const AkRoomID roomID = AkRoomID::FromGameObjectID(roomEmitter.Value->m_roomId);
+
+		if (roomID == m_listenerRoomID || roomEmitter.Value->IsCrossfading()) { return EAmbientBedLOD::ListenerRoom; }
+
+		if (m_adjacentRoomIDs.Contains(roomID))
+		{
+			groupLOD = EAmbientBedLOD::AdjacentRoom;
+		}
+	}
+
+	return groupLOD;
+}
+
+bool AAmbientBedWorldManager::ShouldUpdateGroup(const FAmbientBedGroup& BedGroup, const FVector& ReferencePosition,
+	const FVector& ListenerPosition, double Time)
+{
+	if (!m_useLOD) { return true; }
+
+	FAmbientBedGroupLOD* groupLOD = m_groupLODs.Find(BedGroup);
+
+	if (groupLOD)
+	{
+		switch (GetGroupLOD(BedGroup))
+		{
+		case EAmbientBedLOD::AdjacentRoom:
+			if (Time - groupLOD->UpdateTime < m_adjacentRoomUpdateInterval) { return false; }
+			break;
+		case EAmbientBedLOD::Distant:
+			// with ReferencePositionLerp at 0, the reference position doesn't follow the listener
+			if (FVector::DistSquared(ReferencePosition, groupLOD->ReferencePosition) <= m_distantMovementThresholdSquared
+				&& FVector::DistSquared(ListenerPosition, groupLOD->ListenerPosition) <= m_distantMovementThresholdSquared)
+			{
+				return false;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+	else
+	{
+		groupLOD = &m_groupLODs.Add(BedGroup);
+	}
+
+	groupLOD->ReferencePosition = ReferencePosition;
+	groupLOD->ListenerPosition = ListenerPosition;
+	groupLOD->UpdateTime = Time;
+	return true;
+}
 #pragma endregion
 
 #pragma region UAmbientBedManager
@@ -813,6 +1504,13 @@ void UAmbientBedManager::Initialize(USoundListenerManager* SoundListenerManager)
 	m_listenerManager->OnSpatialAudioListenerChanged.AddUObject(this, &UAmbientBedManager::OnSpatialAudioListenerChanged);
 	FWorldDelegates::OnPostWorldCleanup.AddUObject(this, &UAmbientBedManager::OnPostWorldCleanup);
 
+	if (audioConfig->bUseBakedAmbientWeightFields)
+	{
+		FWorldDelegates::OnWorldInitializedActors.AddUObject(this, &UAmbientBedManager::OnWorldInitializedActors);
+		FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UAmbientBedManager::OnLevelAddedToWorld);
+		FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UAmbientBedManager::OnLevelRemovedFromWorld);
+	}
+
 	m_isInitialized = true;
 	WR_DBG_NET(Log, "initialized (%s)", *UAudioUtils::GetClientOrServerString(GetWorld()));
 }
@@ -823,6 +1521,9 @@ void UAmbientBedManager::Deinitialize()
 	
 	m_listenerManager->OnSpatialAudioListenerChanged.RemoveAll(this);
 	FWorldDelegates::OnPostWorldCleanup.RemoveAll(this);
+	FWorldDelegates::OnWorldInitializedActors.RemoveAll(this);
+	FWorldDelegates::LevelAddedToWorld.RemoveAll(this);
+	FWorldDelegates::LevelRemovedFromWorld.RemoveAll(this);
 
 	for (TPair<UWorld*, AAmbientBedWorldManager*> worldManager : m_worldManagers)
 	{
@@ -857,15 +1558,7 @@ void UAmbientBedManager::AddWeight(
 		return;
 	}
 
-	if (!m_worldManagers.Contains(World))
-	{
-		m_worldManagers.Add(TPair<UWorld*, AAmbientBedWorldManager*>
-			(World, World->SpawnActor<AAmbientBedWorldManager>(FActorSpawnParameters())));
-
-		m_worldManagers[World]->Initialize(m_listenerManager);
-	}
-
-	m_worldManagers[World]->AddWeight(AmbientSoundWeightComponent, AmbientBed);
+	GetOrCreateWorldManager(World)->AddWeight(AmbientSoundWeightComponent, AmbientBed);
 }
 
 void UAmbientBedManager::RemoveWeight(
@@ -879,6 +1572,31 @@ void UAmbientBedManager::RemoveWeight(
 	}
 }
 
+void UAmbientBedManager::UpdateWeightLocation(
+	UWorld* World, UAmbientBedWeightComponent* AmbientSoundWeightComponent, UDA_AmbientBed* AmbientBed)
+{
+	if (!IsValid(AmbientBed)) { return; }
+
+	if (AAmbientBedWorldManager** worldManager = m_worldManagers.Find(World))
+	{
+		(*worldManager)->UpdateWeightLocation(AmbientSoundWeightComponent, AmbientBed);
+	}
+}
+
+AAmbientBedWorldManager* UAmbientBedManager::GetOrCreateWorldManager(UWorld* World)
+{
+	if (AAmbientBedWorldManager** worldManager = m_worldManagers.Find(World))
+	{
+		return *worldManager;
+	}
+
+	AAmbientBedWorldManager* worldManager = World->SpawnActor<AAmbientBedWorldManager>(FActorSpawnParameters());
+	m_worldManagers.Add(World, worldManager);
+	worldManager->Initialize(m_listenerManager);
+
+	return worldManager;
+}
+
 void UAmbientBedManager::OnSpatialAudioListenerChanged(UWorld* NewWorld, UAkComponent* SpatialAudioListener)
 {
 	for (TPair<UWorld*, AAmbientBedWorldManager*> worldManager : m_worldManagers)
@@ -891,4 +1609,156 @@ void UAmbientBedManager::OnPostWorldCleanup(UWorld* World, bool bSessionEnded, b
 {
 	m_worldManagers.Remove(World);
 }
+
+void UAmbientBedManager::OnWorldInitializedActors(const FActorsInitializedParams& Params)
+{
+	if (!IsValid(Params.World) || !Params.World->IsGameWorld()) { return; }
+
+	for (ULevel* level : Params.World->GetLevels())
+	{
+		OnLevelAddedToWorld(level, Params.World);
+	}
+}
+
+void UAmbientBedManager::OnLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+	if (!IsValid(Level) || !IsValid(World) || !World->IsGameWorld()) { return; }
+	if (!Level->GetAssetUserData<UAmbientWeightFieldDatabase>()) { return; }
+
+	GetOrCreateWorldManager(World)->RegisterBakedLevel(Level);
+}
+
+void UAmbientBedManager::OnLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	if (AAmbientBedWorldManager** worldManager = m_worldManagers.Find(World))
+	{
+		if (IsValid(*worldManager))
+		{
+			(*worldManager)->UnregisterBakedLevel(Level);
+		}
+	}
+}
+#pragma endregion
+
+#pragma region Benchmark
+#if !UE_BUILD_SHIPPING
+namespace Private_AmbientBeds
+{
+	// rooms on a 20m grid, only compared and never dereferenced
+	static UAkRoomComponent* GetBenchmarkRoom(const FVector& Location)
+	{
+		constexpr float roomSize = 2000.f;
+		const UPTRINT roomX = FMath::FloorToInt(Location.X / roomSize) & 0xFF;
+		const UPTRINT roomY = FMath::FloorToInt(Location.Y / roomSize) & 0xFF;
+
+		return reinterpret_cast<UAkRoomComponent*>((1 + roomX + (roomY << 8)) * alignof(UObject));
+	}
+
+	// aggregation before per task accumulators: one task per bed group, sums shared behind a lock
+	static void AggregateWeightsLocked(TConstArrayView<TArray<FAmbientWeightWorkItem>> GroupWorkItems,
+		TArray<TMap<UAkRoomComponent*, FAmbientBedPartialSum>>& OutGroupSums)
+	{
+		FCriticalSection critSectSums;
+
+		ParallelFor(GroupWorkItems.Num(), [&](int32 GroupIndex)
+			{
+				for (const FAmbientWeightWorkItem& workItem : GroupWorkItems[GroupIndex])
+				{
+					UAkRoomComponent* room = GetBenchmarkRoom(workItem.Location);
+
+					FScopeLock Lock(&critSectSums);
+					FAmbientBedPartialSum& groupSum = OutGroupSums[GroupIndex].FindOrAdd(room);
+					groupSum.LocalPosition += workItem.WeightedRelativePosition;
+					groupSum.WeightedDistance += workItem.WeightedRelativePosition.Length();
+					groupSum.SummedWeight += workItem.Weight;
+					groupSum.NumWeights++;
+				}
+			});
+	}
+
+	static void RunAggregationBenchmark(const TArray<FString>& Args)
+	{
+		const int32 numIterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100;
+		const int32 numWeightsPerRun[] = { 1000, 10000 };
+		constexpr int32 numGroups = 8;
+		constexpr float range = 10000.f;
+
+		FRandomStream random(1337);
+		TArray<TArray<FAmbientWeightWorkItem>> groupWorkItems;
+		TArray<FAmbientWeightWorkItem> workItems;
+		TArray<FAmbientBedAccumulator> accumulators;
+		TArray<TMap<UAkRoomComponent*, FAmbientBedPartialSum>> lockedSums;
+		TArray<TMap<UAkRoomComponent*, FAmbientBedPartialSum>> mergedSums;
+
+		for (const int32 numWeights : numWeightsPerRun)
+		{
+			groupWorkItems.Reset();
+			groupWorkItems.SetNum(numGroups);
+			workItems.Reset(numWeights);
+
+			for (int32 i = 0; i < numWeights; i++)
+			{
+				FAmbientWeightWorkItem& workItem = groupWorkItems[i % numGroups].AddDefaulted_GetRef();
+				workItem.Location = random.RandPointInBox(FBox(FVector(-range), FVector(range)));
+				workItem.Weight = random.FRandRange(0.1f, 1.f);
+				workItem.WeightedRelativePosition = workItem.Weight * workItem.Location / range;
+				workItem.GroupIndex = i % numGroups;
+			}
+
+			for (const TArray<FAmbientWeightWorkItem>& items : groupWorkItems)
+			{
+				workItems.Append(items);
+			}
+
+			double startTime = FPlatformTime::Seconds();
+			for (int32 iteration = 0; iteration < numIterations; iteration++)
+			{
+				lockedSums.Reset();
+				lockedSums.SetNum(numGroups);
+				AggregateWeightsLocked(groupWorkItems, lockedSums);
+			}
+			const double lockedMs = (FPlatformTime::Seconds() - startTime) * 1000. / numIterations;
+
+			startTime = FPlatformTime::Seconds();
+			for (int32 iteration = 0; iteration < numIterations; iteration++)
+			{
+				const int32 numChunks = AggregateWeights(workItems, accumulators,
+					[](const FAmbientWeightWorkItem& WorkItem, FAmbientBedAccumulator& Accumulator)
+					{
+						return GetBenchmarkRoom(WorkItem.Location);
+					});
+
+				MergeAccumulators(MakeArrayView(accumulators.GetData(), numChunks), numGroups, mergedSums);
+			}
+			const double accumulatorsMs = (FPlatformTime::Seconds() - startTime) * 1000. / numIterations;
+
+			int32 mismatches = 0;
+			for (int32 groupIndex = 0; groupIndex < numGroups; groupIndex++)
+			{
+				for (const TPair<UAkRoomComponent*, FAmbientBedPartialSum>& lockedSum : lockedSums[groupIndex])
+				{
+					const FAmbientBedPartialSum* mergedSum = mergedSums[groupIndex].Find(lockedSum.Key);
+
+					if (!mergedSum || mergedSum->NumWeights != lockedSum.Value.NumWeights
+						|| !FMath::IsNearlyEqual(mergedSum->SummedWeight, lockedSum.Value.SummedWeight, 1.e-2f))
+					{
+						mismatches++;
+					}
+				}
+
+				mismatches += FMath::Abs(mergedSums[groupIndex].Num() - lockedSums[groupIndex].Num());
+			}
+
+			WR_DBG_STATIC_FUNC(Log, "%6i weights, %i bed groups, %i workers : locked %.4f ms, per task accumulators %.4f ms (x%.2f), mismatches: %i",
+				numWeights, numGroups, FTaskGraphInterface::Get().GetNumWorkerThreads(), lockedMs, accumulatorsMs,
+				accumulatorsMs > 0. ? lockedMs / accumulatorsMs : 0., mismatches);
+		}
+	}
+
+	static FAutoConsoleCommand CCmd_AmbientBeds_AggregationBenchmark(TEXT("WwiserR.AmbientBeds.AggregationBenchmark"),
+		TEXT("Compares ambient bed weight aggregation with a shared lock against per task accumulators, at 1k/10k weights. ")
+		TEXT("(optional: iterations, default 100)"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunAggregationBenchmark), ECVF_Cheat);
+} // namespace Private_AmbientBeds
+#endif
 #pragma endregion
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/SceneComponent.h"
 #include "AK\SoundEngine\Common\AkTypes.h"
+#include "AK\SpatialAudio\Common\AkSpatialAudioTypes.h"
 #include "AmbientBedManager.generated.h"
 
 class USoundListenerManager;
@@ -13,13 +14,25 @@ class UAkComponent;
 class UAkRoomComponent;
 class UAkAuxBus;
 class UAkRtpc;
+class ULevel;
+struct FActorsInitializedParams;
 
 #define WEIGHTCOLORSTARTSEED 18;
 
+class FAmbientWeightField;
+
+// room at a weight's location, valid while Serial matches the world manager's room index serial
+struct FAmbientWeightRoomCache
+{
+	UAkRoomComponent* Room{};
+	uint32 Serial = 0;
+};
+
 struct FAmbientWeightOctreeElement
 {
 	UAmbientBedWeightComponent* AmbientSoundWeightComponent{};
 	FBoxCenterAndExtent BoundingBox{};
+	mutable FAmbientWeightRoomCache RoomCache{};
 
 	explicit FAmbientWeightOctreeElement(UAmbientBedWeightComponent* a_AmbientSoundWeightComponent);
 };
@@ -55,7 +68,10 @@ public:
 		: TOctree2<FAmbientWeightOctreeElement, FAmbientWeightOctreeSemantics>(FVector::ZeroVector, HALF_WORLD_MAX) {}
 
 	void AddWeight(UAmbientBedWeightComponent* AmbientSoundWeightComponent);
+	void AddWeights(TConstArrayView<UAmbientBedWeightComponent*> AmbientSoundWeightComponents);
 	void RemoveWeight(UAmbientBedWeightComponent* AmbientSoundWeightComponent);
+	/** reinserts a weight that moved, which also drops its cached room */
+	void UpdateWeight(UAmbientBedWeightComponent* AmbientSoundWeightComponent);
 
 #if !UE_BUILD_SHIPPING
 protected:
@@ -90,10 +106,82 @@ USTRUCT() struct FAmbientBedGroup
 
 FORCEINLINE uint32 GetTypeHash(const FAmbientBedGroup& AmbientLoopGroup)
 {
-	uint32 Hash = FCrc::MemCrc32(&AmbientLoopGroup, sizeof(FAmbientBedGroup));
-	return Hash;
+	// the debug color is not part of the key
+	return HashCombineFast(GetTypeHash(AmbientLoopGroup.AmbientBed), GetTypeHash(AmbientLoopGroup.GroupID));
+}
+
+enum class EAmbientBedLOD : uint8
+{
+	ListenerRoom,	// every frame, also while crossfading between rooms
+	AdjacentRoom,	// at a reduced rate
+	Distant			// when the reference or the listener position moved
+};
+
+// last update of a bed group, missing for groups that need an update
+struct FAmbientBedGroupLOD
+{
+	FVector ReferencePosition = FVector::ZeroVector;
+	FVector ListenerPosition = FVector::ZeroVector;	// the emitters are spatialized relative to the listener
+	double UpdateTime = 0.;
+};
+
+// queued add or remove of an ambient bed weight
+struct FAmbientBedWeightRegistration
+{
+	UAmbientBedWeightComponent* AmbientBedWeightComponent{};
+	UDA_AmbientBed* AmbientBed{};
+
+	FAmbientBedWeightRegistration() {}
+	FAmbientBedWeightRegistration(UAmbientBedWeightComponent* a_AmbientBedWeightComponent, UDA_AmbientBed* a_AmbientBed)
+		: AmbientBedWeightComponent(a_AmbientBedWeightComponent), AmbientBed(a_AmbientBed) {}
+
+	bool operator==(const FAmbientBedWeightRegistration& Other) const
+	{
+		return AmbientBedWeightComponent == Other.AmbientBedWeightComponent && AmbientBed == Other.AmbientBed;
+	}
+};
+
+FORCEINLINE uint32 GetTypeHash(const FAmbientBedWeightRegistration& Registration)
+{
+	return HashCombineFast(GetTypeHash(Registration.AmbientBedWeightComponent), GetTypeHash(Registration.AmbientBed));
 }
 
+// in-range weight (or baked weight field cell) of a bed group, gathered before the parallel aggregation
+struct FAmbientWeightWorkItem
+{
+	const FAmbientWeightOctreeElement* WeightElement{};	// nullptr for weight field cells
+	FAmbientWeightRoomCache* RoomCache{};
+	FVector Location{};
+	FVector WeightedRelativePosition{};	// relative to the listener, scaled by weight / range
+	float Weight = 0.f;
+	uint32 NumWeights = 1;
+	int32 GroupIndex = INDEX_NONE;
+};
+
+// sums of the weights of one bed group in one room, relative to the listener
+struct FAmbientBedPartialSum
+{
+	int32 GroupIndex = INDEX_NONE;
+	UAkRoomComponent* Room{};
+	FVector LocalPosition = FVector::ZeroVector;
+	float WeightedDistance = 0.f;
+	float SummedWeight = 0.f;
+	uint32 NumWeights = 0;
+
+	void Add(const FAmbientBedPartialSum& Other);
+};
+
+// private to one aggregation task, merged in task order after the ParallelFor
+struct FAmbientBedAccumulator
+{
+	TArray<FAmbientBedPartialSum> PartialSums{};
+	int32 NumRoomQueries = 0;
+	int32 NumRoomQueriesSaved = 0;
+
+	void Reset();
+	void Add(int32 GroupIndex, UAkRoomComponent* Room, const FVector& WeightedRelativePosition, float Weight, uint32 NumWeights);
+};
+
 UCLASS(ClassGroup = "WwiserR", meta=(BlueprintSpawnableComponent))
 class WWISERR_API UAmbientBedWeightComponent : public USceneComponent
 {
@@ -115,14 +203,27 @@ public:
 		meta = (EditCondition = "bOverrideAmbientBedGroup"))
 	uint8 GroupId = 0;
 
+	/** bake this weight into its level's UAmbientWeightFieldDatabase when the level is saved. Baked weights are editor only, and
+	 *  can't be moved or changed at runtime. Not baked in World Partition worlds */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Ambient Bed Weight")
+	bool bBakeIntoWeightField = false;
+
 protected:
 	bool m_isInWeightOctree = false;
+	bool m_isBaked = false;		// sampled from the level's weight field instead
 
 public:
 	UAmbientBedWeightComponent();
+	bool IsEditorOnly() const override;
+
+	/** true if this weight is in its level's weight field as it is now */
+	bool IsBakedIntoWeightField() const;
 	void BeginPlay() override;
 	void EndPlay(EEndPlayReason::Type EndPlayReason) override;
 
+protected:
+	void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport) override;
+
 public:
 	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category = "WwiserR|AmbientBed")
 	void SetWeight(float NewWeight);
@@ -162,6 +263,14 @@ protected:
 
 	// 0.f = same room, 1.f = different room
 	float m_FadePos = 0.f;
+
+	// last values sent to the sound engine, see UDA_AmbientBed update settings
+	float m_sentDistanceRtpc = -1.f;
+	float m_sentWeightRtpc = -1.f;
+	float m_sentFadePos = -1.f;
+	float m_timeSinceRtpcUpdate = 0.f;
+	float m_timeSinceAuxSendUpdate = 0.f;
+	double m_lastUpdateTime = 0.;		// groups are not updated every frame, see EAmbientBedLOD
 	
 public:
 	UAmbientBedEmitterComponent();
@@ -170,8 +279,11 @@ public:
 	void Initialize(UDA_AmbientBed* AmbientBed, const FString& Name);
 	void StartPlay(UDA_AmbientBed* AmbientBed);
 	void Stop();
-	void AccumulatePositionAndDistance(UDA_AmbientBed* AmbientBed);
+	void AddPartialSum(const FAmbientBedPartialSum& PartialSum);
+	/** applies the summed weights of this frame, returns the number of Rtpc and aux send calls skipped */
+	int32 AccumulatePositionAndDistance(UDA_AmbientBed* AmbientBed);
 	void SetEmitterListenerRelations();
+	FORCEINLINE bool IsCrossfading() const { return m_isCrossfading; }
 
 protected:
 	bool IsInListenerRoom();
@@ -198,19 +310,54 @@ protected:
 	UPROPERTY() USoundListenerManager* m_listenerManager {};
 	TMap<FAmbientBedGroup, TSharedPtr<TAmbientWeightOctree>> m_weightComps{};
 	TMap<UAkRoomComponent*, UAkComponent*> m_roomListeners{};
+
+	// registration is queued and applied in batches before ticking, removals also before garbage collection
+	bool m_batchRegistration = true;
+	float m_registrationBudgetMs = 1.f;
+	TMap<FAmbientBedWeightRegistration, bool> m_pendingRegistrations{};	// true = add, false = remove
+	TArray<FAmbientBedWeightRegistration> m_registrationBatch{};			// persistent scratch buffer
+	TArray<UAmbientBedWeightComponent*> m_weightsToAdd{};					// persistent scratch buffer
+
+	// invalidates the cached rooms of all weights when a room is (re/un)indexed
+	uint32 m_roomIndexSerial = 1;
+	FDelegateHandle m_onRoomIndexChangedHandle{};
+	int32 m_numRoomQueries = 0;			// last tick
+	int32 m_numRoomQueriesSaved = 0;	// last tick, answered from the cache
+	int32 m_numSoundEngineCallsSaved = 0;	// last tick, unchanged or rate limited Rtpcs and aux sends
+
+	// level of detail, bed groups are updated depending on the room they play in
+	bool m_useLOD = true;
+	float m_adjacentRoomUpdateInterval = 0.f;
+	float m_distantMovementThresholdSquared = 0.f;
+	TMap<FAmbientBedGroup, FAmbientBedGroupLOD> m_groupLODs{};
+	AkRoomID m_listenerRoomID{};
+	TArray<AkRoomID> m_adjacentRoomIDs{};
+	bool m_adjacentRoomsDirty = true;
+	int32 m_numGroupsUpdated = 0;		// last tick
+	int32 m_numGroupsSkipped = 0;		// last tick
+
+	FQuat m_roomListenerRotation = FQuat::Identity;
+	float m_roomListenerRotationEpsilon = 0.f;	// radians
+
+	// baked weight fields, per registered level and per bed group
+	TMap<ULevel*, TArray<TSharedPtr<FAmbientWeightField>>> m_bakedLevels{};
+	TMap<FAmbientBedGroup, TArray<TSharedPtr<FAmbientWeightField>>> m_weightFields{};
+
+	// aggregation of the in-range weights, see Tick. Persistent scratch buffers
+	TArray<TPair<FAmbientBedGroup, TSharedPtr<TAmbientWeightOctree>>> m_weightGroups{};	// octree is nullptr for baked only groups
+	TArray<TArray<FAmbientWeightWorkItem>> m_groupWorkItems{};
+	TArray<FAmbientWeightWorkItem> m_workItems{};
+	TArray<FAmbientBedAccumulator> m_accumulators{};
+	TArray<TMap<UAkRoomComponent*, FAmbientBedPartialSum>> m_groupSums{};
 	
 private:
 	TMap<FAmbientBedGroup, TMap<UAkRoomComponent*, UAmbientBedEmitterComponent*>> m_playingAmbientBedEmitters{};
-	FCriticalSection m_critSectAmbientEmitters;
-	FCriticalSection m_critSectRoomListeners;
 
 #if !UE_BUILD_SHIPPING
 	TSet<UDA_AmbientBed*> m_postedBedsWithoutValidRange;		// so we can log warnings only once per UDA_StaticSoundLoop
 	TMap<UAmbientBedWeightComponent*, FAmbientBedGroup*> m_dbgWeightComps;
-	FCriticalSection m_critSectDbgWeightComps;
 public:
 	inline static TMap<UAmbientBedEmitterComponent*, FDebugValues> s_dbgViewportValues{};
-	inline static FCriticalSection s_critSectDbgValues;
 #endif
 
 public:	
@@ -225,12 +372,29 @@ protected:
 	void CreateAmbientEmitter(const FAmbientBedGroup& AmbientLoopGroup,
 		UAkRoomComponent* RoomComp, UDA_AmbientBed* SoundLoop);
 	UAkComponent* GetOrCreateRoomListener(UAkRoomComponent* RoomComp, const FString& BaseName);
-	void UpdateEmitterPosition(const FAmbientBedGroup& LoopGroup, UAkRoomComponent* RoomComp,
-		const FAmbientWeightOctreeElement& WeightElement, const FVector& ListenerPosition, float Range);
 	void CleanupUnusedEmitters(const FAmbientBedGroup& LoopGroup,
 		const TSet<UAkRoomComponent*>& FoundRooms, const TSet<FAmbientBedGroup*>& LoopGroupsToKeep);
 	void CleanupRoomListeners();
 
+	void ApplyPendingRegistrations(const bool bRemovalsOnly);
+	void OnPreGarbageCollect();
+	void AddWeightsToOctree(TConstArrayView<FAmbientBedWeightRegistration> Registrations);	// of the same bed group
+	void RemoveWeightFromOctree(UAmbientBedWeightComponent* AmbientBedWeightComponent, UDA_AmbientBed* AmbientBed);
+	void OnRoomIndexChanged(UAkRoomComponent* RoomComponent);
+
+	void UpdateAdjacentRooms(const AkRoomID& ListenerRoomID);
+	EAmbientBedLOD GetGroupLOD(const FAmbientBedGroup& BedGroup) const;
+	/** returns false if the bed group can skip this tick, and otherwise marks it as updated */
+	bool ShouldUpdateGroup(const FAmbientBedGroup& BedGroup, const FVector& ReferencePosition, const FVector& ListenerPosition, double Time);
+
+public:
+	FORCEINLINE static int32 GetGroupID(const UAmbientBedWeightComponent* AmbientBedWeightComponent)
+	{
+		return AmbientBedWeightComponent->bOverrideAmbientBedGroup ? AmbientBedWeightComponent->GroupId : -1;
+	}
+
+protected:
+
 #if !UE_BUILD_SHIPPING
 	void DebugDrawOnTick(UWorld* World);
 #endif
@@ -238,6 +402,10 @@ protected:
 public:
 	void AddWeight(UAmbientBedWeightComponent* AmbientBedWeightComponent, UDA_AmbientBed* AmbientBed);
 	void RemoveWeight(UAmbientBedWeightComponent* AmbientBedWeightComponent, UDA_AmbientBed* AmbientBed);
+	void UpdateWeightLocation(UAmbientBedWeightComponent* AmbientBedWeightComponent, UDA_AmbientBed* AmbientBed);
+
+	void RegisterBakedLevel(ULevel* Level);
+	void UnregisterBakedLevel(ULevel* Level);
 };
 
 UCLASS(ClassGroup = "WwiserR")
@@ -263,8 +431,16 @@ public:
 
 	void AddWeight(UWorld* World, UAmbientBedWeightComponent* AmbientSoundWeightComponent, UDA_AmbientBed* AmbientBed);
 	void RemoveWeight(UWorld* World, UAmbientBedWeightComponent* AmbientSoundWeightComponent, UDA_AmbientBed* AmbientBed);
+	void UpdateWeightLocation(UWorld* World, UAmbientBedWeightComponent* AmbientSoundWeightComponent, UDA_AmbientBed* AmbientBed);
 
 protected:
+	AAmbientBedWorldManager* GetOrCreateWorldManager(UWorld* World);
+
 	void OnSpatialAudioListenerChanged(UWorld* NewWorld, UAkComponent* SpatialAudioListener);
 	void OnPostWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+	// baked weight fields of the loaded levels
+	void OnWorldInitializedActors(const FActorsInitializedParams& Params);
+	void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+	void OnLevelRemovedFromWorld(ULevel* Level, UWorld* World);
 };
@@ -0,0 +1,321 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#include "Managers/AmbientWeightField.h"
+#include "DataAssets/DA_AmbientBed.h"
+#include "Config/AudioConfig.h"
+#include "Core/AudioUtils.h"
+#include "AkAudioEvent.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreaming.h"
+#include "Engine/World.h"
+#include "Math/VectorRegister.h"
+#include "Algo/BinarySearch.h"
+
+namespace Private_AmbientWeightField
+{
+	static constexpr int32 Version = 2;
+
+	// identifies a weight as it was baked, in level space. Saved with the level, so only stable values (no addresses)
+	static uint32 GetBakedWeightHash(const UAmbientBedWeightComponent* AmbientBedWeightComponent, const FTransform& LevelTransform)
+	{
+		const ULevel* level = AmbientBedWeightComponent->GetComponentLevel();
+		const FVector location = LevelTransform.InverseTransformPosition(AmbientBedWeightComponent->GetComponentLocation());
+
+		uint32 hash = GetTypeHash(AmbientBedWeightComponent->GetPathName(level));
+		hash = HashCombine(hash, GetTypeHash(GetPathNameSafe(AmbientBedWeightComponent->AmbientBed)));
+		hash = HashCombine(hash, GetTypeHash(AAmbientBedWorldManager::GetGroupID(AmbientBedWeightComponent)));
+		hash = HashCombine(hash, GetTypeHash(AmbientBedWeightComponent->Weight));
+		return HashCombine(hash, GetTypeHash(FIntVector(FMath::RoundToInt(location.X), FMath::RoundToInt(location.Y),
+			FMath::RoundToInt(location.Z))));
+	}
+
+#if WITH_EDITOR
+	// weights of one cell while baking
+	struct FBakedCell
+	{
+		FVector WeightedLocation = FVector::ZeroVector;
+		double Weight = 0.;
+		uint32 NumWeights = 0;
+	};
+#endif
+} // namespace Private_AmbientWeightField
+
+#pragma region UAmbientWeightFieldDatabase
+void UAmbientWeightFieldDatabase::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	int32 version = Private_AmbientWeightField::Version;
+	Ar << version;
+
+	if (Ar.IsLoading() && version != Private_AmbientWeightField::Version)
+	{
+		// outdated, baked weights are missing until the level is resaved
+		Layers.Empty();
+		return;
+	}
+
+	Ar << CellSize;
+	Ar << Layers;
+	Ar << BakedWeightHashes;
+}
+
+bool UAmbientWeightFieldDatabase::ContainsWeight(const UAmbientBedWeightComponent* AmbientBedWeightComponent) const
+{
+	if (BakedWeightHashes.IsEmpty() || !IsValid(AmbientBedWeightComponent)) { return false; }
+
+	const uint32 hash = Private_AmbientWeightField::GetBakedWeightHash(AmbientBedWeightComponent,
+		GetLevelTransform(AmbientBedWeightComponent->GetComponentLevel()));
+
+	return Algo::BinarySearch(BakedWeightHashes, hash) != INDEX_NONE;
+}
+
+FTransform UAmbientWeightFieldDatabase::GetLevelTransform(const ULevel* Level)
+{
+	if (const ULevelStreaming* levelStreaming = IsValid(Level) ? ULevelStreaming::FindStreamingLevel(Level) : nullptr)
+	{
+		return levelStreaming->LevelTransform;
+	}
+
+	return FTransform::Identity;
+}
+
+#if WITH_EDITOR
+void UAmbientWeightFieldDatabase::BakeLevel(ULevel* Level)
+{
+	if (!IsValid(Level)) { return; }
+
+	Level->RemoveUserDataOfClass(UAmbientWeightFieldDatabase::StaticClass());
+
+	const UWwiserRGameSettings* audioConfig = GetDefault<UWwiserRGameSettings>();
+	if (!audioConfig->bUseBakedAmbientWeightFields) { return; }
+
+	// weights of partitioned worlds are saved in external actor packages, they stay components
+	const UWorld* world = Level->GetWorld();
+	if (IsValid(world) && world->IsPartitionedWorld())
+	{
+		for (AActor* actor : Level->Actors)
+		{
+			if (!IsValid(actor)) { continue; }
+
+			TInlineComponentArray<UAmbientBedWeightComponent*> ambientBedWeightComponents(actor);
+
+			if (ambientBedWeightComponents.ContainsByPredicate([](const UAmbientBedWeightComponent* AmbientBedWeightComponent)
+				{ return AmbientBedWeightComponent->bBakeIntoWeightField; }))
+			{
+				WR_DBG_STATIC_FUNC(Warning, "%s is a World Partition world, ambient bed weights marked bBakeIntoWeightField aren't baked",
+					*Level->GetOutermost()->GetName());
+				break;
+			}
+		}
+
+		return;
+	}
+
+	UAmbientWeightFieldDatabase* database = NewObject<UAmbientWeightFieldDatabase>(Level);
+	database->CellSize = FMath::Max(audioConfig->AmbientWeightFieldCellSize, 100.f);
+	const FTransform levelTransform = GetLevelTransform(Level);
+
+	TMap<TPair<UDA_AmbientBed*, int32>, TMap<FIntPoint, Private_AmbientWeightField::FBakedCell>> bakedGroups{};
+	int32 numBakedWeights = 0;
+
+	for (AActor* actor : Level->Actors)
+	{
+		if (!IsValid(actor)) { continue; }
+
+		TInlineComponentArray<UAmbientBedWeightComponent*> ambientBedWeightComponents(actor);
+
+		for (const UAmbientBedWeightComponent* ambientBedWeightComponent : ambientBedWeightComponents)
+		{
+			const UDA_AmbientBed* ambientBed = ambientBedWeightComponent->AmbientBed;
+
+			if (!ambientBedWeightComponent->bBakeIntoWeightField || ambientBedWeightComponent->Weight <= 0.f
+				|| !IsValid(ambientBed) || !IsValid(ambientBed->LoopEvent) || ambientBed->Range <= 0.f)
+			{
+				continue;
+			}
+
+			const FVector location = levelTransform.InverseTransformPosition(ambientBedWeightComponent->GetComponentLocation());
+			const FIntPoint cellKey(FMath::FloorToInt(location.X / database->CellSize), FMath::FloorToInt(location.Y / database->CellSize));
+
+			Private_AmbientWeightField::FBakedCell& cell = bakedGroups.FindOrAdd(
+				TPair<UDA_AmbientBed*, int32>(ambientBedWeightComponent->AmbientBed, AAmbientBedWorldManager::GetGroupID(ambientBedWeightComponent)))
+				.FindOrAdd(cellKey);
+
+			cell.WeightedLocation += ambientBedWeightComponent->Weight * location;
+			cell.Weight += ambientBedWeightComponent->Weight;
+			cell.NumWeights++;
+			numBakedWeights++;
+
+			database->BakedWeightHashes.Add(Private_AmbientWeightField::GetBakedWeightHash(ambientBedWeightComponent, levelTransform));
+		}
+	}
+
+	database->BakedWeightHashes.Sort();
+
+	for (TPair<TPair<UDA_AmbientBed*, int32>, TMap<FIntPoint, Private_AmbientWeightField::FBakedCell>>& bakedGroup : bakedGroups)
+	{
+		TMap<FIntPoint, Private_AmbientWeightField::FBakedCell>& cells = bakedGroup.Value;
+
+		cells.KeySort([](const FIntPoint& A, const FIntPoint& B) { return A.Y != B.Y ? A.Y < B.Y : A.X < B.X; });
+
+		FAmbientWeightFieldLayer& layer = database->Layers.AddDefaulted_GetRef();
+		layer.AmbientBedIndex = database->AmbientBeds.AddUnique(bakedGroup.Key.Key);
+		layer.GroupID = bakedGroup.Key.Value;
+		layer.Centroids.Reserve(cells.Num());
+		layer.Weights.Reserve(cells.Num());
+		layer.NumWeights.Reserve(cells.Num());
+		layer.CellX.Reserve(cells.Num());
+
+		for (const TPair<FIntPoint, Private_AmbientWeightField::FBakedCell>& cell : cells)
+		{
+			if (layer.RowY.IsEmpty() || layer.RowY.Last() != cell.Key.Y)
+			{
+				layer.RowY.Add(cell.Key.Y);
+				layer.RowStarts.Add(layer.CellX.Num());
+			}
+
+			layer.Centroids.Emplace(cell.Value.WeightedLocation / cell.Value.Weight);
+			layer.Weights.Add((float)cell.Value.Weight);
+			layer.NumWeights.Add(cell.Value.NumWeights);
+			layer.CellX.Add(cell.Key.X);
+		}
+
+		layer.RowStarts.Add(layer.CellX.Num());
+	}
+
+	if (!database->Layers.IsEmpty())
+	{
+		Level->AddAssetUserData(database);
+		WR_DBG_STATIC_FUNC(Log, "%i ambient bed weights baked into %i weight field layers in %s", numBakedWeights, database->Layers.Num(),
+			*Level->GetOutermost()->GetName());
+	}
+}
+#endif
+#pragma endregion
+
+#pragma region FAmbientWeightField
+FAmbientWeightField::FAmbientWeightField(const UAmbientWeightFieldDatabase& Database, const FAmbientWeightFieldLayer& Layer,
+	const FTransform& LevelTransform)
+	: AmbientBed(Database.AmbientBeds.IsValidIndex(Layer.AmbientBedIndex) ? Database.AmbientBeds[Layer.AmbientBedIndex] : nullptr)
+	, GroupID(Layer.GroupID)
+	, m_levelTransform(LevelTransform)
+	, m_origin(LevelTransform.GetLocation())
+	, m_cellSize(Database.CellSize)
+	, m_weights(Layer.Weights)
+	, m_numWeights(Layer.NumWeights)
+	, m_cellX(Layer.CellX)
+	, m_rowY(Layer.RowY)
+	, m_rowStarts(Layer.RowStarts)
+{
+	const int32 numCells = Layer.Centroids.Num();
+	m_centroidX.SetNumUninitialized(numCells);
+	m_centroidY.SetNumUninitialized(numCells);
+	m_centroidZ.SetNumUninitialized(numCells);
+	m_roomCaches.SetNum(numCells);
+
+	for (int32 i = 0; i < numCells; i++)
+	{
+		const FVector3f centroid(m_levelTransform.TransformPosition(FVector(Layer.Centroids[i])) - m_origin);
+		m_centroidX[i] = centroid.X;
+		m_centroidY[i] = centroid.Y;
+		m_centroidZ[i] = centroid.Z;
+	}
+}
+
+void FAmbientWeightField::GatherCells(const FVector& ReferencePosition, const FVector& ListenerPosition, float Range, int32 GroupIndex,
+	TArray<FAmbientWeightWorkItem>& OutWorkItems) const
+{
+	if (m_weights.IsEmpty() || m_cellSize <= 0.f) { return; }
+
+	// the grid is in level space, the range sphere maps onto itself
+	const FVector localReference = m_levelTransform.InverseTransformPosition(ReferencePosition);
+	const int32 minX = FMath::FloorToInt((localReference.X - Range) / m_cellSize);
+	const int32 maxX = FMath::FloorToInt((localReference.X + Range) / m_cellSize);
+	const int32 minY = FMath::FloorToInt((localReference.Y - Range) / m_cellSize);
+	const int32 maxY = FMath::FloorToInt((localReference.Y + Range) / m_cellSize);
+
+	const FVector3f reference(ReferencePosition - m_origin);
+	const FVector3f listener(ListenerPosition - m_origin);
+
+	for (int32 row = Algo::LowerBound(m_rowY, minY); row < m_rowY.Num() && m_rowY[row] <= maxY; row++)
+	{
+		const TConstArrayView<int32> rowCells(m_cellX.GetData() + m_rowStarts[row], m_rowStarts[row + 1] - m_rowStarts[row]);
+
+		GatherSpan(m_rowStarts[row] + Algo::LowerBound(rowCells, minX), m_rowStarts[row] + Algo::UpperBound(rowCells, maxX),
+			reference, listener, Range, GroupIndex, OutWorkItems);
+	}
+}
+
+void FAmbientWeightField::GatherSpan(int32 FirstCell, int32 LastCell, const FVector3f& Reference, const FVector3f& Listener, float Range,
+	int32 GroupIndex, TArray<FAmbientWeightWorkItem>& OutWorkItems) const
+{
+	const float rangeSquared = Range * Range;
+	const float invRange = 1.f / Range;
+
+	const VectorRegister4Float referenceX = VectorSetFloat1(Reference.X);
+	const VectorRegister4Float referenceY = VectorSetFloat1(Reference.Y);
+	const VectorRegister4Float referenceZ = VectorSetFloat1(Reference.Z);
+	const VectorRegister4Float listenerX = VectorSetFloat1(Listener.X);
+	const VectorRegister4Float listenerY = VectorSetFloat1(Listener.Y);
+	const VectorRegister4Float listenerZ = VectorSetFloat1(Listener.Z);
+	const VectorRegister4Float rangeSquaredV = VectorSetFloat1(rangeSquared);
+	const VectorRegister4Float invRangeV = VectorSetFloat1(invRange);
+
+	alignas(16) float relativeX[4];
+	alignas(16) float relativeY[4];
+	alignas(16) float relativeZ[4];
+
+	int32 cell = FirstCell;
+
+	for (; cell + 4 <= LastCell; cell += 4)
+	{
+		const VectorRegister4Float centroidX = VectorLoad(&m_centroidX[cell]);
+		const VectorRegister4Float centroidY = VectorLoad(&m_centroidY[cell]);
+		const VectorRegister4Float centroidZ = VectorLoad(&m_centroidZ[cell]);
+
+		const VectorRegister4Float offsetX = VectorSubtract(centroidX, referenceX);
+		const VectorRegister4Float offsetY = VectorSubtract(centroidY, referenceY);
+		const VectorRegister4Float offsetZ = VectorSubtract(centroidZ, referenceZ);
+		const VectorRegister4Float distanceSquared =
+			VectorMultiplyAdd(offsetX, offsetX, VectorMultiplyAdd(offsetY, offsetY, VectorMultiply(offsetZ, offsetZ)));
+
+		const uint32 inRangeMask = VectorMaskBits(VectorCompareLE(distanceSquared, rangeSquaredV));
+		if (inRangeMask == 0) { continue; }
+
+		// weight * (centroid - listener) / range
+		const VectorRegister4Float scale = VectorMultiply(VectorLoad(&m_weights[cell]), invRangeV);
+		VectorStoreAligned(VectorMultiply(VectorSubtract(centroidX, listenerX), scale), relativeX);
+		VectorStoreAligned(VectorMultiply(VectorSubtract(centroidY, listenerY), scale), relativeY);
+		VectorStoreAligned(VectorMultiply(VectorSubtract(centroidZ, listenerZ), scale), relativeZ);
+
+		for (int32 lane = 0; lane < 4; lane++)
+		{
+			if (inRangeMask & (1 << lane))
+			{
+				AddWorkItem(cell + lane, FVector3f(relativeX[lane], relativeY[lane], relativeZ[lane]), GroupIndex, OutWorkItems);
+			}
+		}
+	}
+
+	for (; cell < LastCell; cell++)
+	{
+		const FVector3f centroid(m_centroidX[cell], m_centroidY[cell], m_centroidZ[cell]);
+		if (FVector3f::DistSquared(centroid, Reference) > rangeSquared) { continue; }
+
+		AddWorkItem(cell, (centroid - Listener) * m_weights[cell] * invRange, GroupIndex, OutWorkItems);
+	}
+}
+
+void FAmbientWeightField::AddWorkItem(int32 Cell, const FVector3f& WeightedRelativePosition, int32 GroupIndex,
+	TArray<FAmbientWeightWorkItem>& OutWorkItems) const
+{
+	FAmbientWeightWorkItem& workItem = OutWorkItems.AddDefaulted_GetRef();
+	workItem.RoomCache = &m_roomCaches[Cell];
+	workItem.Location = m_origin + FVector(m_centroidX[Cell], m_centroidY[Cell], m_centroidZ[Cell]);
+	workItem.WeightedRelativePosition = FVector(WeightedRelativePosition);
+	workItem.Weight = m_weights[Cell];
+	workItem.NumWeights = m_numWeights[Cell];
+	workItem.GroupIndex = GroupIndex;
+}
+#pragma endregion
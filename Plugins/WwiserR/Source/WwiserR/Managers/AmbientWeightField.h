@@ -0,0 +1,122 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/AssetUserData.h"
+#include "Managers/AmbientBedManager.h"
+#include "AmbientWeightField.generated.h"
+
+class UDA_AmbientBed;
+class ULevel;
+class UAmbientBedWeightComponent;
+
+// baked weights of one bed group, merged per cell of a horizontal grid. Cells are sorted by row (Y), then by column (X)
+struct FAmbientWeightFieldLayer
+{
+	int32 AmbientBedIndex = INDEX_NONE;	// into UAmbientWeightFieldDatabase::AmbientBeds
+	int32 GroupID = -1;
+
+	// per cell
+	TArray<FVector3f> Centroids{};		// weighted centroid of the cell's weights, in level space
+	TArray<float> Weights{};			// summed weight
+	TArray<uint32> NumWeights{};
+	TArray<int32> CellX{};
+
+	// per row, RowStarts has one more entry than RowY
+	TArray<int32> RowY{};
+	TArray<int32> RowStarts{};
+
+	friend FArchive& operator<<(FArchive& Ar, FAmbientWeightFieldLayer& Layer)
+	{
+		return Ar << Layer.AmbientBedIndex << Layer.GroupID << Layer.Centroids << Layer.Weights << Layer.NumWeights << Layer.CellX
+			<< Layer.RowY << Layer.RowStarts;
+	}
+};
+
+/**
+ * AmbientWeightFieldDatabase
+ * --------------------------
+ *
+ * - ambient bed weights marked bBakeIntoWeightField, baked per FAmbientBedGroup into a sparse horizontal grid when the level is saved
+ *   or cooked, and stored as asset user data of the level
+ * - baked weight components are editor only, cooked levels keep a few floats per cell instead of a USceneComponent per weight
+ * - the database keeps a hash of each baked weight (path, ambient bed, group, weight and location), weights changed since the level
+ *   was saved aren't in it and are registered as components
+ * - World Partition worlds aren't baked, their weights are in external actor packages that aren't saved with the level
+ */
+UCLASS(ClassGroup = "WwiserR")
+class WWISERR_API UAmbientWeightFieldDatabase : public UAssetUserData
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<UDA_AmbientBed*> AmbientBeds{};
+
+	TArray<FAmbientWeightFieldLayer> Layers{};
+	TArray<uint32> BakedWeightHashes{};	// sorted
+	float CellSize = 0.f;
+
+public:
+	void Serialize(FArchive& Ar) override;
+
+	/** true if AmbientBedWeightComponent was baked into this database as it is now */
+	bool ContainsWeight(const UAmbientBedWeightComponent* AmbientBedWeightComponent) const;
+
+	/** transform of a (streamed) level in its world, weights are baked in level space */
+	static FTransform GetLevelTransform(const ULevel* Level);
+
+#if WITH_EDITOR
+	/** bakes the ambient bed weights of Level into a new database, the previous one is removed */
+	static void BakeLevel(ULevel* Level);
+#endif
+};
+
+/**
+ * AmbientWeightField
+ * ------------------
+ *
+ * - runtime sampler of one FAmbientWeightFieldLayer of a loaded level, centroids are stored as structures of arrays relative to an origin
+ * - gathers the in-range cells around a reference position: rows and columns overlapping the range are found by binary search, the
+ *   cells in between are range tested and weighted 4 at a time
+ * - gathered cells are aggregated like weight components, each cell caches the room at its centroid
+ */
+class WWISERR_API FAmbientWeightField
+{
+public:
+	UDA_AmbientBed* AmbientBed = nullptr;		// kept alive by the database
+	int32 GroupID = -1;
+
+protected:
+	FTransform m_levelTransform = FTransform::Identity;
+	FVector m_origin = FVector::ZeroVector;
+	float m_cellSize = 0.f;
+
+	// per cell
+	TArray<float> m_centroidX{};
+	TArray<float> m_centroidY{};
+	TArray<float> m_centroidZ{};
+	TArray<float> m_weights{};
+	TArray<uint32> m_numWeights{};
+	TArray<int32> m_cellX{};
+	mutable TArray<FAmbientWeightRoomCache> m_roomCaches{};
+
+	// per row
+	TArray<int32> m_rowY{};
+	TArray<int32> m_rowStarts{};
+
+public:
+	FAmbientWeightField(const UAmbientWeightFieldDatabase& Database, const FAmbientWeightFieldLayer& Layer, const FTransform& LevelTransform);
+
+	/** adds a work item for each cell with its centroid within Range of ReferencePosition */
+	void GatherCells(const FVector& ReferencePosition, const FVector& ListenerPosition, float Range, int32 GroupIndex,
+		TArray<FAmbientWeightWorkItem>& OutWorkItems) const;
+
+	FORCEINLINE int32 NumCells() const { return m_weights.Num(); }
+
+protected:
+	void GatherSpan(int32 FirstCell, int32 LastCell, const FVector3f& Reference, const FVector3f& Listener, float Range, int32 GroupIndex,
+		TArray<FAmbientWeightWorkItem>& OutWorkItems) const;
+	void AddWorkItem(int32 Cell, const FVector3f& WeightedRelativePosition, int32 GroupIndex, TArray<FAmbientWeightWorkItem>& OutWorkItems) const;
+};
@@ -0,0 +1,464 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#include "DistanceCullingManager.h"
+#include "SoundEmitters/SoundEmitterComponent.h"
+#include "Managers/SoundListenerManager.h"
+#include "Core/AudioUtils.h"
+#include "Config/AudioConfig.h"
+#include "Core/AudioSubsystem.h"
+#include "Engine/World.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Distance Culling Reculls"), STAT_WwiserR_DistanceCullingReculls, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Distance Culling Reculls Pending"), STAT_WwiserR_DistanceCullingRecullsPending, STATGROUP_WwiserR);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Distance Culling Recull Time (ms)"), STAT_WwiserR_DistanceCullingRecullTime, STATGROUP_WwiserR);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Distance Culling Last Recull Drain Time (ms)"), STAT_WwiserR_DistanceCullingLastDrainTime, STATGROUP_WwiserR);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Distance Culling Last Recull Drain Frames"), STAT_WwiserR_DistanceCullingLastDrainFrames, STATGROUP_WwiserR);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Distance Culling Last Recull Drain Emitters"), STAT_WwiserR_DistanceCullingLastDrainEmitters, STATGROUP_WwiserR);
+
+#pragma region CVars
+namespace Private_DistanceCullingManager
+{
+	static TAutoConsoleVariable<bool> CVar_DistanceCulling_DebugConsole(TEXT("WwiserR.DistanceCulling.DebugToConsole"), false,
+		TEXT("Log emitters deferred to the next frame due to the distance culling budget. (0 = off, 1 = on)"), ECVF_Cheat);
+	static TAutoConsoleVariable<bool> CVar_DistanceCulling_BatchKernel(TEXT("WwiserR.DistanceCulling.BatchKernel"), false,
+		TEXT("Cull all due loops at once using the vectorized batch kernel. (0 = per emitter, 1 = batched)"), ECVF_Cheat);
+	static TAutoConsoleVariable<float> CVar_DistanceCulling_RecullBudgetMs(TEXT("WwiserR.DistanceCulling.RecullBudgetMs"), -1.f,
+		TEXT("Override the time budget in ms per frame to recull emitters after a listener teleport. (-1 = use project settings, 0 = unlimited)"), ECVF_Cheat);
+	static TAutoConsoleVariable<int32> CVar_DistanceCulling_MaxCullsPerFrame(TEXT("WwiserR.DistanceCulling.MaxCullsPerFrame"), -1,
+		TEXT("Override the maximum amount of emitters culled per frame and per world. (-1 = use project settings, 0 = unlimited)"), ECVF_Cheat);
+
+	bool bDebugConsole = false;
+	bool bBatchKernel = false;
+	int32 iMaxCullsPerFrameOverride = -1;
+	float fRecullBudgetMsOverride = -1.f;
+
+	static void OnDistanceCullingManagerUpdate()
+	{
+		bDebugConsole = CVar_DistanceCulling_DebugConsole.GetValueOnGameThread();
+		bBatchKernel = CVar_DistanceCulling_BatchKernel.GetValueOnGameThread();
+		iMaxCullsPerFrameOverride = CVar_DistanceCulling_MaxCullsPerFrame.GetValueOnGameThread();
+		fRecullBudgetMsOverride = CVar_DistanceCulling_RecullBudgetMs.GetValueOnGameThread();
+	}
+
+	FAutoConsoleVariableSink CDistanceCullingManagerConsoleSink(FConsoleCommandDelegate::CreateStatic(&OnDistanceCullingManagerUpdate));
+} // namespace Private_DistanceCullingManager
+#pragma endregion
+
+void UDistanceCullingManager::Initialize(USoundListenerManager* SoundListenerManager)
+{
+	m_listenerManager = SoundListenerManager;
+	m_maxCullsPerFrame = GetDefault<UWwiserRGameSettings>()->MaxDistanceCullsPerFrame;
+	m_recullBudgetMs = GetDefault<UWwiserRGameSettings>()->RecullBudgetMs;
+	FWorldDelegates::OnPostWorldCleanup.AddUObject(this, &UDistanceCullingManager::OnPostWorldCleanup);
+
+	WR_DBG_NET(Log, "initialized (%s)", *UAudioUtils::GetClientOrServerString(GetWorld()));
+}
+
+void UDistanceCullingManager::Deinitialize()
+{
+	FWorldDelegates::OnPostWorldCleanup.RemoveAll(this);
+
+	m_worldSchedulers.Empty();
+	m_dueEntries.Empty();
+	m_recullQueue.Empty();
+	m_batchedEmitters.Empty();
+	m_batchedLoopIndices.Empty();
+	m_listenerManager = nullptr;
+
+	WR_DBG_NET(Log, "deinitialized (%s)", *UAudioUtils::GetClientOrServerString(GetWorld()));
+}
+
+void UDistanceCullingManager::ScheduleDistanceCulling(USoundEmitterComponent* SoundEmitter, double CullTime)
+{
+	if (!IsValid(SoundEmitter)) { return; }
+
+	UWorld* world = SoundEmitter->GetWorld();
+	if (!IsValid(world)) { return; }
+
+	// invalidates any previously scheduled entry for this emitter
+	const uint32 serial = ++SoundEmitter->m_distanceCullSerial;
+
+	if (!FMath::IsFinite(CullTime)) { return; }
+
+	FDistanceCullingWorldScheduler& scheduler = m_worldSchedulers.FindOrAdd(world);
+	scheduler.Heap.HeapPush(FDistanceCullingEntry(CullTime, SoundEmitter, serial), FDistanceCullingEntryPredicate());
+
+	CompactIfNeeded(scheduler);
+}
+
+void UDistanceCullingManager::CancelDistanceCulling(USoundEmitterComponent* SoundEmitter)
+{
+	if (IsValid(SoundEmitter))
+	{
+		++SoundEmitter->m_distanceCullSerial;
+	}
+}
+
+void UDistanceCullingManager::QueueRecull(USoundEmitterComponent* SoundEmitter)
+{
+	if (!IsValid(SoundEmitter) || SoundEmitter->m_bRecullPending) { return; }
+
+	SoundEmitter->m_bRecullPending = true;
+	m_recullQueue.Emplace(SoundEmitter);
+	m_bRecullQueueNeedsSorting = true;
+
+#if !UE_BUILD_SHIPPING
+	if (m_dbgRecullDrainFrames == 0 && m_dbgNumReculled == 0)
+	{
+		m_dbgRecullDrainStartTime = FPlatformTime::Seconds();
+	}
+#endif
+}
+
+bool UDistanceCullingManager::IsEntryValid(const FDistanceCullingEntry& Entry)
+{
+	const USoundEmitterComponent* soundEmitter = Entry.SoundEmitter.Get();
+	return IsValid(soundEmitter) && soundEmitter->m_distanceCullSerial == Entry.Serial;
+}
+
+void UDistanceCullingManager::GatherDueEntries(const double CurrentTime, FDistanceCullingWorldScheduler& Scheduler)
+{
+	const int32 maxCullsPerFrame = Private_DistanceCullingManager::iMaxCullsPerFrameOverride >= 0 ?
+		Private_DistanceCullingManager::iMaxCullsPerFrameOverride : m_maxCullsPerFrame;
+
+	int32 numGathered = 0;
+
+	while (!Scheduler.Heap.IsEmpty() && Scheduler.Heap.HeapTop().CullTime <= CurrentTime)
+	{
+		if (maxCullsPerFrame > 0 && numGathered >= maxCullsPerFrame)
+		{
+#if !UE_BUILD_SHIPPING
+			m_dbgNumDeferred++;
+#endif
+			break;
+		}
+
+		FDistanceCullingEntry entry;
+		Scheduler.Heap.HeapPop(entry, FDistanceCullingEntryPredicate(), false);
+
+		if (IsEntryValid(entry))
+		{
+			m_dueEntries.Emplace(MoveTemp(entry));
+			numGathered++;
+		}
+	}
+}
+
+void UDistanceCullingManager::CompactIfNeeded(FDistanceCullingWorldScheduler& Scheduler)
+{
+	// stale entries are only removed when popped, so rescheduled far-away emitters can pile up in the heap
+	if (Scheduler.Heap.Num() < Scheduler.CompactionThreshold) { return; }
+
+	Scheduler.Heap.RemoveAllSwap([](const FDistanceCullingEntry& Entry) { return !IsEntryValid(Entry); });
+	Scheduler.Heap.Heapify(FDistanceCullingEntryPredicate());
+	Scheduler.CompactionThreshold = FMath::Max(256, Scheduler.Heap.Num() * 2);
+}
+
+void UDistanceCullingManager::Tick(float DeltaTime)
+{
+	if (m_lastTickFrame == GFrameCounter) { return; }
+	m_lastTickFrame = GFrameCounter;
+
+	if (!m_recullQueue.IsEmpty())
+	{
+		DrainRecullQueue();
+	}
+
+	m_dueEntries.Reset();
+
+	for (TPair<UWorld*, FDistanceCullingWorldScheduler>& worldScheduler : m_worldSchedulers)
+	{
+		if (IsValid(worldScheduler.Key))
+		{
+			GatherDueEntries(worldScheduler.Key->GetTimeSeconds(), worldScheduler.Value);
+		}
+	}
+
+	if (!m_dueEntries.IsEmpty())
+	{
+		if (Private_DistanceCullingManager::bBatchKernel && IsValid(m_listenerManager))
+		{
+			CullDueEntriesBatched();
+		}
+		else
+		{
+			CullDueEntries();
+		}
+	}
+
+#if !UE_BUILD_SHIPPING
+	if (Private_DistanceCullingManager::bDebugConsole && m_dbgNumDeferred > 0)
+	{
+		WR_DBG_FUNC(Log, "culled %i emitters, deferred remaining due emitters in %i world(s) to the next frame",
+			m_dbgNumCulled, m_dbgNumDeferred);
+	}
+
+	m_dbgNumCulled = 0;
+	m_dbgNumDeferred = 0;
+#endif
+}
+
+void UDistanceCullingManager::DrainRecullQueue()
+{
+	// sort on distance to the (new) distance probe position once new requests came in, so the nearest emitters are reculled first
+	if (m_bRecullQueueNeedsSorting)
+	{
+		const FVector distanceProbePosition = IsValid(m_listenerManager) ? m_listenerManager->GetDistanceProbePosition() : FVector::ZeroVector;
+
+		for (FRecullEntry& entry : m_recullQueue)
+		{
+			if (const USoundEmitterComponent* soundEmitter = entry.SoundEmitter.Get())
+			{
+				entry.DistanceSquared = FVector::DistSquared(soundEmitter->GetCullingLocation(), distanceProbePosition);
+			}
+		}
+
+		m_recullQueue.Sort([](const FRecullEntry& A, const FRecullEntry& B) { return A.DistanceSquared > B.DistanceSquared; });
+		m_bRecullQueueNeedsSorting = false;
+	}
+
+	const float recullBudgetMs = Private_DistanceCullingManager::fRecullBudgetMsOverride >= 0.f ?
+		Private_DistanceCullingManager::fRecullBudgetMsOverride : m_recullBudgetMs;
+	const double frameStartTime = FPlatformTime::Seconds();
+	const double endTime = frameStartTime + recullBudgetMs / 1000.;
+	uint32 numReculled = 0;
+
+	// at least one emitter is reculled each frame to guarantee progress
+	do
+	{
+		USoundEmitterComponent* soundEmitter = m_recullQueue.Pop(false).SoundEmitter.Get();
+
+		// emitters that were reculled synchronously in the meantime are no longer pending
+		if (IsValid(soundEmitter) && soundEmitter->m_bRecullPending)
+		{
+			soundEmitter->RecullAllLoops();
+			numReculled++;
+		}
+	} while (!m_recullQueue.IsEmpty() && (recullBudgetMs <= 0.f || FPlatformTime::Seconds() < endTime));
+
+	SET_DWORD_STAT(STAT_WwiserR_DistanceCullingReculls, numReculled);
+	SET_DWORD_STAT(STAT_WwiserR_DistanceCullingRecullsPending, m_recullQueue.Num());
+	SET_FLOAT_STAT(STAT_WwiserR_DistanceCullingRecullTime, (FPlatformTime::Seconds() - frameStartTime) * 1000.);
+
+#if !UE_BUILD_SHIPPING
+	m_dbgNumReculled += numReculled;
+	m_dbgRecullDrainFrames++;
+
+	if (m_recullQueue.IsEmpty())
+	{
+		// wall clock time from the first request until the queue is empty
+		const double drainTimeMs = (FPlatformTime::Seconds() - m_dbgRecullDrainStartTime) * 1000.;
+
+		SET_FLOAT_STAT(STAT_WwiserR_DistanceCullingLastDrainTime, drainTimeMs);
+		SET_DWORD_STAT(STAT_WwiserR_DistanceCullingLastDrainFrames, m_dbgRecullDrainFrames);
+		SET_DWORD_STAT(STAT_WwiserR_DistanceCullingLastDrainEmitters, m_dbgNumReculled);
+
+		if (Private_DistanceCullingManager::bDebugConsole)
+		{
+			WR_DBG_FUNC(Log, "recull queue drained: %i emitters reculled in %.3f ms over %i frame(s)",
+				m_dbgNumReculled, drainTimeMs, m_dbgRecullDrainFrames);
+		}
+
+		m_dbgRecullDrainFrames = 0;
+		m_dbgNumReculled = 0;
+	}
+#endif
+}
+
+void UDistanceCullingManager::CullDueEntries()
+{
+	// emitters rescheduled while culling are pushed onto the heap and evaluated on the next frame at the earliest
+	for (const FDistanceCullingEntry& entry : m_dueEntries)
+	{
+		if (IsEntryValid(entry))
+		{
+			entry.SoundEmitter->DistanceCull();
+
+#if !UE_BUILD_SHIPPING
+			m_dbgNumCulled++;
+#endif
+		}
+	}
+}
+
+void UDistanceCullingManager::CullDueEntriesBatched()
+{
+	GatherListeners();
+
+	m_loopBatch.Reset(m_listenerBatch.Origin);
+	m_batchedEmitters.Reset();
+	m_batchedLoopIndices.Reset();
+
+	// gather loop records, emitters that can't be batched are culled individually
+	for (const FDistanceCullingEntry& entry : m_dueEntries)
+	{
+		if (!IsEntryValid(entry)) { continue; }
+
+		USoundEmitterComponent* soundEmitter = entry.SoundEmitter.Get();
+		const int32 firstRecord = m_loopBatch.Num();
+
+		if (soundEmitter->AddLoopsToCullingBatch(m_loopBatch, m_batchedLoopIndices))
+		{
+			m_batchedEmitters.Add(FBatchedCullingEmitter{ soundEmitter, firstRecord, m_loopBatch.Num() - firstRecord });
+		}
+		else
+		{
+			soundEmitter->DistanceCull();
+		}
+
+#if !UE_BUILD_SHIPPING
+		m_dbgNumCulled++;
+#endif
+	}
+
+	// next cull times are calculated relative to the current time of each emitter's world
+	WR_DistanceCulling::CullLoopsVectorized(m_listenerBatch, m_loopBatch, 0.);
+
+	for (const FBatchedCullingEmitter& batchedEmitter : m_batchedEmitters)
+	{
+		if (IsValid(batchedEmitter.SoundEmitter))
+		{
+			batchedEmitter.SoundEmitter->ApplyCullingBatchResults(
+				m_loopBatch, m_batchedLoopIndices, batchedEmitter.FirstRecord, batchedEmitter.NumRecords);
+		}
+	}
+}
+
+void UDistanceCullingManager::GatherListeners()
+{
+	const FListenerSnapshot& listenerSnapshot = m_listenerManager->GetListenerSnapshot();
+
+	// listeners haven't changed since the last batch
+	if (listenerSnapshot.Version == m_listenerSnapshotVersion && m_listenerBatch.Num() > 0) { return; }
+	m_listenerSnapshotVersion = listenerSnapshot.Version;
+
+	m_listenerBatch.Reset(m_listenerManager->GetDistanceProbePosition());
+
+	for (const FListenerSnapshotEntry& listener : listenerSnapshot.Listeners)
+	{
+		m_listenerBatch.Add(listener.Position, listener.MaxSpeed);
+	}
+}
+
+void UDistanceCullingManager::OnPostWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	m_worldSchedulers.Remove(World);
+}
+
+#pragma region Benchmark
+#if !UE_BUILD_SHIPPING
+void UDistanceCullingManager::RunEmitterBenchmark(UWorld* World, int32 Iterations)
+{
+	const FDistanceCullingWorldScheduler* scheduler = m_worldSchedulers.Find(World);
+	if (!scheduler || !IsValid(m_listenerManager))
+	{
+		WR_DBG_FUNC(Warning, "no scheduled emitters in this world");
+		return;
+	}
+
+	// emitters as the scheduler would cull them next: only the cued loop, and only emitters the kernel can take
+	TArray<USoundEmitterComponent*> soundEmitters;
+	TSet<USoundEmitterComponent*> uniqueEmitters;
+
+	for (const FDistanceCullingEntry& entry : scheduler->Heap)
+	{
+		USoundEmitterComponent* soundEmitter = entry.SoundEmitter.Get();
+		if (!IsEntryValid(entry) || soundEmitter->m_bMustRecalculateAllLoopCullTimes || uniqueEmitters.Contains(soundEmitter)) { continue; }
+
+		m_loopBatch.Reset(FVector::ZeroVector);
+		m_batchedLoopIndices.Reset();
+
+		if (soundEmitter->AddLoopsToCullingBatch(m_loopBatch, m_batchedLoopIndices))
+		{
+			soundEmitters.Add(soundEmitter);
+			uniqueEmitters.Add(soundEmitter);
+		}
+	}
+
+	if (soundEmitters.IsEmpty())
+	{
+		WR_DBG_FUNC(Warning, "no emitters with batchable loops scheduled in this world");
+		return;
+	}
+
+	const double currentTime = World->GetTimeSeconds();
+	TArray<bool> emitterInRange;
+	TArray<double> emitterNextCullTimes;
+	emitterInRange.SetNum(soundEmitters.Num());
+	emitterNextCullTimes.SetNum(soundEmitters.Num());
+
+	// per emitter path: the range test and next cull time of CullByDistance, without (de)virtualizing. Cull times are restored
+	double startTime = FPlatformTime::Seconds();
+	for (int32 iteration = 0; iteration < Iterations; iteration++)
+	{
+		for (int32 i = 0; i < soundEmitters.Num(); i++)
+		{
+			USoundEmitterComponent* soundEmitter = soundEmitters[i];
+			FPlayingAudioLoop& loop = soundEmitter->m_culledPlayingLoops[soundEmitter->m_nextCullIndex];
+			const double scheduledCullTime = loop.NextCullTime;
+			const FCharachterMovementData characterMovementData = soundEmitter->m_characterMovementData;
+
+			emitterInRange[i] = soundEmitter->IsInListenerRange(loop.AkEvent, loop.AttenuationRangeBuffer);
+			emitterNextCullTimes[i] = soundEmitter->CalculateAndSetNextLoopCullTime(loop) - currentTime;
+
+			loop.NextCullTime = scheduledCullTime;
+			soundEmitter->m_characterMovementData = characterMovementData;
+		}
+	}
+	const double perEmitterMs = (FPlatformTime::Seconds() - startTime) * 1000. / Iterations;
+
+	// batched path: gathering the loop records and the kernel, without applying the results
+	startTime = FPlatformTime::Seconds();
+	for (int32 iteration = 0; iteration < Iterations; iteration++)
+	{
+		m_listenerSnapshotVersion = 0;
+		GatherListeners();
+
+		m_loopBatch.Reset(m_listenerBatch.Origin);
+		m_batchedLoopIndices.Reset();
+
+		for (USoundEmitterComponent* soundEmitter : soundEmitters)
+		{
+			soundEmitter->AddLoopsToCullingBatch(m_loopBatch, m_batchedLoopIndices);
+		}
+
+		WR_DistanceCulling::CullLoopsVectorized(m_listenerBatch, m_loopBatch, 0.);
+	}
+	const double batchedMs = (FPlatformTime::Seconds() - startTime) * 1000. / Iterations;
+
+	// one record per emitter, the cued loop
+	int32 numMismatches = 0;
+	for (int32 i = 0; i < soundEmitters.Num(); i++)
+	{
+		if (emitterInRange[i] != (m_loopBatch.bInRange[i] != 0)
+			|| !WR_DistanceCulling::IsSameCullTime(emitterNextCullTimes[i], m_loopBatch.NextCullTime[i]))
+		{
+			numMismatches++;
+		}
+	}
+
+	WR_DBG_FUNC(Log, "%i emitters x %i listeners : per emitter %.4f ms, batched %.4f ms (x%.2f), mismatches: %i",
+		soundEmitters.Num(), m_listenerBatch.Num(), perEmitterMs, batchedMs, batchedMs > 0. ? perEmitterMs / batchedMs : 0., numMismatches);
+
+	m_loopBatch.Reset(FVector::ZeroVector);
+	m_batchedLoopIndices.Reset();
+}
+
+namespace Private_DistanceCullingManager
+{
+	static void RunEmitterBenchmark(const TArray<FString>& Args, UWorld* World)
+	{
+		UAudioSubsystem* audioSubsystem = UAudioSubsystem::Get(World);
+		UDistanceCullingManager* distanceCullingManager = audioSubsystem ? audioSubsystem->GetDistanceCullingManager() : nullptr;
+		if (!IsValid(distanceCullingManager)) { return; }
+
+		distanceCullingManager->RunEmitterBenchmark(World, Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100);
+	}
+
+	static FAutoConsoleCommand CCmd_DistanceCulling_EmitterBenchmark(TEXT("WwiserR.DistanceCulling.EmitterBenchmark"),
+		TEXT("Compares the per emitter distance culling path with the batch kernel on the scheduled emitters of the current world. ")
+		TEXT("(optional: iterations, default 100)"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunEmitterBenchmark), ECVF_Cheat);
+} // namespace Private_DistanceCullingManager
+#endif
+#pragma endregion
@@ -0,0 +1,150 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Tickable.h"
+#include "Core/DistanceCullingKernel.h"
+#include "DistanceCullingManager.generated.h"
+
+class USoundEmitterComponent;
+
+// scheduled distance culling pass for a sound emitter, entries are invalidated lazily by comparing serials
+struct FDistanceCullingEntry
+{
+	double CullTime = INFINITY;
+	TWeakObjectPtr<USoundEmitterComponent> SoundEmitter{};
+	uint32 Serial = 0;
+
+	FDistanceCullingEntry() {}
+	FDistanceCullingEntry(double a_CullTime, USoundEmitterComponent* a_SoundEmitter, uint32 a_Serial)
+		: CullTime(a_CullTime)
+		, SoundEmitter(a_SoundEmitter)
+		, Serial(a_Serial)
+	{}
+};
+
+struct FDistanceCullingEntryPredicate
+{
+	FORCEINLINE bool operator()(const FDistanceCullingEntry& A, const FDistanceCullingEntry& B) const
+	{
+		return A.CullTime < B.CullTime;
+	}
+};
+
+// sound emitter waiting to recull all its loops, sorted on its squared distance to the distance probe
+struct FRecullEntry
+{
+	TWeakObjectPtr<USoundEmitterComponent> SoundEmitter{};
+	float DistanceSquared = 0.f;
+
+	FRecullEntry() {}
+	FRecullEntry(USoundEmitterComponent* a_SoundEmitter) : SoundEmitter(a_SoundEmitter) {}
+};
+
+// range of loop records in the culling batch belonging to one sound emitter
+struct FBatchedCullingEmitter
+{
+	USoundEmitterComponent* SoundEmitter{};
+	int32 FirstRecord{};
+	int32 NumRecords{};
+};
+
+// min-heap of scheduled distance culling passes within one world
+struct FDistanceCullingWorldScheduler
+{
+	TArray<FDistanceCullingEntry> Heap{};
+	int32 CompactionThreshold = 256;
+};
+
+/**
+ * DistanceCullingManager
+ * ----------------------
+ *
+ * - schedules distance culling passes of all SoundEmitterComponents, replacing per-emitter timers
+ * - keeps a min-heap per world, keyed on the emitter's next cull time (double precision world time)
+ * - processes all due emitters in one batched pass per frame, within a configurable per-frame budget. Emitters exceeding the budget are
+ *   deferred to the next frame
+ * - amortizes full reculls (listener teleported, listeners changed) over multiple frames: requests are queued and drained nearest to
+ *   the distance probe first, within a per-frame time budget. Emitters waiting in the queue are flagged as stale
+ * - optionally (WwiserR.DistanceCulling.BatchKernel) culls all due loops at once with a vectorized kernel, against the listener manager's
+ *   listener snapshot, which is only regathered when its version changes
+ */
+UCLASS(ClassGroup = "WwiserR")
+class WWISERR_API UDistanceCullingManager : public UObject, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY() class USoundListenerManager* m_listenerManager {};
+
+	TMap<UWorld*, FDistanceCullingWorldScheduler> m_worldSchedulers{};
+	TArray<FDistanceCullingEntry> m_dueEntries{};	// persistent scratch buffer
+	int32 m_maxCullsPerFrame = 0;
+
+	// recull queue, nearest emitter at the end
+	TArray<FRecullEntry> m_recullQueue{};
+	bool m_bRecullQueueNeedsSorting = false;
+	float m_recullBudgetMs = 0.f;
+
+	// batch kernel, persistent scratch buffers
+	FCullingListenerBatch m_listenerBatch{};
+	uint32 m_listenerSnapshotVersion = 0;
+	FCullingLoopBatch m_loopBatch{};
+	TArray<FBatchedCullingEmitter> m_batchedEmitters{};
+	TArray<int32> m_batchedLoopIndices{};
+
+private:
+	uint32 m_lastTickFrame = INDEX_NONE;
+
+#if !UE_BUILD_SHIPPING
+	uint32 m_dbgNumCulled = 0;
+	uint32 m_dbgNumDeferred = 0;
+
+	double m_dbgRecullDrainStartTime = 0.;
+	uint32 m_dbgRecullDrainFrames = 0;
+	uint32 m_dbgNumReculled = 0;
+#endif
+
+public:
+	void Initialize(USoundListenerManager* SoundListenerManager);
+	void Deinitialize();
+
+	/** (re)schedules the next distance culling pass of SoundEmitter at CullTime (world time in seconds), invalidating a previous one */
+	void ScheduleDistanceCulling(USoundEmitterComponent* SoundEmitter, double CullTime);
+
+	/** invalidates the scheduled distance culling pass of SoundEmitter */
+	void CancelDistanceCulling(USoundEmitterComponent* SoundEmitter);
+
+	/** queues a recull of all loops of SoundEmitter, which is flagged as stale until it is reculled */
+	void QueueRecull(USoundEmitterComponent* SoundEmitter);
+
+protected:
+	void GatherDueEntries(const double CurrentTime, FDistanceCullingWorldScheduler& Scheduler);
+	void DrainRecullQueue();
+	void CullDueEntries();
+	void CullDueEntriesBatched();
+	void GatherListeners();
+	void CompactIfNeeded(FDistanceCullingWorldScheduler& Scheduler);
+	void OnPostWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+	static bool IsEntryValid(const FDistanceCullingEntry& Entry);
+
+#if !UE_BUILD_SHIPPING
+public:
+	/** times the cued loops of all scheduled emitters of World through the per emitter path and the batch kernel, without culling them */
+	void RunEmitterBenchmark(UWorld* World, int32 Iterations);
+#endif
+
+#pragma region Tick
+public:
+	void Tick(float DeltaTime) override;
+
+	FORCEINLINE bool IsTickable() const override { return !m_worldSchedulers.IsEmpty() || !m_recullQueue.IsEmpty(); }
+	FORCEINLINE ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	FORCEINLINE TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UDistanceCullingManager, STATGROUP_Tickables); }
+	FORCEINLINE bool IsTickableWhenPaused() const override { return false; }
+	FORCEINLINE bool IsTickableInEditor() const override { return false; }
+#pragma endregion
+};
@@ -0,0 +1,226 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#include "GameObjectPositionManager.h"
+#include "Core/AudioUtils.h"
+#include "Config/AudioConfig.h"
+#include "AkAudioDevice.h"
+#include "AkComponent.h"
+#include "WwiseSoundEngine/Public/Wwise/API/WwiseSoundEngineAPI.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Position Uploads Sent"), STAT_WwiserR_PositionUploadsSent, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Position Uploads Skipped"), STAT_WwiserR_PositionUploadsSkipped, STATGROUP_WwiserR);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Position Managed Game Objects"), STAT_WwiserR_PositionManagedGameObjects, STATGROUP_WwiserR);
+
+#pragma region CVars
+namespace Private_GameObjectPositionManager
+{
+	static TAutoConsoleVariable<bool> CVar_PositionUpload_DebugConsole(TEXT("WwiserR.PositionUpload.DebugToConsole"), false,
+		TEXT("Log the number of sent and skipped position uploads each second. (0 = off, 1 = on)"), ECVF_Cheat);
+
+	bool bDebugConsole = false;
+
+	static void OnGameObjectPositionManagerUpdate()
+	{
+		bDebugConsole = CVar_PositionUpload_DebugConsole.GetValueOnGameThread();
+	}
+
+	FAutoConsoleVariableSink CGameObjectPositionManagerConsoleSink(FConsoleCommandDelegate::CreateStatic(&OnGameObjectPositionManagerUpdate));
+} // namespace Private_GameObjectPositionManager
+#pragma endregion
+
+void UGameObjectPositionManager::Initialize()
+{
+	const UWwiserRGameSettings* audioConfig = GetDefault<UWwiserRGameSettings>();
+	m_locationEpsilonSquared = FMath::Square(audioConfig->PositionUploadLocationEpsilon);
+	m_rotationEpsilon = FMath::DegreesToRadians(audioConfig->PositionUploadRotationEpsilon);
+
+	WR_DBG_NET(Log, "initialized (%s)", *UAudioUtils::GetClientOrServerString(GetWorld()));
+}
+
+void UGameObjectPositionManager::Deinitialize()
+{
+	while (!m_entries.IsEmpty())
+	{
+		if (USceneComponent* component = m_entries.Last().Component.Get())
+		{
+			UnregisterComponent(component);
+		}
+		else
+		{
+			RemoveEntry(m_entries.Num() - 1);
+		}
+	}
+
+	m_dirtyGameObjects.Empty();
+
+	WR_DBG_NET(Log, "deinitialized (%s)", *UAudioUtils::GetClientOrServerString(GetWorld()));
+}
+
+void UGameObjectPositionManager::RegisterComponent(USceneComponent* Component)
+{
+	if (!IsValid(Component)) { return; }
+
+	const AkGameObjectID gameObjectID = (AkGameObjectID)Component;
+
+	if (const int32* existingIndex = m_entryIndices.Find(gameObjectID))
+	{
+		if (m_entries[*existingIndex].Component.Get() == Component) { return; }
+
+		// a destroyed component left a stale entry behind at the same address
+		RemoveEntry(*existingIndex);
+	}
+
+	UAkComponent* akComponent = Cast<UAkComponent>(Component);
+
+	if (akComponent)
+	{
+		akComponent->SetDeferPositionUpdates(true);
+	}
+
+	const int32 index = m_entries.Emplace(Component, akComponent);
+	m_entryIndices.Add(gameObjectID, index);
+
+	Component->TransformUpdated.AddUObject(this, &UGameObjectPositionManager::OnTransformUpdated);
+	Upload(m_entries[index], Component->GetComponentTransform());
+
+	INC_DWORD_STAT(STAT_WwiserR_PositionManagedGameObjects);
+}
+
+void UGameObjectPositionManager::UnregisterComponent(USceneComponent* Component)
+{
+	if (!Component) { return; }
+
+	const int32* index = m_entryIndices.Find((AkGameObjectID)Component);
+	if (index == nullptr || m_entries[*index].Component.Get() != Component) { return; }
+
+	Component->TransformUpdated.RemoveAll(this);
+
+	if (UAkComponent* akComponent = m_entries[*index].AkComponent.Get())
+	{
+		akComponent->SetDeferPositionUpdates(false);
+	}
+
+	RemoveEntry(*index);
+}
+
+void UGameObjectPositionManager::OnTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags,
+	ETeleportType Teleport)
+{
+	const AkGameObjectID gameObjectID = (AkGameObjectID)UpdatedComponent;
+	const int32* index = m_entryIndices.Find(gameObjectID);
+	if (index == nullptr) { return; }
+
+	FPositionUploadEntry& entry = m_entries[*index];
+
+	if (!entry.bDirty)
+	{
+		entry.bDirty = true;
+		m_dirtyGameObjects.Add(gameObjectID);
+	}
+}
+
+bool UGameObjectPositionManager::ShouldUpload(const FPositionUploadEntry& Entry, const FTransform& Transform) const
+{
+	return FVector::DistSquared(Entry.UploadedLocation, Transform.GetLocation()) > m_locationEpsilonSquared
+		|| Entry.UploadedRotation.AngularDistance(Transform.GetRotation()) > m_rotationEpsilon;
+}
+
+void UGameObjectPositionManager::Upload(FPositionUploadEntry& Entry, const FTransform& Transform)
+{
+	Entry.UploadedLocation = Transform.GetLocation();
+	Entry.UploadedRotation = Transform.GetRotation();
+
+	if (UAkComponent* akComponent = Entry.AkComponent.Get())
+	{
+		// also updates the spatial audio room and reverb volumes of the AkComponent
+		akComponent->UpdateGameObjectPosition();
+		return;
+	}
+
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (UNLIKELY(!AkAudioDevice || !SoundEngine)) { return; }
+
+	AkSoundPosition soundPosition;
+	AkAudioDevice->FVectorsToAKWorldTransform(Entry.UploadedLocation, Entry.UploadedRotation.GetForwardVector(),
+		Entry.UploadedRotation.GetUpVector(), soundPosition);
+	SoundEngine->SetPosition(Entry.GameObjectID, soundPosition);
+}
+
+void UGameObjectPositionManager::RemoveEntry(int32 Index)
+{
+	m_entryIndices.Remove(m_entries[Index].GameObjectID);
+
+	if (Index != m_entries.Num() - 1)
+	{
+		m_entryIndices[m_entries.Last().GameObjectID] = Index;
+	}
+
+	m_entries.RemoveAtSwap(Index, 1, false);
+
+	DEC_DWORD_STAT(STAT_WwiserR_PositionManagedGameObjects);
+}
+
+#pragma region Tick
+void UGameObjectPositionManager::Tick(float DeltaTime)
+{
+	if (m_lastTickFrame == GFrameCounter) { return; }
+	m_lastTickFrame = GFrameCounter;
+
+	uint32 numSent = 0;
+	uint32 numSkipped = 0;
+
+	for (const AkGameObjectID gameObjectID : m_dirtyGameObjects)
+	{
+		const int32* index = m_entryIndices.Find(gameObjectID);
+		if (index == nullptr) { continue; }
+
+		FPositionUploadEntry& entry = m_entries[*index];
+		entry.bDirty = false;
+
+		const USceneComponent* component = entry.Component.Get();
+
+		if (!IsValid(component))
+		{
+			// destroyed without unregistering
+			RemoveEntry(*index);
+			continue;
+		}
+
+		const FTransform& transform = component->GetComponentTransform();
+
+		if (ShouldUpload(entry, transform))
+		{
+			Upload(entry, transform);
+			numSent++;
+		}
+		else
+		{
+			numSkipped++;
+		}
+	}
+
+	m_dirtyGameObjects.Reset();
+
+	INC_DWORD_STAT_BY(STAT_WwiserR_PositionUploadsSent, numSent);
+	INC_DWORD_STAT_BY(STAT_WwiserR_PositionUploadsSkipped, numSkipped);
+
+#if !UE_BUILD_SHIPPING
+	if (Private_GameObjectPositionManager::bDebugConsole)
+	{
+		m_dbgNumSent += numSent;
+		m_dbgNumSkipped += numSkipped;
+
+		const double currentTime = FPlatformTime::Seconds();
+
+		if (currentTime - m_dbgLastLogTime >= 1.)
+		{
+			WR_DBG_FUNC(Log, "%i managed game objects: %i position uploads sent, %i skipped", m_entries.Num(), m_dbgNumSent, m_dbgNumSkipped);
+			m_dbgLastLogTime = currentTime;
+			m_dbgNumSent = 0;
+			m_dbgNumSkipped = 0;
+		}
+	}
+#endif
+}
+#pragma endregion
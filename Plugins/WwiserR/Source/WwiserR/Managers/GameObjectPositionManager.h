@@ -0,0 +1,91 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Tickable.h"
+#include "AK/SoundEngine/Common/AkTypes.h"
+#include "GameObjectPositionManager.generated.h"
+
+class UAkComponent;
+
+// game object whose position is uploaded by the position manager, the game object ID is the address of its scene component
+struct FPositionUploadEntry
+{
+	TWeakObjectPtr<USceneComponent> Component{};
+	TWeakObjectPtr<UAkComponent> AkComponent{};	// uploads through the AkComponent, which also updates its room and reverb volumes
+	AkGameObjectID GameObjectID = AK_INVALID_GAME_OBJECT;
+	FVector UploadedLocation = FVector::ZeroVector;
+	FQuat UploadedRotation = FQuat::Identity;
+	bool bDirty = false;
+
+	FPositionUploadEntry() {}
+	FPositionUploadEntry(USceneComponent* a_Component, UAkComponent* a_AkComponent)
+		: Component(a_Component)
+		, AkComponent(a_AkComponent)
+		, GameObjectID((AkGameObjectID)a_Component)
+	{}
+};
+
+/**
+ * GameObjectPositionManager
+ * -------------------------
+ *
+ * - uploads the positions of WwiserR owned game objects (AkComponents of sound emitters, lightweight game objects, world listeners)
+ *   in one pass per frame, after movement has been resolved, instead of on every transform update
+ * - game objects are flagged dirty when their transform is updated, and only uploaded when they moved or rotated more than an epsilon
+ *   since their last upload
+ * - uploaded and skipped positions are counted per frame (stat WwiserR)
+ */
+UCLASS(ClassGroup = "WwiserR")
+class WWISERR_API UGameObjectPositionManager : public UObject, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+protected:
+	TArray<FPositionUploadEntry> m_entries{};
+	TMap<AkGameObjectID, int32> m_entryIndices{};
+	TArray<AkGameObjectID> m_dirtyGameObjects{};
+
+	float m_locationEpsilonSquared = 0.f;
+	float m_rotationEpsilon = 0.f;	// radians
+
+private:
+	uint32 m_lastTickFrame = INDEX_NONE;
+
+#if !UE_BUILD_SHIPPING
+	double m_dbgLastLogTime = 0.;
+	uint32 m_dbgNumSent = 0;
+	uint32 m_dbgNumSkipped = 0;
+#endif
+
+public:
+	void Initialize();
+	void Deinitialize();
+
+	/** uploads the position of Component and takes over its position updates. AkComponents stop updating their own position. */
+	void RegisterComponent(USceneComponent* Component);
+
+	/** hands the position updates of Component back, AkComponents update their own position again */
+	void UnregisterComponent(USceneComponent* Component);
+
+	FORCEINLINE bool IsRegistered(const USceneComponent* Component) const { return m_entryIndices.Contains((AkGameObjectID)Component); }
+
+protected:
+	void OnTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+	bool ShouldUpload(const FPositionUploadEntry& Entry, const FTransform& Transform) const;
+	void Upload(FPositionUploadEntry& Entry, const FTransform& Transform);
+	void RemoveEntry(int32 Index);
+
+#pragma region Tick
+public:
+	void Tick(float DeltaTime) override;
+
+	FORCEINLINE bool IsTickable() const override { return !m_dirtyGameObjects.IsEmpty(); }
+	FORCEINLINE ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	FORCEINLINE TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UGameObjectPositionManager, STATGROUP_Tickables); }
+	FORCEINLINE bool IsTickableWhenPaused() const override { return true; }
+	FORCEINLINE bool IsTickableInEditor() const override { return false; }
+#pragma endregion
+};
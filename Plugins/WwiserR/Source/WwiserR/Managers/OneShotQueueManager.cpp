@@ -0,0 +1,257 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#include "OneShotQueueManager.h"
+#include "SoundEmitters/SoundEmitterComponentBase.h"
+#include "Managers/SoundListenerManager.h"
+#include "Core/AudioUtils.h"
+#include "Config/AudioConfig.h"
+#include "AkAudioEvent.h"
+#include "Misc/App.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("OneShots Queued"), STAT_WwiserR_OneShotsQueued, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("OneShots Posted"), STAT_WwiserR_OneShotsPosted, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("OneShots Deduped"), STAT_WwiserR_OneShotsDeduped, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("OneShots Capped"), STAT_WwiserR_OneShotsCapped, STATGROUP_WwiserR);
+
+#pragma region CVars
+namespace Private_OneShotQueueManager
+{
+	static TAutoConsoleVariable<bool> CVar_OneShotQueue_DebugConsole(TEXT("WwiserR.OneShotQueue.DebugToConsole"), false,
+		TEXT("Log one shots dropped by deduplication or instance caps. (0 = off, 1 = on)"), ECVF_Cheat);
+	static TAutoConsoleVariable<bool> CVar_OneShotQueue_Bypass(TEXT("WwiserR.OneShotQueue.Bypass"), false,
+		TEXT("Post all queued one shots without deduplication or instance caps. (0 = off, 1 = on)"), ECVF_Cheat);
+
+	bool bDebugConsole = false;
+	bool bBypass = false;
+
+	static void OnOneShotQueueManagerUpdate()
+	{
+		bDebugConsole = CVar_OneShotQueue_DebugConsole.GetValueOnGameThread();
+		bBypass = CVar_OneShotQueue_Bypass.GetValueOnGameThread();
+	}
+
+	FAutoConsoleVariableSink COneShotQueueManagerConsoleSink(FConsoleCommandDelegate::CreateStatic(&OnOneShotQueueManagerUpdate));
+} // namespace Private_OneShotQueueManager
+#pragma endregion
+
+void UOneShotQueueManager::Initialize(USoundListenerManager* SoundListenerManager)
+{
+	m_listenerManager = SoundListenerManager;
+
+	const UWwiserRGameSettings* audioConfig = GetDefault<UWwiserRGameSettings>();
+	m_dedupeRadiusSquared = FMath::Square(audioConfig->OneShotDedupeRadius);
+	m_dedupeWindow = audioConfig->OneShotDedupeWindow;
+	m_maxInstancesPerEvent = audioConfig->OneShotMaxInstancesPerEvent;
+
+	for (const TPair<TSoftObjectPtr<UAkAudioEvent>, int32>& maxInstancesOverride : audioConfig->OneShotMaxInstancesOverrides)
+	{
+		m_maxInstancesOverrides.Add(maxInstancesOverride.Key.ToSoftObjectPath(), maxInstancesOverride.Value);
+	}
+
+	WR_DBG_NET(Log, "initialized (%s)", *UAudioUtils::GetClientOrServerString(GetWorld()));
+}
+
+void UOneShotQueueManager::Deinitialize()
+{
+	m_queue.Empty();
+	m_postedOneShots.Empty();
+	m_listenerManager = nullptr;
+
+	WR_DBG_NET(Log, "deinitialized (%s)", *UAudioUtils::GetClientOrServerString(GetWorld()));
+}
+
+void UOneShotQueueManager::QueueOneShot(USoundEmitterComponentBase* SoundEmitter, UAkAudioEvent* AkEvent,
+	bool bQueryAndPostEnvironmentSwitches)
+{
+	m_queue.Emplace(SoundEmitter, AkEvent, SoundEmitter->GetComponentLocation(), bQueryAndPostEnvironmentSwitches);
+
+	INC_DWORD_STAT(STAT_WwiserR_OneShotsQueued);
+}
+
+void UOneShotQueueManager::Flush()
+{
+	const double currentTime = FApp::GetCurrentTime();
+
+	if (Private_OneShotQueueManager::bBypass)
+	{
+		for (const FQueuedOneShot& oneShot : m_queue)
+		{
+			if (USoundEmitterComponentBase* soundEmitter = oneShot.SoundEmitter.Get())
+			{
+				soundEmitter->PostQueuedOneShot(oneShot.AkEvent, oneShot.bQueryAndPostEnvironmentSwitches);
+			}
+		}
+
+		INC_DWORD_STAT_BY(STAT_WwiserR_OneShotsPosted, m_queue.Num());
+		m_queue.Reset();
+		return;
+	}
+
+	for (FQueuedOneShot& oneShot : m_queue)
+	{
+		oneShot.DistanceSquared = GetNearestListenerDistanceSquared(oneShot.Location);
+	}
+
+	// group on event, nearest to a listener first
+	m_queue.Sort([](const FQueuedOneShot& A, const FQueuedOneShot& B)
+		{
+			return A.AkEvent != B.AkEvent ? A.AkEvent < B.AkEvent : A.DistanceSquared < B.DistanceSquared;
+		});
+
+	uint32 numPosted = 0;
+	uint32 numDeduped = 0;
+	uint32 numCapped = 0;
+
+	int32 groupStart = 0;
+
+	while (groupStart < m_queue.Num())
+	{
+		UAkAudioEvent* akEvent = m_queue[groupStart].AkEvent;
+		int32 groupEnd = groupStart + 1;
+
+		while (groupEnd < m_queue.Num() && m_queue[groupEnd].AkEvent == akEvent)
+		{
+			groupEnd++;
+		}
+
+		const int32 maxInstances = GetMaxInstances(akEvent);
+		TArray<FPostedOneShot>* postedOneShots = m_postedOneShots.Find(akEvent);
+		m_acceptedLocations.Reset();
+
+		for (int32 i = groupStart; i < groupEnd; ++i)
+		{
+			const FQueuedOneShot& oneShot = m_queue[i];
+			USoundEmitterComponentBase* soundEmitter = oneShot.SoundEmitter.Get();
+			if (!IsValid(soundEmitter) || soundEmitter->m_isMuted) { continue; }
+
+			const bool bIsDuplicate = IsDuplicate(oneShot.Location, postedOneShots, currentTime)
+				|| m_acceptedLocations.ContainsByPredicate([this, &oneShot](const FVector& AcceptedLocation)
+					{
+						return FVector::DistSquared(AcceptedLocation, oneShot.Location) <= m_dedupeRadiusSquared;
+					});
+
+			if (bIsDuplicate)
+			{
+				numDeduped++;
+				continue;
+			}
+
+			if (maxInstances > 0 && m_acceptedLocations.Num() >= maxInstances)
+			{
+				numCapped++;
+				continue;
+			}
+
+			m_acceptedLocations.Add(oneShot.Location);
+			soundEmitter->PostQueuedOneShot(akEvent, oneShot.bQueryAndPostEnvironmentSwitches);
+			numPosted++;
+		}
+
+		if (m_dedupeWindow > 0.f && !m_acceptedLocations.IsEmpty())
+		{
+			TArray<FPostedOneShot>& posted = postedOneShots ? *postedOneShots : m_postedOneShots.Add(akEvent);
+
+			for (const FVector& location : m_acceptedLocations)
+			{
+				posted.Emplace(location, currentTime);
+			}
+		}
+
+		groupStart = groupEnd;
+	}
+
+	m_queue.Reset();
+
+	INC_DWORD_STAT_BY(STAT_WwiserR_OneShotsPosted, numPosted);
+	INC_DWORD_STAT_BY(STAT_WwiserR_OneShotsDeduped, numDeduped);
+	INC_DWORD_STAT_BY(STAT_WwiserR_OneShotsCapped, numCapped);
+
+#if !UE_BUILD_SHIPPING
+	m_dbgNumDeduped += numDeduped;
+	m_dbgNumCapped += numCapped;
+#endif
+}
+
+int32 UOneShotQueueManager::GetMaxInstances(const UAkAudioEvent* AkEvent) const
+{
+	if (!m_maxInstancesOverrides.IsEmpty())
+	{
+		if (const int32* maxInstances = m_maxInstancesOverrides.Find(FSoftObjectPath(AkEvent)))
+		{
+			return *maxInstances;
+		}
+	}
+
+	return m_maxInstancesPerEvent;
+}
+
+bool UOneShotQueueManager::IsDuplicate(const FVector& Location, const TArray<FPostedOneShot>* PostedOneShots, double CurrentTime) const
+{
+	if (PostedOneShots == nullptr) { return false; }
+
+	for (const FPostedOneShot& postedOneShot : *PostedOneShots)
+	{
+		if (CurrentTime - postedOneShot.PostTime <= m_dedupeWindow
+			&& FVector::DistSquared(postedOneShot.Location, Location) <= m_dedupeRadiusSquared)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UOneShotQueueManager::PrunePostedOneShots(double CurrentTime)
+{
+	for (auto it = m_postedOneShots.CreateIterator(); it; ++it)
+	{
+		it->Value.RemoveAllSwap([this, CurrentTime](const FPostedOneShot& PostedOneShot)
+			{
+				return CurrentTime - PostedOneShot.PostTime > m_dedupeWindow;
+			}, false);
+
+		if (it->Value.IsEmpty())
+		{
+			it.RemoveCurrent();
+		}
+	}
+}
+
+float UOneShotQueueManager::GetNearestListenerDistanceSquared(const FVector& Location) const
+{
+	if (!IsValid(m_listenerManager)) { return 0.f; }
+
+	float nearestDistanceSquared = MAX_flt;
+
+	for (const FListenerSnapshotEntry& listener : m_listenerManager->GetListenerSnapshot().Listeners)
+	{
+		nearestDistanceSquared = FMath::Min(nearestDistanceSquared, (float)FVector::DistSquared(Location, listener.Position));
+	}
+
+	return nearestDistanceSquared;
+}
+
+#pragma region Tick
+void UOneShotQueueManager::Tick(float DeltaTime)
+{
+	if (m_lastTickFrame == GFrameCounter) { return; }
+	m_lastTickFrame = GFrameCounter;
+
+	PrunePostedOneShots(FApp::GetCurrentTime());
+
+	if (!m_queue.IsEmpty())
+	{
+		Flush();
+	}
+
+#if !UE_BUILD_SHIPPING
+	if (Private_OneShotQueueManager::bDebugConsole && (m_dbgNumDeduped > 0 || m_dbgNumCapped > 0))
+	{
+		WR_DBG_FUNC(Log, "dropped %i deduplicated and %i capped one shots", m_dbgNumDeduped, m_dbgNumCapped);
+	}
+
+	m_dbgNumDeduped = 0;
+	m_dbgNumCapped = 0;
+#endif
+}
+#pragma endregion
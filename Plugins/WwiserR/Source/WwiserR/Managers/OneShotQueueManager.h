@@ -0,0 +1,101 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Tickable.h"
+#include "OneShotQueueManager.generated.h"
+
+class USoundEmitterComponentBase;
+class UAkAudioEvent;
+
+// one shot posted during the frame, waiting to be flushed
+struct FQueuedOneShot
+{
+	TWeakObjectPtr<USoundEmitterComponentBase> SoundEmitter{};
+	UAkAudioEvent* AkEvent = nullptr;
+	FVector Location = FVector::ZeroVector;
+	float DistanceSquared = 0.f;	// to the nearest listener, set when flushing
+	bool bQueryAndPostEnvironmentSwitches = false;
+
+	FQueuedOneShot() {}
+	FQueuedOneShot(USoundEmitterComponentBase* a_SoundEmitter, UAkAudioEvent* a_AkEvent, const FVector& a_Location,
+		bool a_bQueryAndPostEnvironmentSwitches)
+		: SoundEmitter(a_SoundEmitter)
+		, AkEvent(a_AkEvent)
+		, Location(a_Location)
+		, bQueryAndPostEnvironmentSwitches(a_bQueryAndPostEnvironmentSwitches)
+	{}
+};
+
+// one shot posted to Wwise within the dedupe window
+struct FPostedOneShot
+{
+	FVector Location = FVector::ZeroVector;
+	double PostTime = 0.;
+
+	FPostedOneShot() {}
+	FPostedOneShot(const FVector& a_Location, double a_PostTime) : Location(a_Location), PostTime(a_PostTime) {}
+};
+
+/**
+ * OneShotQueueManager
+ * -------------------
+ *
+ * - collects one shots posted by sound emitters with bQueueOneShots during the frame, and posts them to Wwise in one flush at the end
+ *   of the frame
+ * - drops posts of an event within a configurable radius of another post of the same event, in this frame or within the dedupe window
+ * - caps the amount of instances of each event posted per frame, nearest to a listener first. Caps can be overridden per event
+ * - queued, posted, deduped and capped one shots are counted per frame (stat WwiserR)
+ */
+UCLASS(ClassGroup = "WwiserR")
+class WWISERR_API UOneShotQueueManager : public UObject, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY() class USoundListenerManager* m_listenerManager {};
+
+	TArray<FQueuedOneShot> m_queue{};
+	TMap<const UAkAudioEvent*, TArray<FPostedOneShot>> m_postedOneShots{};	// within the dedupe window
+	TArray<FVector> m_acceptedLocations{};	// persistent scratch buffer
+
+	float m_dedupeRadiusSquared = 0.f;
+	float m_dedupeWindow = 0.f;
+	int32 m_maxInstancesPerEvent = 0;
+	TMap<FSoftObjectPath, int32> m_maxInstancesOverrides{};
+
+private:
+	uint32 m_lastTickFrame = INDEX_NONE;
+
+#if !UE_BUILD_SHIPPING
+	uint32 m_dbgNumDeduped = 0;
+	uint32 m_dbgNumCapped = 0;
+#endif
+
+public:
+	void Initialize(USoundListenerManager* SoundListenerManager);
+	void Deinitialize();
+
+	/** queues AkEvent on SoundEmitter, to be posted at the end of the frame */
+	void QueueOneShot(USoundEmitterComponentBase* SoundEmitter, UAkAudioEvent* AkEvent, bool bQueryAndPostEnvironmentSwitches);
+
+protected:
+	void Flush();
+	int32 GetMaxInstances(const UAkAudioEvent* AkEvent) const;
+	bool IsDuplicate(const FVector& Location, const TArray<FPostedOneShot>* PostedOneShots, double CurrentTime) const;
+	void PrunePostedOneShots(double CurrentTime);
+	float GetNearestListenerDistanceSquared(const FVector& Location) const;
+
+#pragma region Tick
+public:
+	void Tick(float DeltaTime) override;
+
+	FORCEINLINE bool IsTickable() const override { return !m_queue.IsEmpty() || !m_postedOneShots.IsEmpty(); }
+	FORCEINLINE ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	FORCEINLINE TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UOneShotQueueManager, STATGROUP_Tickables); }
+	FORCEINLINE bool IsTickableWhenPaused() const override { return false; }
+	FORCEINLINE bool IsTickableInEditor() const override { return false; }
+#pragma endregion
+};
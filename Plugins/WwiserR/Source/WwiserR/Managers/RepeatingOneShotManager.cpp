@@ -0,0 +1,474 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#include "RepeatingOneShotManager.h"
+#include "Core/AudioUtils.h"
+#include "Engine/World.h"
+#include "AkAudioEvent.h"
+
+#if !UE_BUILD_SHIPPING
+#include "TimerManager.h"
+#include "Containers/Ticker.h"
+#endif
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Repeating OneShots"), STAT_WwiserR_RepeatingOneShots, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Repeating OneShots Evaluated"), STAT_WwiserR_RepeatingOneShotsEvaluated, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Repeating OneShots Out Of Range"), STAT_WwiserR_RepeatingOneShotsOutOfRange, STATGROUP_WwiserR);
+
+namespace Private_RepeatingOneShotManager
+{
+	static const float DrainPollInterval = .1f;	// no end of event callbacks without a wrapper
+}
+
+void URepeatingOneShotManager::Initialize()
+{
+	FWorldDelegates::OnPostWorldCleanup.AddUObject(this, &URepeatingOneShotManager::OnPostWorldCleanup);
+
+	WR_DBG_NET(Log, "initialized (%s)", *UAudioUtils::GetClientOrServerString(GetWorld()));
+}
+
+void URepeatingOneShotManager::Deinitialize()
+{
+	FWorldDelegates::OnPostWorldCleanup.RemoveAll(this);
+
+	SET_DWORD_STAT(STAT_WwiserR_RepeatingOneShots, 0);
+
+	m_entries.Empty();
+	m_worldSchedulers.Empty();
+	m_dueEntries.Empty();
+
+	WR_DBG_NET(Log, "deinitialized (%s)", *UAudioUtils::GetClientOrServerString(GetWorld()));
+}
+
+FRepeatingOneShotHandle URepeatingOneShotManager::Start(FRepeatingOneShotEntry&& Entry)
+{
+	USoundEmitterComponentBase* soundEmitter = Entry.SoundEmitter.Get();
+	if (!IsValid(soundEmitter) || !IsValid(soundEmitter->GetWorld())) { return FRepeatingOneShotHandle(); }
+
+	Entry.Serial = ++m_nextSerial;
+	const int32 index = m_entries.Add(MoveTemp(Entry));
+	const FRepeatingOneShotEntry& entry = m_entries[index];
+	const FRepeatingOneShotHandle handle(index, entry.Serial);
+
+	if (URepeatingOneShot* wrapper = entry.Wrapper.Get())
+	{
+		wrapper->m_handle = handle;
+	}
+	else
+	{
+		soundEmitter->m_scheduledRepeatingOneShots.Add(handle);
+	}
+
+	INC_DWORD_STAT(STAT_WwiserR_RepeatingOneShots);
+
+	PostDueEntry(index);
+	return handle;
+}
+
+void URepeatingOneShotManager::Pause(const FRepeatingOneShotHandle& Handle, bool bStopPlayingEventImmediately,
+	int32 TransitionDurationInMs, EAkCurveInterpolation FadeCurve)
+{
+	FRepeatingOneShotEntry* entry = Find(Handle);
+	if (entry == nullptr || entry->bIsDraining) { return; }
+
+	entry->bIsPaused = entry->RepetitionsLeft != 0;
+	entry->ScheduleSerial = ++m_nextSerial;
+
+	if (bStopPlayingEventImmediately && IsEntryPlaying(*entry))
+	{
+		entry->SoundEmitter->StopOneShotByPlayingId(entry->ActivePlayingID, TransitionDurationInMs, FadeCurve);
+	}
+}
+
+bool URepeatingOneShotManager::Resume(const FRepeatingOneShotHandle& Handle)
+{
+	FRepeatingOneShotEntry* entry = Find(Handle);
+	if (entry == nullptr || !entry->bIsPaused) { return false; }
+
+	USoundEmitterComponentBase* soundEmitter = entry->SoundEmitter.Get();
+	if (!IsValid(soundEmitter)) { return false; }
+
+	entry->bIsPaused = false;
+	ScheduleNext(Handle.Index, soundEmitter);
+	return true;
+}
+
+bool URepeatingOneShotManager::End(const FRepeatingOneShotHandle& Handle, bool bStopPlayingEventImmediately,
+	int32 TransitionDurationInMs, EAkCurveInterpolation FadeCurve)
+{
+	FRepeatingOneShotEntry* entry = Find(Handle);
+	if (entry == nullptr) { return false; }
+
+	entry->RepetitionsLeft = 0;
+	entry->bIsPaused = false;
+	entry->ScheduleSerial = ++m_nextSerial;
+
+	if (!IsEntryPlaying(*entry))
+	{
+		EndEntry(Handle.Index);
+		return true;
+	}
+
+	if (bStopPlayingEventImmediately)
+	{
+		entry->SoundEmitter->StopOneShotByPlayingId(entry->ActivePlayingID, TransitionDurationInMs, FadeCurve);
+	}
+
+	// wrappers end on their end of event callback, others are polled
+	if (!entry->Wrapper.IsValid())
+	{
+		entry->bIsDraining = true;
+		SchedulePoll(Handle.Index, entry->SoundEmitter.Get());
+	}
+
+	return true;
+}
+
+void URepeatingOneShotManager::Remove(const FRepeatingOneShotHandle& Handle)
+{
+	const FRepeatingOneShotEntry* entry = Find(Handle);
+	if (entry == nullptr) { return; }
+
+	if (USoundEmitterComponentBase* soundEmitter = entry->SoundEmitter.Get())
+	{
+		soundEmitter->m_scheduledRepeatingOneShots.RemoveSingleSwap(Handle, false);
+	}
+
+	m_entries.RemoveAt(Handle.Index);
+
+	DEC_DWORD_STAT(STAT_WwiserR_RepeatingOneShots);
+}
+
+void URepeatingOneShotManager::OnOneShotEnded(const FRepeatingOneShotHandle& Handle)
+{
+	if (FRepeatingOneShotEntry* entry = Find(Handle))
+	{
+		entry->ActivePlayingID = AK_INVALID_PLAYING_ID;
+	}
+}
+
+bool URepeatingOneShotManager::IsPlaying(const FRepeatingOneShotHandle& Handle) const
+{
+	const FRepeatingOneShotEntry* entry = Find(Handle);
+	return entry != nullptr && IsEntryPlaying(*entry);
+}
+
+const FRepeatingOneShotEntry* URepeatingOneShotManager::Find(const FRepeatingOneShotHandle& Handle) const
+{
+	return Handle.IsValid() && m_entries.IsValidIndex(Handle.Index) && m_entries[Handle.Index].Serial == Handle.Serial
+		? &m_entries[Handle.Index]
+		: nullptr;
+}
+
+FRepeatingOneShotEntry* URepeatingOneShotManager::Find(const FRepeatingOneShotHandle& Handle)
+{
+	return const_cast<FRepeatingOneShotEntry*>(static_cast<const URepeatingOneShotManager*>(this)->Find(Handle));
+}
+
+void URepeatingOneShotManager::PostDueEntry(int32 Index)
+{
+	FRepeatingOneShotEntry& entry = m_entries[Index];
+	USoundEmitterComponentBase* soundEmitter = entry.SoundEmitter.Get();
+
+	if (!IsValid(soundEmitter) || !IsValid(entry.AkEvent))
+	{
+		EndEntry(Index);
+		return;
+	}
+
+	if (entry.bIsDraining)
+	{
+		if (IsEntryPlaying(entry))
+		{
+			SchedulePoll(Index, soundEmitter);
+		}
+		else
+		{
+			EndEntry(Index);
+		}
+
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_WwiserR_RepeatingOneShotsEvaluated);
+
+	// out of range emitters only consume a repetition, without querying Wwise or registering a game object
+	const bool bIsInRange = soundEmitter->IsInListenerRange(entry.AkEvent, entry.AttenuationRangeBuffer) && !soundEmitter->m_isMuted;
+	const bool bShouldBlockOverlap = bIsInRange && entry.bBlockOverlaps && IsEntryPlaying(entry);
+
+	if (!bShouldBlockOverlap)
+	{
+		URepeatingOneShot* wrapper = entry.Wrapper.Get();
+		AkPlayingID playingID = AK_INVALID_PLAYING_ID;
+
+		if (!bIsInRange)
+		{
+			INC_DWORD_STAT(STAT_WwiserR_RepeatingOneShotsOutOfRange);
+		}
+		else if (wrapper)
+		{
+			const int32 callbackMask = wrapper->bPostAkPostEventCallbackOnEndOfEvent ? wrapper->CallbackMask : wrapper->CallbackMask + 1;
+			playingID = soundEmitter->PostOneShot(entry.AkEvent, callbackMask, wrapper->AkPostEventCallbackInternal,
+				entry.AttenuationRangeBuffer, entry.bQueryAndPostEnvironmentSwitches);
+		}
+		else
+		{
+			playingID = soundEmitter->PostOneShot(entry.AkEvent, entry.AttenuationRangeBuffer, entry.bQueryAndPostEnvironmentSwitches);
+		}
+
+		entry.ActivePlayingID = playingID;
+
+		if (entry.RepetitionsLeft > 0)
+		{
+			entry.RepetitionsLeft--;
+		}
+
+		if (!entry.bShouldRepeat)
+		{
+			entry.RepetitionsLeft = 0;
+		}
+
+		if (wrapper)
+		{
+			// Blueprint callbacks can start, pause or end repeating one shots
+			const FRepeatingOneShotHandle handle(Index, entry.Serial);
+			wrapper->OnScheduledOneShotPosted(playingID, entry.RepetitionsLeft);
+			if (Find(handle) == nullptr) { return; }
+		}
+
+		if (playingID == AK_INVALID_PLAYING_ID && m_entries[Index].RepetitionsLeft == 0)
+		{
+			EndEntry(Index);
+			return;
+		}
+	}
+	else if (!entry.bShouldRepeat)
+	{
+		entry.RepetitionsLeft = 0;
+	}
+
+	FRepeatingOneShotEntry& postedEntry = m_entries[Index];
+	if (postedEntry.bIsPaused || postedEntry.bIsDraining) { return; }
+
+	if (postedEntry.RepetitionsLeft != 0)
+	{
+		ScheduleNext(Index, soundEmitter);
+	}
+	else if (!postedEntry.Wrapper.IsValid())
+	{
+		postedEntry.bIsDraining = true;
+		SchedulePoll(Index, soundEmitter);
+	}
+}
+
+void URepeatingOneShotManager::ScheduleNext(int32 Index, USoundEmitterComponentBase* SoundEmitter)
+{
+	FRepeatingOneShotEntry& entry = m_entries[Index];
+	UWorld* world = SoundEmitter->GetWorld();
+	if (!IsValid(world)) { return; }
+
+	// a zero interval posts on the next tick
+	const float timeBeforePostingNextEvent = FMath::Max(0.f, FMath::RandRange(entry.MinTimeInterval, entry.MaxTimeInterval));
+
+	entry.ScheduleSerial = ++m_nextSerial;
+	m_worldSchedulers.FindOrAdd(world).Push(world->GetTimeSeconds() + timeBeforePostingNextEvent, Index, entry.ScheduleSerial);
+}
+
+void URepeatingOneShotManager::SchedulePoll(int32 Index, USoundEmitterComponentBase* SoundEmitter)
+{
+	FRepeatingOneShotEntry& entry = m_entries[Index];
+	UWorld* world = IsValid(SoundEmitter) ? SoundEmitter->GetWorld() : nullptr;
+
+	if (!IsValid(world))
+	{
+		EndEntry(Index);
+		return;
+	}
+
+	entry.ScheduleSerial = ++m_nextSerial;
+	m_worldSchedulers.FindOrAdd(world).Push(world->GetTimeSeconds() + Private_RepeatingOneShotManager::DrainPollInterval, Index,
+		entry.ScheduleSerial);
+}
+
+void URepeatingOneShotManager::EndEntry(int32 Index)
+{
+	URepeatingOneShot* wrapper = m_entries[Index].Wrapper.Get();
+	Remove(FRepeatingOneShotHandle(Index, m_entries[Index].Serial));
+
+	if (IsValid(wrapper))
+	{
+		wrapper->OnEndRepeatingOneShot();
+	}
+}
+
+bool URepeatingOneShotManager::IsEntryPlaying(const FRepeatingOneShotEntry& Entry) const
+{
+	const USoundEmitterComponentBase* soundEmitter = Entry.SoundEmitter.Get();
+	return IsValid(soundEmitter) && soundEmitter->IsPlayingIdActive(Entry.AkEvent, Entry.ActivePlayingID);
+}
+
+void URepeatingOneShotManager::OnPostWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	m_worldSchedulers.Remove(World);
+}
+
+#pragma region Tick
+void URepeatingOneShotManager::Tick(float DeltaTime)
+{
+	if (m_lastTickFrame == GFrameCounter) { return; }
+	m_lastTickFrame = GFrameCounter;
+
+	m_dueEntries.Reset();
+
+	for (auto it = m_worldSchedulers.CreateIterator(); it; ++it)
+	{
+		if (!IsValid(it->Key) || it->Value.Heap.IsEmpty())
+		{
+			it.RemoveCurrent();
+			continue;
+		}
+
+		it->Value.PopDue(it->Key->GetTimeSeconds(), m_dueEntries);
+	}
+
+	// posting reschedules into the world schedulers
+	for (const FRepeatingOneShotScheduleEntry& dueEntry : m_dueEntries)
+	{
+		// paused, ended or rescheduled since
+		if (m_entries.IsValidIndex(dueEntry.Index) && m_entries[dueEntry.Index].ScheduleSerial == dueEntry.ScheduleSerial)
+		{
+			PostDueEntry(dueEntry.Index);
+		}
+	}
+
+	m_dueEntries.Reset();
+}
+#pragma endregion
+
+#pragma region Benchmark
+#if !UE_BUILD_SHIPPING
+namespace Private_RepeatingOneShotManager
+{
+	static constexpr float BenchmarkDeltaTime = 1.f / 60.f;
+	static constexpr float BenchmarkMinTimeInterval = .5f;
+	static constexpr float BenchmarkMaxTimeInterval = 4.f;
+
+	// before: a URepeatingOneShot with its own timer, rearmed with a random interval after each post
+	struct FTimerBenchmark
+	{
+		FRandomStream Random{ 1337 };
+		FTimerManager TimerManager{};
+		TArray<FTimerHandle> TimerHandles{};
+		TArray<FTimerDelegate> TimerDelegates{};
+		int32 NumFramesLeft = 0;
+		uint64 NumPosts = 0;
+		double TickSeconds = 0.;
+	};
+
+	static void LogBenchmarkResults(int32 NumInstances, int32 NumFrames, double TimerMs, uint64 NumTimerPosts, double SchedulerMs,
+		uint64 NumSchedulerPosts)
+	{
+		// sizeof based estimate, the wrapper is only allocated for repeating one shots started through the Blueprint API
+		const int32 timerBytes = URepeatingOneShot::StaticClass()->GetStructureSize() + sizeof(FTimerData) + sizeof(FTimerHandle);
+		const int32 structBytes = sizeof(FRepeatingOneShotEntry) + sizeof(FRepeatingOneShotScheduleEntry) + sizeof(FRepeatingOneShotHandle);
+
+		WR_DBG_STATIC_FUNC(Log, "%i repeating one shots, %i frames", NumInstances, NumFrames);
+		WR_DBG_STATIC_FUNC(Log, "  timer per UObject : ~%5i bytes per instance, %.4f ms per frame (%llu posts)",
+			timerBytes, TimerMs, NumTimerPosts);
+		WR_DBG_STATIC_FUNC(Log, "  scheduler         : ~%5i bytes per instance, %.4f ms per frame (%llu posts)",
+			structBytes, SchedulerMs, NumSchedulerPosts);
+	}
+
+	static void RunBenchmark(const TArray<FString>& Args)
+	{
+		const int32 numInstances = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+		const int32 numFrames = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 600;
+
+		// after: a struct entry and a scheduled post in the world's min-heap, stepped with a simulated frame index and time
+		uint64 numSchedulerPosts = 0;
+		double schedulerMs = 0.;
+		{
+			FRandomStream random(1337);
+			TSparseArray<FRepeatingOneShotEntry> entries;
+			FRepeatingOneShotWorldScheduler scheduler;
+			TArray<FRepeatingOneShotScheduleEntry> dueEntries;
+			uint32 nextSerial = 0;
+
+			for (int32 i = 0; i < numInstances; i++)
+			{
+				FRepeatingOneShotEntry entry;
+				entry.MinTimeInterval = BenchmarkMinTimeInterval;
+				entry.MaxTimeInterval = BenchmarkMaxTimeInterval;
+				entry.ScheduleSerial = ++nextSerial;
+				const int32 index = entries.Add(MoveTemp(entry));
+				scheduler.Push(random.FRandRange(BenchmarkMinTimeInterval, BenchmarkMaxTimeInterval), index, entries[index].ScheduleSerial);
+			}
+
+			const double startTime = FPlatformTime::Seconds();
+
+			for (int32 frame = 1; frame <= numFrames; frame++)
+			{
+				const double currentTime = frame * BenchmarkDeltaTime;
+				dueEntries.Reset();
+				scheduler.PopDue(currentTime, dueEntries);
+
+				for (const FRepeatingOneShotScheduleEntry& dueEntry : dueEntries)
+				{
+					FRepeatingOneShotEntry& entry = entries[dueEntry.Index];
+					if (entry.ScheduleSerial != dueEntry.ScheduleSerial) { continue; }
+
+					numSchedulerPosts++;
+					entry.ScheduleSerial = ++nextSerial;
+					scheduler.Push(currentTime + random.FRandRange(entry.MinTimeInterval, entry.MaxTimeInterval), dueEntry.Index,
+						entry.ScheduleSerial);
+				}
+			}
+
+			schedulerMs = (FPlatformTime::Seconds() - startTime) * 1000. / numFrames;
+		}
+
+		// FTimerManager only ticks once per engine frame, so the timer path is stepped on the core ticker over the next numFrames frames
+		// instead of rewinding GFrameCounter
+		TSharedRef<FTimerBenchmark> timerBenchmark = MakeShared<FTimerBenchmark>();
+		timerBenchmark->NumFramesLeft = numFrames;
+		timerBenchmark->TimerHandles.SetNum(numInstances);
+		timerBenchmark->TimerDelegates.SetNum(numInstances);
+
+		for (int32 i = 0; i < numInstances; i++)
+		{
+			FTimerBenchmark* benchmark = &timerBenchmark.Get();
+
+			timerBenchmark->TimerDelegates[i].BindLambda([benchmark, i]()
+				{
+					benchmark->NumPosts++;
+					benchmark->TimerManager.SetTimer(benchmark->TimerHandles[i], benchmark->TimerDelegates[i],
+						benchmark->Random.FRandRange(BenchmarkMinTimeInterval, BenchmarkMaxTimeInterval), false);
+				});
+
+			timerBenchmark->TimerManager.SetTimer(timerBenchmark->TimerHandles[i], timerBenchmark->TimerDelegates[i],
+				timerBenchmark->Random.FRandRange(BenchmarkMinTimeInterval, BenchmarkMaxTimeInterval), false);
+		}
+
+		WR_DBG_STATIC_FUNC(Log, "running the timer benchmark over the next %i frames", numFrames);
+
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+			[timerBenchmark, numInstances, numFrames, schedulerMs, numSchedulerPosts](float DeltaTime)
+			{
+				const double startTime = FPlatformTime::Seconds();
+				timerBenchmark->TimerManager.Tick(BenchmarkDeltaTime);
+				timerBenchmark->TickSeconds += FPlatformTime::Seconds() - startTime;
+
+				if (--timerBenchmark->NumFramesLeft > 0) { return true; }
+
+				LogBenchmarkResults(numInstances, numFrames, timerBenchmark->TickSeconds * 1000. / numFrames, timerBenchmark->NumPosts,
+					schedulerMs, numSchedulerPosts);
+				return false;
+			}));
+	}
+
+	static FAutoConsoleCommand CCmd_RepeatingOneShot_Benchmark(TEXT("WwiserR.RepeatingOneShot.Benchmark"),
+		TEXT("Compares per instance memory and scheduling cost of a timer per repeating one shot with the repeating one shot scheduler. ")
+		TEXT("(optional: instances, default 1000, frames, default 600)"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunBenchmark), ECVF_Cheat);
+} // namespace Private_RepeatingOneShotManager
+#endif
+#pragma endregion
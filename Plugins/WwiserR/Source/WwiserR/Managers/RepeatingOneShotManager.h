@@ -0,0 +1,152 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Tickable.h"
+#include "SoundEmitters/SoundEmitterComponentBase.h"
+#include "RepeatingOneShotManager.generated.h"
+
+// state of a repeating one shot, owned by the repeating one shot manager
+struct FRepeatingOneShotEntry
+{
+	TWeakObjectPtr<USoundEmitterComponentBase> SoundEmitter{};
+	UAkAudioEvent* AkEvent = nullptr;
+	TWeakObjectPtr<URepeatingOneShot> Wrapper{};	// only set for repeating one shots posted through the Blueprint API
+	float MinTimeInterval = 0.f;
+	float MaxTimeInterval = 0.f;
+	float AttenuationRangeBuffer = 50.f;
+	int32 RepetitionsLeft = -1;
+	AkPlayingID ActivePlayingID = AK_INVALID_PLAYING_ID;
+	uint32 Serial = 0;			// matches the serial of handles to this entry
+	uint32 ScheduleSerial = 0;	// invalidates previously scheduled posts when rescheduled, paused or ended
+	bool bShouldRepeat = false;
+	bool bBlockOverlaps = true;
+	bool bQueryAndPostEnvironmentSwitches = false;
+	bool bIsPaused = false;
+	bool bIsDraining = false;	// no repetitions left, waiting for the last one shot to end
+
+	FRepeatingOneShotEntry() {}
+	FRepeatingOneShotEntry(USoundEmitterComponentBase* a_SoundEmitter, const FRepeatableOneShot& a_RepeatableOneShot,
+		float a_AttenuationRangeBuffer, bool a_bQueryAndPostEnvironmentSwitches)
+		: SoundEmitter(a_SoundEmitter)
+		, AkEvent(a_RepeatableOneShot.AkEvent)
+		, MinTimeInterval(a_RepeatableOneShot.MinTimeInterval)
+		, MaxTimeInterval(a_RepeatableOneShot.MaxTimeInterval)
+		, AttenuationRangeBuffer(a_AttenuationRangeBuffer)
+		, RepetitionsLeft(a_RepeatableOneShot.MaxRepetitions)
+		, bShouldRepeat(a_RepeatableOneShot.bShouldRepeat)
+		, bBlockOverlaps(a_RepeatableOneShot.bBlockOverlaps)
+		, bQueryAndPostEnvironmentSwitches(a_bQueryAndPostEnvironmentSwitches)
+	{}
+};
+
+// scheduled post of a repeating one shot, entries are invalidated lazily by comparing schedule serials
+struct FRepeatingOneShotScheduleEntry
+{
+	double DueTime = INFINITY;
+	int32 Index = INDEX_NONE;
+	uint32 ScheduleSerial = 0;
+
+	FRepeatingOneShotScheduleEntry() {}
+	FRepeatingOneShotScheduleEntry(double a_DueTime, int32 a_Index, uint32 a_ScheduleSerial)
+		: DueTime(a_DueTime)
+		, Index(a_Index)
+		, ScheduleSerial(a_ScheduleSerial)
+	{}
+
+	FORCEINLINE bool operator<(const FRepeatingOneShotScheduleEntry& Other) const { return DueTime < Other.DueTime; }
+};
+
+// min-heap of scheduled repeating one shot posts within one world
+struct FRepeatingOneShotWorldScheduler
+{
+	TArray<FRepeatingOneShotScheduleEntry> Heap{};
+
+	FORCEINLINE void Push(double DueTime, int32 Index, uint32 ScheduleSerial)
+	{
+		Heap.HeapPush(FRepeatingOneShotScheduleEntry(DueTime, Index, ScheduleSerial));
+	}
+
+	/** moves all entries due at CurrentTime into OutDueEntries, earliest first */
+	FORCEINLINE void PopDue(double CurrentTime, TArray<FRepeatingOneShotScheduleEntry>& OutDueEntries)
+	{
+		while (!Heap.IsEmpty() && Heap.HeapTop().DueTime <= CurrentTime)
+		{
+			Heap.HeapPop(OutDueEntries.AddDefaulted_GetRef(), false);
+		}
+	}
+};
+
+/**
+ * RepeatingOneShotManager
+ * -----------------------
+ *
+ * - schedules all repeating one shots in plain structs, replacing a UObject, dynamic delegate and timer per repeating one shot
+ * - keeps one min-heap of due posts per world, keyed on the next post time (double precision world time). Paused, ended and rescheduled
+ *   entries are invalidated lazily
+ * - due entries of emitters out of listener range are rescheduled without touching the emitter's game object
+ * - URepeatingOneShot is kept as a thin Blueprint wrapper around a handle, for callbacks and the existing Blueprint API
+ */
+UCLASS(ClassGroup = "WwiserR")
+class WWISERR_API URepeatingOneShotManager : public UObject, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+protected:
+	TSparseArray<FRepeatingOneShotEntry> m_entries{};
+	TMap<UWorld*, FRepeatingOneShotWorldScheduler> m_worldSchedulers{};
+	TArray<FRepeatingOneShotScheduleEntry> m_dueEntries{};	// persistent scratch buffer
+	uint32 m_nextSerial = 0;
+
+private:
+	uint32 m_lastTickFrame = INDEX_NONE;
+
+public:
+	void Initialize();
+	void Deinitialize();
+
+	/** posts the first one shot of Entry and schedules the next ones */
+	FRepeatingOneShotHandle Start(FRepeatingOneShotEntry&& Entry);
+
+	/** stops scheduling new one shots, the last one shot keeps playing unless bStopPlayingEventImmediately */
+	void Pause(const FRepeatingOneShotHandle& Handle, bool bStopPlayingEventImmediately, int32 TransitionDurationInMs,
+		EAkCurveInterpolation FadeCurve);
+	bool Resume(const FRepeatingOneShotHandle& Handle);
+
+	/** ends the repeating one shot once its last one shot ended, or immediately if bStopPlayingEventImmediately */
+	bool End(const FRepeatingOneShotHandle& Handle, bool bStopPlayingEventImmediately, int32 TransitionDurationInMs,
+		EAkCurveInterpolation FadeCurve);
+
+	/** removes the entry without notifying its wrapper */
+	void Remove(const FRepeatingOneShotHandle& Handle);
+
+	/** called by wrappers when their one shot ended */
+	void OnOneShotEnded(const FRepeatingOneShotHandle& Handle);
+
+	bool IsPlaying(const FRepeatingOneShotHandle& Handle) const;
+	const FRepeatingOneShotEntry* Find(const FRepeatingOneShotHandle& Handle) const;
+
+	FORCEINLINE int32 Num() const { return m_entries.Num(); }
+
+protected:
+	FRepeatingOneShotEntry* Find(const FRepeatingOneShotHandle& Handle);
+	void PostDueEntry(int32 Index);
+	void ScheduleNext(int32 Index, USoundEmitterComponentBase* SoundEmitter);
+	void SchedulePoll(int32 Index, USoundEmitterComponentBase* SoundEmitter);
+	void EndEntry(int32 Index);
+	bool IsEntryPlaying(const FRepeatingOneShotEntry& Entry) const;
+	void OnPostWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+#pragma region Tick
+public:
+	void Tick(float DeltaTime) override;
+
+	FORCEINLINE bool IsTickable() const override { return !m_worldSchedulers.IsEmpty(); }
+	FORCEINLINE ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	FORCEINLINE TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(URepeatingOneShotManager, STATGROUP_Tickables); }
+	FORCEINLINE bool IsTickableWhenPaused() const override { return false; }
+	FORCEINLINE bool IsTickableInEditor() const override { return false; }
+#pragma endregion
+};
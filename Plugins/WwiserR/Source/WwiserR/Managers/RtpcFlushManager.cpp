@@ -0,0 +1,47 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#include "RtpcFlushManager.h"
+#include "SoundEmitters/SoundEmitterComponentBase.h"
+#include "Core/AudioUtils.h"
+
+void URtpcFlushManager::Initialize()
+{
+	WR_DBG_NET(Log, "initialized (%s)", *UAudioUtils::GetClientOrServerString(GetWorld()));
+}
+
+void URtpcFlushManager::Deinitialize()
+{
+	Flush();
+
+	m_dirtyEmitters.Empty();
+	m_flushingEmitters.Empty();
+
+	WR_DBG_NET(Log, "deinitialized (%s)", *UAudioUtils::GetClientOrServerString(GetWorld()));
+}
+
+void URtpcFlushManager::Flush()
+{
+	// Rtpcs set while flushing are flushed next frame
+	Swap(m_dirtyEmitters, m_flushingEmitters);
+
+	for (const TWeakObjectPtr<USoundEmitterComponentBase>& weakSoundEmitter : m_flushingEmitters)
+	{
+		if (USoundEmitterComponentBase* soundEmitter = weakSoundEmitter.Get())
+		{
+			soundEmitter->m_isRtpcFlushPending = false;
+			soundEmitter->FlushRtpcs();
+		}
+	}
+
+	m_flushingEmitters.Reset();
+}
+
+#pragma region Tick
+void URtpcFlushManager::Tick(float DeltaTime)
+{
+	if (m_lastTickFrame == GFrameCounter) { return; }
+	m_lastTickFrame = GFrameCounter;
+
+	Flush();
+}
+#pragma endregion
@@ -0,0 +1,53 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Tickable.h"
+#include "RtpcFlushManager.generated.h"
+
+class USoundEmitterComponentBase;
+
+/**
+ * RtpcFlushManager
+ * ----------------
+ *
+ * - sends the Rtpcs set on sound emitters in one flush per frame, after gameplay has ticked, instead of on every write
+ * - sound emitters only mark their Rtpc table entries dirty when written, multiple writes per frame are coalesced into the last value
+ *   and interpolation time
+ * - written and sent Rtpc values are counted per frame (stat WwiserR)
+ */
+UCLASS(ClassGroup = "WwiserR")
+class WWISERR_API URtpcFlushManager : public UObject, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+protected:
+	TArray<TWeakObjectPtr<USoundEmitterComponentBase>> m_dirtyEmitters{};
+	TArray<TWeakObjectPtr<USoundEmitterComponentBase>> m_flushingEmitters{};	// persistent scratch buffer
+
+private:
+	uint32 m_lastTickFrame = INDEX_NONE;
+
+public:
+	void Initialize();
+	void Deinitialize();
+
+	/** flushes the dirty Rtpcs of SoundEmitter at the end of the frame */
+	FORCEINLINE void AddDirtyEmitter(USoundEmitterComponentBase* SoundEmitter) { m_dirtyEmitters.Add(SoundEmitter); }
+
+protected:
+	void Flush();
+
+#pragma region Tick
+public:
+	void Tick(float DeltaTime) override;
+
+	FORCEINLINE bool IsTickable() const override { return !m_dirtyEmitters.IsEmpty(); }
+	FORCEINLINE ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	FORCEINLINE TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(URtpcFlushManager, STATGROUP_Tickables); }
+	FORCEINLINE bool IsTickableWhenPaused() const override { return true; }
+	FORCEINLINE bool IsTickableInEditor() const override { return false; }
+#pragma endregion
+};
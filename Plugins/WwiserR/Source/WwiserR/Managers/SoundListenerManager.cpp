@@ -243,6 +243,9 @@ void USoundListenerManagerComponent::TickComponent(float DeltaTime, ELevelTick T
 	m_lastListenerPosition = listenerPos;
 	//m_lastListenerRotation = listenerRot;
 
+	// the distance probe has moved, publish before emitters cull against it
+	m_ListenerManager->PublishListenerSnapshot();
+
 	if (Private_ListenerManager::bDebugDraw)
 	{
 		DebugDraw();
@@ -1115,6 +1118,7 @@ void USoundListenerManager::OnSpatialAudioListenerChanged_Internal(UAkComponent*
 	m_spatialAudioListener = NewSpatialAudioListener;
 	m_spatialAudioListenerID = NewSpatialAudioListener->GetAkGameObjectID();
 	m_currentListenerIds.Add(m_spatialAudioListenerID);
+	m_lastSnapshotFrame = MAX_uint64;	// republish on next query
 
 #if WITH_EDITOR
 	if (UEditorAudioUtils::IsRunningUnderOneProcess(GetWorld()))
@@ -1397,11 +1401,72 @@ void USoundListenerManager::AddWorldListener(UWorldSoundListener* WorldListener)
 {
 	m_worldListeners.Add(WorldListener);
 	m_currentListenerIds.Add(WorldListener->GetAkGameObjectID());
+	m_lastSnapshotFrame = MAX_uint64;	// republish on next query
 }
 
 void USoundListenerManager::RemoveWorldListener(UWorldSoundListener* WorldListener)
 {
 	m_worldListeners.Remove(WorldListener);
 	m_currentListenerIds.Remove(WorldListener->GetAkGameObjectID());
+	m_lastSnapshotFrame = MAX_uint64;	// republish on next query
+}
+
+const FListenerSnapshot& USoundListenerManager::GetListenerSnapshot()
+{
+	if (m_lastSnapshotFrame != GFrameCounter)
+	{
+		PublishListenerSnapshot();
+	}
+
+	return m_listenerSnapshot;
+}
+
+void USoundListenerManager::PublishListenerSnapshot()
+{
+	m_lastSnapshotFrame = GFrameCounter;
+	m_pendingSnapshotListeners.Reset();
+
+	uint32 numWorldListeners = 0;
+
+	// world listeners
+	for (const TWeakObjectPtr<UWorldSoundListener>& worldListener : m_worldListeners)
+	{
+		if (worldListener.IsValid())
+		{
+			m_pendingSnapshotListeners.Emplace(worldListener->GetComponentLocation(), worldListener->GetMaxSpeed(),
+				worldListener->GetAkGameObjectID(), EListenerSnapshotKind::WorldListener);
+			numWorldListeners++;
+		}
+	}
+
+	// default listeners
+	if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
+	{
+		for (const TWeakObjectPtr<UAkComponent>& defaultListener : AkAudioDevice->GetDefaultListeners())
+		{
+			if (defaultListener.IsValid() && defaultListener.Get() != AkAudioDevice->GetSpatialAudioListener())
+			{
+				m_pendingSnapshotListeners.Emplace(defaultListener->GetComponentLocation(), m_defaultListenerMaxSpeed,
+					defaultListener->GetAkGameObjectID(), EListenerSnapshotKind::DefaultListener);
+			}
+		}
+	}
+
+	// spatial audio listener
+	const bool bHasDistanceProbe = IsValid(m_SoundListenerManagerComponent) && IsValid(m_SoundListenerManagerComponent->GetDistanceProbe());
+
+	if (bHasDistanceProbe || IsValid(m_spatialAudioListener))
+	{
+		m_pendingSnapshotListeners.Emplace(GetDistanceProbePosition(), GetDistanceProbeMaxSpeed(),
+			IsValid(m_spatialAudioListener) ? m_spatialAudioListener->GetAkGameObjectID() : AK_INVALID_GAME_OBJECT,
+			EListenerSnapshotKind::SpatialAudioListener);
+	}
+
+	if (m_pendingSnapshotListeners != m_listenerSnapshot.Listeners)
+	{
+		Swap(m_pendingSnapshotListeners, m_listenerSnapshot.Listeners);
+		m_listenerSnapshot.NumWorldListeners = numWorldListeners;
+		m_listenerSnapshot.Version++;
+	}
 }
 #pragma endregion
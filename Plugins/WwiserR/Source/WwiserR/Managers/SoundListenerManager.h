@@ -132,6 +132,43 @@ public:
 		}
 	}
 };
+
+enum class EListenerSnapshotKind : uint8
+{
+	WorldListener,
+	DefaultListener,
+	SpatialAudioListener	// positioned at the distance probe, which is the attenuation reference of the spatial audio listener
+};
+
+struct WWISERR_API FListenerSnapshotEntry
+{
+	FVector					Position = FVector::ZeroVector;
+	float					MaxSpeed = 0.f;
+	AkGameObjectID			GameObjectID = AK_INVALID_GAME_OBJECT;
+	EListenerSnapshotKind	Kind = EListenerSnapshotKind::WorldListener;
+
+	FListenerSnapshotEntry() {}
+	FListenerSnapshotEntry(const FVector& a_Position, float a_MaxSpeed, AkGameObjectID a_GameObjectID, EListenerSnapshotKind a_Kind)
+		: Position(a_Position)
+		, MaxSpeed(a_MaxSpeed)
+		, GameObjectID(a_GameObjectID)
+		, Kind(a_Kind)
+	{}
+
+	FORCEINLINE bool operator==(const FListenerSnapshotEntry& Other) const
+	{
+		return Position == Other.Position && MaxSpeed == Other.MaxSpeed && GameObjectID == Other.GameObjectID && Kind == Other.Kind;
+	}
+};
+
+// read-only view of all listeners relevant to distance culling, published once per frame by the listener manager.
+// Version only increments when any listener was added, removed, moved or changed max speed, so readers can skip redundant work
+struct WWISERR_API FListenerSnapshot
+{
+	TArray<FListenerSnapshotEntry> Listeners{};
+	uint32 Version = 0;
+	uint32 NumWorldListeners = 0;
+};
 #pragma endregion
 
 #pragma region Data Asset
@@ -338,8 +375,12 @@ protected:
 	FListenerManagerComponentProperties m_listenerManagerComponentProperties{};
 	float	m_defaultListenerMaxSpeed{};
 
+	FListenerSnapshot m_listenerSnapshot{};
+	TArray<FListenerSnapshotEntry> m_pendingSnapshotListeners{};	// persistent scratch buffer
+
 private:
 	uint32 m_lastTickFrame = INDEX_NONE;
+	uint64 m_lastSnapshotFrame = MAX_uint64;
 
 #if WITH_EDITOR
 	inline static TArray<USoundListenerManager*> s_allConnectedListenerManagers{};
@@ -358,7 +399,13 @@ public:
 #if WITH_EDITOR
 	FORCEINLINE static TArray<USoundListenerManager*> GetAllConnectedListenerManagers() { return s_allConnectedListenerManagers; }
 #endif
-	FORCEINLINE TSet<TWeakObjectPtr<UWorldSoundListener>> GetWorldListeners() { return m_worldListeners; }
+	FORCEINLINE const TSet<TWeakObjectPtr<UWorldSoundListener>>& GetWorldListeners() const { return m_worldListeners; }
+
+	/** returns the listener snapshot of the current frame, publishing it first if that didn't happen yet this frame */
+	const FListenerSnapshot& GetListenerSnapshot();
+	/** rebuilds the listener snapshot, and increments its version if anything changed since it was last published */
+	void PublishListenerSnapshot();
+
 	void AddWorldListener(UWorldSoundListener* WorldListener);
 	void RemoveWorldListener(UWorldSoundListener* WorldListener);
 	//void UpdateListeners(UAkComponent* AkComponent);
@@ -0,0 +1,122 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#include "Managers/StaticSoundEmitterDatabase.h"
+#include "Managers/StaticSoundEmitterManager.h"
+#include "SoundEmitters/StaticSoundEmitterComponent.h"
+#include "SoundEmitters/InstancedStaticSoundEmitterComponent.h"
+#include "DataAssets/DA_StaticSoundLoop.h"
+#include "Config/AudioConfig.h"
+#include "Core/AudioUtils.h"
+#include "AkAudioEvent.h"
+#include "Engine/Level.h"
+
+namespace Private_StaticSoundEmitterDatabase
+{
+	static constexpr int32 Version = 1;
+} // namespace Private_StaticSoundEmitterDatabase
+
+void UStaticSoundEmitterDatabase::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	int32 version = Private_StaticSoundEmitterDatabase::Version;
+	Ar << version;
+
+	if (Ar.IsLoading() && version != Private_StaticSoundEmitterDatabase::Version)
+	{
+		// outdated, emitters fall back to registering on BeginPlay until the level is resaved
+		Records.Empty();
+		return;
+	}
+
+	Ar << RangeTresholdsHash;
+	Ar << Records;
+}
+
+uint32 UStaticSoundEmitterDatabase::GetRangeTresholdsHash(const TArray<float>& RangeTresholds)
+{
+	return FCrc::MemCrc32(RangeTresholds.GetData(), RangeTresholds.Num() * RangeTresholds.GetTypeSize());
+}
+
+#if WITH_EDITOR
+void UStaticSoundEmitterDatabase::BakeLevel(ULevel* Level)
+{
+	if (!IsValid(Level)) { return; }
+
+	Level->RemoveUserDataOfClass(UStaticSoundEmitterDatabase::StaticClass());
+
+	if (!GetDefault<UWwiserRGameSettings>()->bUseBakedStaticSoundEmitters) { return; }
+
+	UStaticSoundEmitterDatabase* database = NewObject<UStaticSoundEmitterDatabase>(Level);
+	const TArray<float> rangeTresholds = AStaticSoundEmitterWorldManager::GetRangeTresholds();
+	database->RangeTresholdsHash = GetRangeTresholdsHash(rangeTresholds);
+
+	TMap<UDA_StaticSoundLoop*, uint16> loopIndices{};
+	TSet<uint32> stableIDs{};
+
+	for (AActor* actor : Level->Actors)
+	{
+		if (!IsValid(actor)) { continue; }
+
+		TInlineComponentArray<UStaticSoundEmitterComponent*> staticSoundEmitterComponents(actor);
+
+		for (UStaticSoundEmitterComponent* staticSoundEmitterComponent : staticSoundEmitterComponents)
+		{
+			staticSoundEmitterComponent->m_bakedSlot = INDEX_NONE;
+
+			// instances are indexed from the component's own transforms when it posts its loops
+			if (staticSoundEmitterComponent->IsA<UInstancedStaticSoundEmitterComponent>()) { continue; }
+
+			// stable IDs only change when they collide, e.g. after duplicating an actor in the editor
+			bool bIsAlreadyInSet = staticSoundEmitterComponent->m_stableID == 0;
+			if (!bIsAlreadyInSet) { stableIDs.Add(staticSoundEmitterComponent->m_stableID, &bIsAlreadyInSet); }
+
+			while (bIsAlreadyInSet)
+			{
+				staticSoundEmitterComponent->m_stableID = GetTypeHash(FGuid::NewGuid());
+				bIsAlreadyInSet = staticSoundEmitterComponent->m_stableID == 0;
+				if (!bIsAlreadyInSet) { stableIDs.Add(staticSoundEmitterComponent->m_stableID, &bIsAlreadyInSet); }
+			}
+
+			const FVector3f location(staticSoundEmitterComponent->GetComponentLocation());
+			TSet<UDA_StaticSoundLoop*, DefaultKeyFuncs<UDA_StaticSoundLoop*>, TInlineSetAllocator<4>> bakedLoops{};
+
+			for (UDA_StaticSoundLoop* staticSoundLoop : staticSoundEmitterComponent->StaticSoundLoops)
+			{
+				if (!IsValid(staticSoundLoop) || !IsValid(staticSoundLoop->LoopEvent)) { continue; }
+
+				bool bIsDuplicateLoop = false;
+				bakedLoops.Add(staticSoundLoop, &bIsDuplicateLoop);
+				if (bIsDuplicateLoop) { continue; }
+
+				const float activationRange = AStaticSoundEmitterWorldManager::GetActivationRange(staticSoundLoop);
+				if (activationRange <= 0.f) { continue; }
+
+				uint16* loopIndex = loopIndices.Find(staticSoundLoop);
+				if (loopIndex == nullptr)
+				{
+					loopIndex = &loopIndices.Add(staticSoundLoop, (uint16)database->Loops.Add(staticSoundLoop));
+				}
+
+				if (staticSoundEmitterComponent->m_bakedSlot == INDEX_NONE)
+				{
+					staticSoundEmitterComponent->m_bakedSlot = database->Records.Num();
+				}
+
+				FStaticSoundEmitterRecord& record = database->Records.AddDefaulted_GetRef();
+				record.Location = location;
+				record.StableID = staticSoundEmitterComponent->m_stableID;
+				record.LoopIndex = *loopIndex;
+				record.RangeIndex = AStaticSoundEmitterWorldManager::GetDistanceRangeIndex(rangeTresholds, activationRange);
+			}
+		}
+	}
+
+	if (!database->Records.IsEmpty())
+	{
+		Level->AddAssetUserData(database);
+		WR_DBG_STATIC_FUNC(Log, "%i static sound emitters baked for %i loops in %s", database->Records.Num(), database->Loops.Num(),
+			*Level->GetOutermost()->GetName());
+	}
+}
+#endif
@@ -0,0 +1,56 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/AssetUserData.h"
+#include "StaticSoundEmitterDatabase.generated.h"
+
+class UDA_StaticSoundLoop;
+class ULevel;
+
+// baked static sound emitter, one per emitter component and loop
+struct FStaticSoundEmitterRecord
+{
+	FVector3f Location{};
+	uint32 StableID = 0;	// UStaticSoundEmitterComponent stable ID, records of one component are contiguous
+	uint16 LoopIndex = 0;	// into UStaticSoundEmitterDatabase::Loops
+	uint8 RangeIndex = 0;	// distance range at bake time
+
+	friend FArchive& operator<<(FArchive& Ar, FStaticSoundEmitterRecord& Record)
+	{
+		return Ar << Record.Location << Record.StableID << Record.LoopIndex << Record.RangeIndex;
+	}
+};
+
+/**
+ * StaticSoundEmitterDatabase
+ * --------------------------
+ *
+ * - the static sound emitters of a level and the loops they post on BeginPlay, baked when the level is saved or cooked
+ * - stored as asset user data of the level, records are serialized as a compact binary table
+ * - the world manager bulk builds its index from it when the first component of the level posts a loop. Components attach to their
+ *   baked slot by stable ID instead of being inserted one by one
+ */
+UCLASS(ClassGroup = "WwiserR")
+class WWISERR_API UStaticSoundEmitterDatabase : public UAssetUserData
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<UDA_StaticSoundLoop*> Loops{};
+
+	TArray<FStaticSoundEmitterRecord> Records{};
+	uint32 RangeTresholdsHash = 0;	// distance ranges the range indices were baked with
+
+public:
+	void Serialize(FArchive& Ar) override;
+
+	static uint32 GetRangeTresholdsHash(const TArray<float>& RangeTresholds);
+
+#if WITH_EDITOR
+	/** bakes the static sound emitters of Level into a new database, the previous one is removed */
+	static void BakeLevel(ULevel* Level);
+#endif
+};
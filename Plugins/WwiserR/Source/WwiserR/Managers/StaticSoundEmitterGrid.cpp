@@ -0,0 +1,261 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#include "StaticSoundEmitterGrid.h"
+#include "Managers/StaticSoundEmitterManager.h"
+#include "SoundEmitters/StaticSoundEmitterComponent.h"
+#include "SoundEmitters/InstancedStaticSoundEmitterComponent.h"
+#include "Core/AudioUtils.h"
+
+namespace Private_StaticSoundEmitterGrid
+{
+	// INDEX_NONE packs to MAX_uint16, which UInstancedStaticSoundEmitterComponent::MaxInstances keeps free
+	static FORCEINLINE uint64 GetElementKey(const UStaticSoundEmitterComponent* StaticSoundEmitterComponent, int32 InstanceIndex,
+		uint16 LoopIndex)
+	{
+		return ((uint64)StaticSoundEmitterComponent->GetUniqueID() << 32) | ((uint64)(uint16)InstanceIndex << 16) | LoopIndex;
+	}
+} // namespace Private_StaticSoundEmitterGrid
+
+FStaticSoundEmitterGrid::FStaticSoundEmitterGrid(float a_CellSize)
+	: m_cellSize(FMath::Max(a_CellSize, 100.f))
+	, m_invCellSize(1.f / FMath::Max(a_CellSize, 100.f))
+{}
+
+bool FStaticSoundEmitterGrid::AddEmitter(UStaticSoundEmitterComponent* StaticSoundEmitterComponent, UDA_StaticSoundLoop* StaticSoundLoop)
+{
+	const uint16 loopIndex = GetOrAddLoopIndex(StaticSoundLoop);
+
+	if (const UInstancedStaticSoundEmitterComponent* instancedComponent = Cast<UInstancedStaticSoundEmitterComponent>(StaticSoundEmitterComponent))
+	{
+		bool bWasAdded = false;
+		Reserve(instancedComponent->GetInstanceCount());
+
+		for (int32 instanceIndex = 0; instanceIndex < instancedComponent->GetInstanceCount(); instanceIndex++)
+		{
+			const uint64 key = Private_StaticSoundEmitterGrid::GetElementKey(StaticSoundEmitterComponent, instanceIndex, loopIndex);
+			if (m_elementIndices.Contains(key)) { continue; }
+
+			m_elementIndices.Add(key, AddElement(instancedComponent->GetInstanceWorldTransform(instanceIndex).GetLocation(),
+				StaticSoundEmitterComponent, loopIndex, instanceIndex, 0));
+			bWasAdded = true;
+		}
+
+		return bWasAdded;
+	}
+
+	const uint64 key = Private_StaticSoundEmitterGrid::GetElementKey(StaticSoundEmitterComponent, INDEX_NONE, loopIndex);
+	if (m_elementIndices.Contains(key)) { return false; }
+
+	m_elementIndices.Add(key, AddElement(StaticSoundEmitterComponent->GetComponentLocation(), StaticSoundEmitterComponent, loopIndex,
+		INDEX_NONE, 0));
+	return true;
+}
+
+bool FStaticSoundEmitterGrid::RemoveEmitter(const UStaticSoundEmitterComponent* StaticSoundEmitterComponent,
+	const UDA_StaticSoundLoop* StaticSoundLoop)
+{
+	const uint16* loopIndex = m_loopIndices.Find(StaticSoundLoop);
+	if (loopIndex == nullptr) { return false; }
+
+	if (const UInstancedStaticSoundEmitterComponent* instancedComponent = Cast<UInstancedStaticSoundEmitterComponent>(StaticSoundEmitterComponent))
+	{
+		bool bWasRemoved = false;
+
+		for (int32 instanceIndex = 0; instanceIndex < instancedComponent->GetInstanceCount(); instanceIndex++)
+		{
+			bWasRemoved |= RemoveEmitterInstance(StaticSoundEmitterComponent, instanceIndex, *loopIndex);
+		}
+
+		return bWasRemoved;
+	}
+
+	return RemoveEmitterInstance(StaticSoundEmitterComponent, INDEX_NONE, *loopIndex);
+}
+
+bool FStaticSoundEmitterGrid::RemoveEmitterInstance(const UStaticSoundEmitterComponent* StaticSoundEmitterComponent, int32 InstanceIndex,
+	uint16 LoopIndex)
+{
+	int32 index;
+	if (!m_elementIndices.RemoveAndCopyValue(Private_StaticSoundEmitterGrid::GetElementKey(StaticSoundEmitterComponent, InstanceIndex, LoopIndex),
+		index))
+	{
+		return false;
+	}
+
+	RemoveElementAt(index);
+	return true;
+}
+
+void FStaticSoundEmitterGrid::AddBakedEmitter(const FVector& Location, UDA_StaticSoundLoop* StaticSoundLoop, uint64 BakedKey)
+{
+	if (m_bakedElementIndices.Contains(BakedKey)) { return; }
+
+	m_bakedElementIndices.Add(BakedKey, AddElement(Location, nullptr, GetOrAddLoopIndex(StaticSoundLoop), INDEX_NONE, BakedKey));
+}
+
+bool FStaticSoundEmitterGrid::AttachEmitter(uint64 BakedKey, UStaticSoundEmitterComponent* StaticSoundEmitterComponent)
+{
+	int32 index;
+	if (!m_bakedElementIndices.RemoveAndCopyValue(BakedKey, index)) { return false; }
+
+	FStaticSoundEmitterGridElement& element = m_elements[index];
+	element.Emitter = StaticSoundEmitterComponent;
+	m_elementIndices.Add(Private_StaticSoundEmitterGrid::GetElementKey(StaticSoundEmitterComponent, INDEX_NONE, element.LoopIndex), index);
+
+	return true;
+}
+
+bool FStaticSoundEmitterGrid::RemoveBakedEmitter(uint64 BakedKey)
+{
+	int32 index;
+	if (!m_bakedElementIndices.RemoveAndCopyValue(BakedKey, index)) { return false; }
+
+	RemoveElementAt(index);
+	return true;
+}
+
+uint16 FStaticSoundEmitterGrid::GetOrAddLoopIndex(UDA_StaticSoundLoop* StaticSoundLoop)
+{
+	if (const uint16* existingLoopIndex = m_loopIndices.Find(StaticSoundLoop))
+	{
+		return *existingLoopIndex;
+	}
+
+	WR_ASSERT(m_loops.Num() < MAX_uint16, "too many static sound loops in one distance range");
+
+	const uint16 loopIndex = (uint16)m_loops.Add(StaticSoundLoop);
+	m_loopIndices.Add(StaticSoundLoop, loopIndex);
+	m_numEmittersPerLoop.Add(0);
+
+	return loopIndex;
+}
+
+int32 FStaticSoundEmitterGrid::AddElement(const FVector& Location, UStaticSoundEmitterComponent* StaticSoundEmitterComponent,
+	uint16 LoopIndex, int32 InstanceIndex, uint64 BakedKey)
+{
+	const FIntPoint cell = GetCell(Location);
+
+	const int32 index = m_elements.Emplace(Location, StaticSoundEmitterComponent, cell, LoopIndex, InstanceIndex, BakedKey);
+	m_cells.FindOrAdd(cell).Add(index);
+	m_numEmittersPerLoop[LoopIndex]++;
+
+	return index;
+}
+
+void FStaticSoundEmitterGrid::RemoveElementAt(int32 Index)
+{
+	m_numEmittersPerLoop[m_elements[Index].LoopIndex]--;
+
+	// remove from its cell
+	const FIntPoint cell = m_elements[Index].Cell;
+	TArray<int32>& cellElements = m_cells.FindChecked(cell);
+	cellElements.RemoveSingleSwap(Index, false);
+
+	if (cellElements.IsEmpty())
+	{
+		m_cells.Remove(cell);
+	}
+
+	// move the last element into the freed slot
+	const int32 lastIndex = m_elements.Num() - 1;
+
+	if (Index != lastIndex)
+	{
+		const FStaticSoundEmitterGridElement& lastElement = m_elements[lastIndex];
+
+		TArray<int32>& lastCellElements = m_cells.FindChecked(lastElement.Cell);
+		lastCellElements[lastCellElements.IndexOfByKey(lastIndex)] = Index;
+
+		if (lastElement.Emitter != nullptr)
+		{
+			m_elementIndices.FindChecked(
+				Private_StaticSoundEmitterGrid::GetElementKey(lastElement.Emitter, lastElement.InstanceIndex, lastElement.LoopIndex)) = Index;
+		}
+		else
+		{
+			m_bakedElementIndices.FindChecked(lastElement.BakedKey) = Index;
+		}
+	}
+
+	m_elements.RemoveAtSwap(Index, 1, false);
+}
+
+int32 FStaticSoundEmitterGrid::GetNumEmitters(const UDA_StaticSoundLoop* StaticSoundLoop) const
+{
+	const uint16* loopIndex = m_loopIndices.Find(StaticSoundLoop);
+	return loopIndex != nullptr ? m_numEmittersPerLoop[*loopIndex] : 0;
+}
+
+int32 FStaticSoundEmitterGrid::GetNumLoops() const
+{
+	int32 numLoops = 0;
+
+	for (const int32 numEmitters : m_numEmittersPerLoop)
+	{
+		if (numEmitters > 0) { numLoops++; }
+	}
+
+	return numLoops;
+}
+
+int32 FStaticSoundEmitterGrid::Query(const FBox& Bounds, const TArray<FStaticSoundEmitterGridQuery>& Queries) const
+{
+	if (m_elements.IsEmpty() || !Bounds.IsValid) { return 0; }
+
+	const FIntPoint minCell = GetCell(Bounds.Min);
+	const FIntPoint maxCell = GetCell(Bounds.Max);
+	const int64 numOverlappedCells = (int64)(maxCell.X - minCell.X + 1) * (int64)(maxCell.Y - minCell.Y + 1);
+
+	int32 numTested = 0;
+
+	auto binCell = [&](const TArray<int32>& CellElements)
+		{
+			for (const int32 index : CellElements)
+			{
+				BinElement(m_elements[index], Queries);
+			}
+
+			numTested += CellElements.Num();
+		};
+
+	if (numOverlappedCells <= m_cells.Num())
+	{
+		for (int32 y = minCell.Y; y <= maxCell.Y; y++)
+		{
+			for (int32 x = minCell.X; x <= maxCell.X; x++)
+			{
+				if (const TArray<int32>* cellElements = m_cells.Find(FIntPoint(x, y)))
+				{
+					binCell(*cellElements);
+				}
+			}
+		}
+	}
+	else
+	{
+		for (const TPair<FIntPoint, TArray<int32>>& cell : m_cells)
+		{
+			if (cell.Key.X >= minCell.X && cell.Key.X <= maxCell.X && cell.Key.Y >= minCell.Y && cell.Key.Y <= maxCell.Y)
+			{
+				binCell(cell.Value);
+			}
+		}
+	}
+
+	return numTested;
+}
+
+void FStaticSoundEmitterGrid::BinElement(const FStaticSoundEmitterGridElement& Element,
+	const TArray<FStaticSoundEmitterGridQuery>& Queries) const
+{
+	const FStaticSoundEmitterGridQuery& query = Queries[Element.LoopIndex];
+	if (query.Selection == nullptr || Element.Emitter == nullptr) { return; }
+
+	const float distanceToListenerSquared = FVector::DistSquared(query.ReferencePosition, Element.Location);
+
+	if (distanceToListenerSquared < query.ActivationRangeSquared)
+	{
+		query.Selection->TryToAddEmitter(Element.Emitter, distanceToListenerSquared, GetQuadrant(Element.Location, query.ReferencePosition),
+			Element.InstanceIndex);
+	}
+}
@@ -0,0 +1,106 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UDA_StaticSoundLoop;
+class UStaticSoundEmitterComponent;
+struct FStaticSoundEmittersInRange;
+
+// static sound emitter posted with a loop, the location is cached since static emitters don't move
+struct FStaticSoundEmitterGridElement
+{
+	FVector Location{};
+	UStaticSoundEmitterComponent* Emitter{};	// nullptr while a baked emitter's component isn't attached
+	FIntPoint Cell{};
+	uint16 LoopIndex = 0;
+	int32 InstanceIndex = INDEX_NONE;			// instanced emitters only
+	uint64 BakedKey = 0;						// baked emitters only
+
+	FStaticSoundEmitterGridElement() {}
+	FStaticSoundEmitterGridElement(const FVector& a_Location, UStaticSoundEmitterComponent* a_Emitter, const FIntPoint& a_Cell,
+		uint16 a_LoopIndex, int32 a_InstanceIndex, uint64 a_BakedKey)
+		: Location(a_Location)
+		, Emitter(a_Emitter)
+		, Cell(a_Cell)
+		, LoopIndex(a_LoopIndex)
+		, InstanceIndex(a_InstanceIndex)
+		, BakedKey(a_BakedKey)
+	{}
+};
+
+// per loop query of the current tick, indexed on loop index
+struct FStaticSoundEmitterGridQuery
+{
+	FVector ReferencePosition{};
+	float ActivationRangeSquared = 0.f;
+	FStaticSoundEmittersInRange* Selection = nullptr;	// loops without a selection are skipped
+};
+
+/**
+ * StaticSoundEmitterGrid
+ * ----------------------
+ *
+ * - hashed 2d grid (XY) holding the static sound emitters of all loops within a distance range, with a loop index per element
+ * - one traversal per tick bins the emitters within range of their loop's reference position into per loop selections, instead of
+ *   one octree traversal per loop
+ * - only occupied cells are stored. Queries visit the overlapped cells, or all occupied cells if there are fewer
+ * - baked emitters are bulk added from a level's UStaticSoundEmitterDatabase, and skipped until their component attaches
+ * - each instance of a UInstancedStaticSoundEmitterComponent is a separate element
+ */
+class WWISERR_API FStaticSoundEmitterGrid
+{
+protected:
+	float m_cellSize = 2500.f;
+	float m_invCellSize = 1.f / 2500.f;
+
+	TArray<FStaticSoundEmitterGridElement> m_elements{};
+	TMap<FIntPoint, TArray<int32>> m_cells{};
+	TMap<uint64, int32> m_elementIndices{};	// emitter unique ID, instance index and loop index to element index
+	TMap<uint64, int32> m_bakedElementIndices{};	// baked key to element index, for baked emitters without attached component
+
+	TArray<UDA_StaticSoundLoop*> m_loops{};
+	TMap<UDA_StaticSoundLoop*, uint16> m_loopIndices{};
+	TArray<int32> m_numEmittersPerLoop{};
+
+public:
+	explicit FStaticSoundEmitterGrid(float a_CellSize);
+
+	bool AddEmitter(UStaticSoundEmitterComponent* StaticSoundEmitterComponent, UDA_StaticSoundLoop* StaticSoundLoop);
+	bool RemoveEmitter(const UStaticSoundEmitterComponent* StaticSoundEmitterComponent, const UDA_StaticSoundLoop* StaticSoundLoop);
+
+	/** baked emitters are added without component and skipped by queries until their component attaches */
+	void AddBakedEmitter(const FVector& Location, UDA_StaticSoundLoop* StaticSoundLoop, uint64 BakedKey);
+	bool AttachEmitter(uint64 BakedKey, UStaticSoundEmitterComponent* StaticSoundEmitterComponent);
+	bool RemoveBakedEmitter(uint64 BakedKey);
+
+	/** bins all elements within range of their loop's query into its selection, returns the number of elements tested */
+	int32 Query(const FBox& Bounds, const TArray<FStaticSoundEmitterGridQuery>& Queries) const;
+
+	FORCEINLINE const TArray<UDA_StaticSoundLoop*>& GetLoops() const { return m_loops; }
+	FORCEINLINE int32 GetNumEmitters(int32 LoopIndex) const { return m_numEmittersPerLoop[LoopIndex]; }
+	int32 GetNumEmitters(const UDA_StaticSoundLoop* StaticSoundLoop) const;
+	int32 GetNumLoops() const;		// loops with at least one emitter
+	FORCEINLINE int32 Num() const { return m_elements.Num(); }
+
+	FORCEINLINE void Reserve(int32 NumEmittersToAdd)
+	{
+		m_elements.Reserve(m_elements.Num() + NumEmittersToAdd);
+		m_elementIndices.Reserve(m_elementIndices.Num() + NumEmittersToAdd);
+	}
+
+protected:
+	FORCEINLINE FIntPoint GetCell(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt32(Location.X * m_invCellSize), FMath::FloorToInt32(Location.Y * m_invCellSize));
+	}
+
+	uint16 GetOrAddLoopIndex(UDA_StaticSoundLoop* StaticSoundLoop);
+	int32 AddElement(const FVector& Location, UStaticSoundEmitterComponent* StaticSoundEmitterComponent, uint16 LoopIndex,
+		int32 InstanceIndex, uint64 BakedKey);
+	bool RemoveEmitterInstance(const UStaticSoundEmitterComponent* StaticSoundEmitterComponent, int32 InstanceIndex, uint16 LoopIndex);
+	void RemoveElementAt(int32 Index);
+
+	void BinElement(const FStaticSoundEmitterGridElement& Element, const TArray<FStaticSoundEmitterGridQuery>& Queries) const;
+};
@@ -3,11 +3,36 @@
 #include "StaticSoundEmitterManager.h"
 #include "AkAudioEvent.h"
 #include "SoundEmitters/StaticSoundEmitterComponent.h"
+#include "SoundEmitters/InstancedStaticSoundEmitterComponent.h"
 #include "Managers/SoundListenerManager.h"
 #include "Core/AudioUtils.h"
+#include "Core/AllocationCounter.h"
 #include "Config/AudioConfig.h"
 #include "Engine/World.h"
-
+#include "HAL/LowLevelMemTracker.h"
+#include "Algo/Sort.h"
+#include "SoundEmitters/WorldSoundListenerComponent.h"
+#include "AkAudioDevice.h"
+#include "AkRoomComponent.h"
+#include "WwiseSoundEngine/Public/Wwise/API/WwiseSoundEngineAPI.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreaming.h"
+
+LLM_DEFINE_TAG(WwiserR_StaticSoundEmitters);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Static Loops Selected"), STAT_WwiserR_StaticLoopsSelected, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Static Loops Skipped"), STAT_WwiserR_StaticLoopsSkipped, STATGROUP_WwiserR);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Static Loops Skip Rate (%)"), STAT_WwiserR_StaticLoopsSkipRate, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Static Loops Scheduled"), STAT_WwiserR_StaticLoopsScheduled, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Static Loops Deferred"), STAT_WwiserR_StaticLoopsDeferred, STATGROUP_WwiserR);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Static Loops Scheduled Cost (ms)"), STAT_WwiserR_StaticLoopsScheduledCost, STATGROUP_WwiserR);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Static Emitters Baked"), STAT_WwiserR_StaticEmittersBaked, STATGROUP_WwiserR);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Static Emitters Attached"), STAT_WwiserR_StaticEmittersAttached, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Static Emitter Registrations Applied"), STAT_WwiserR_StaticEmitterRegistrationsApplied, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Static Emitter Registrations Pending"), STAT_WwiserR_StaticEmitterRegistrationsPending, STATGROUP_WwiserR);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Static Loop Voices Saved"), STAT_WwiserR_StaticLoopVoicesSaved, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Static Loops Container Growth (Bytes)"), STAT_WwiserR_StaticLoopsContainerGrowth, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Static Loops Allocations"), STAT_WwiserR_StaticLoopsAllocations, STATGROUP_WwiserR);
 
 namespace Private_StaticSoundEmitterManager
 {
@@ -19,11 +44,35 @@ static TAutoConsoleVariable<bool> CVar_StaticSoundEmitter_DebugDraw(
 	TEXT("WwiserR.StaticSoundEmitter.DebugDraw"), false, TEXT("Visual debugging. (0 = off, 1 = on)"), ECVF_Cheat);
 static TAutoConsoleVariable<bool> CVar_StaticSoundEmitter_ViewportStats(
 	TEXT("WwiserR.StaticSoundEmitter.ViewportStats"), false, TEXT("Show stats in viewport. (0 = off, 1 = on)"), ECVF_Cheat);
+static TAutoConsoleVariable<int32> CVar_StaticSoundEmitter_SpatialIndex(
+	TEXT("WwiserR.StaticSoundEmitter.SpatialIndex"), -1, TEXT("Spatial index of worlds initialized from now on. ")
+	TEXT("(-1 = project settings, 0 = octree per loop, 1 = shared grid)"), ECVF_Cheat);
+static TAutoConsoleVariable<bool> CVar_StaticSoundEmitter_TemporalCoherence(
+	TEXT("WwiserR.StaticSoundEmitter.TemporalCoherence"), true,
+	TEXT("Keep a loop's selection while its reference position, emitters and instance limits are unchanged. (0 = off, 1 = on)"), ECVF_Cheat);
+#if !UE_BUILD_SHIPPING
+static TAutoConsoleVariable<bool> CVar_StaticSoundEmitter_CountAllocations(
+	TEXT("WwiserR.StaticSoundEmitter.CountAllocations"), false,
+	TEXT("Count the heap allocations of the static loop updates in the Static Loops Allocations stat. Installs a counting allocator ")
+	TEXT("for the rest of the session. (0 = off, 1 = on)"), ECVF_Cheat);
+#endif
 
 bool bDebugConsole = false;
 bool bDebugConsoleOctreeStats = false;
 bool bDebugDraw = false;
 bool bViewPortStats = false;
+int32 SpatialIndex = -1;
+bool bTemporalCoherence = true;
+bool bCountAllocations = false;
+
+// smaller batches are inserted one by one
+static constexpr int32 MinBulkBuildEmitters = 64;
+
+// faster listener moves (in Centimeters per second) are teleports (level streaming, respawns), not sampled as listener speed
+static constexpr float TeleportSpeedThreshold = 10000.f;
+
+// baked emitters further than this from their component (in Centimeters) are replaced by the component
+static constexpr float BakedLocationTolerance = 1.f;
 
 static void OnStaticSoundEmitterManagerUpdate()
 {
@@ -41,6 +90,16 @@ static void OnStaticSoundEmitterManagerUpdate()
 	}
 #endif
 	bViewPortStats = CVar_StaticSoundEmitter_ViewportStats.GetValueOnGameThread();
+	SpatialIndex = CVar_StaticSoundEmitter_SpatialIndex.GetValueOnGameThread();
+	bTemporalCoherence = CVar_StaticSoundEmitter_TemporalCoherence.GetValueOnGameThread();
+
+#if !UE_BUILD_SHIPPING
+	bCountAllocations = CVar_StaticSoundEmitter_CountAllocations.GetValueOnGameThread();
+	if (bCountAllocations)
+	{
+		FAllocationCounter::Enable();
+	}
+#endif
 }
 
 FAutoConsoleVariableSink CStaticSoundEmitterManagerConsoleSink(FConsoleCommandDelegate::CreateStatic(&OnStaticSoundEmitterManagerUpdate));
@@ -56,34 +115,57 @@ FOnDebugViewportStatsChanged AStaticSoundEmitterWorldManager::OnDebugViewportSta
 #endif
 
 #pragma region Structs
-bool FStaticSoundEmittersInRange::TryToAddEmitter(UStaticSoundEmitterComponent* StaticSoundEmitterComponent,
-	const FVector a_StableListenerPosition, const float a_DistanceToListenerSquared, const EQuadrant a_Quadrant)
+FTransform FStaticSoundEmitterInstance::GetTransform() const
 {
-	FStaticEmitterQuadrant& currentQuadrant = m_StaticSoundEmitterQuadrants[(uint8)a_Quadrant];
+	return InstanceIndex == INDEX_NONE ? Emitter->GetComponentTransform()
+		: static_cast<const UInstancedStaticSoundEmitterComponent*>(Emitter)->GetInstanceWorldTransform(InstanceIndex);
+}
+
+uint32& FStaticSoundEmitterInstance::GetSelectionStamp() const
+{
+	return InstanceIndex == INDEX_NONE ? Emitter->m_selectionStamp
+		: static_cast<UInstancedStaticSoundEmitterComponent*>(Emitter)->GetInstanceSelectionStamp(InstanceIndex);
+}
 
-	if (m_Count >= m_MaxEmittersTotal)
+void FStaticSoundEmitterInstance::StartPlayAudio(UDA_StaticSoundLoop* StaticSoundLoop) const
+{
+	if (InstanceIndex == INDEX_NONE)
 	{
-		// if the current quadrant is full, replace the farthest emitter if the new emitter is closer
-		if (currentQuadrant.m_Count >= currentQuadrant.m_Emitters.Num())
-		{
-			if (a_DistanceToListenerSquared < currentQuadrant.m_MaxDistanceSquared)
-			{
-				currentQuadrant.m_Emitters[currentQuadrant.m_MaxDistanceIndex] = StaticSoundEmitterComponent;
-				currentQuadrant.FindAndUpdateQuadrantMaxDistance(a_StableListenerPosition);
+		Emitter->StartPlayAudio(StaticSoundLoop);
+	}
+	else
+	{
+		static_cast<UInstancedStaticSoundEmitterComponent*>(Emitter)->StartPlayInstance(StaticSoundLoop, InstanceIndex);
+	}
+}
 
-				return true;
-			}
+void FStaticSoundEmitterInstance::StopPlayAudio(UDA_StaticSoundLoop* StaticSoundLoop) const
+{
+	if (InstanceIndex == INDEX_NONE)
+	{
+		Emitter->StopPlayAudio(StaticSoundLoop);
+	}
+	else
+	{
+		static_cast<UInstancedStaticSoundEmitterComponent*>(Emitter)->StopPlayInstance(StaticSoundLoop, InstanceIndex);
+	}
+}
 
-			return false;
-		}
+bool FStaticSoundEmittersInRange::TryToAddEmitter(UStaticSoundEmitterComponent* StaticSoundEmitterComponent,
+	const float a_DistanceToListenerSquared, const EQuadrant a_Quadrant, const int32 a_InstanceIndex)
+{
+	FStaticEmitterQuadrant& currentQuadrant = m_StaticSoundEmitterQuadrants[(uint8)a_Quadrant];
 
+	// if the current quadrant is full, its farthest emitter is replaced if the new emitter is closer
+	if (m_Count >= m_MaxEmittersTotal && !currentQuadrant.IsFull())
+	{
 		// find the farthest emitter across all quadrants
 		float maxDistSquaredInAllQuadrants = -1.f;
 		uint8 maxDistSquaredQuadrantIndex = 0;
 
 		for (uint8 i = 0; i < 4; ++i)
 		{
-			const float quadrantMaxDistSquared = m_StaticSoundEmitterQuadrants[i].m_MaxDistanceSquared;
+			const float quadrantMaxDistSquared = m_StaticSoundEmitterQuadrants[i].GetMaxDistanceSquared();
 
 			if (quadrantMaxDistSquared > maxDistSquaredInAllQuadrants)
 			{
@@ -94,7 +176,7 @@ bool FStaticSoundEmittersInRange::TryToAddEmitter(UStaticSoundEmitterComponent*
 
 		// remove the farthest emitter if the new one is closer
 		if (a_DistanceToListenerSquared < maxDistSquaredInAllQuadrants
-			&& m_StaticSoundEmitterQuadrants[maxDistSquaredQuadrantIndex].RemoveFarthestEmitter(a_StableListenerPosition))
+			&& m_StaticSoundEmitterQuadrants[maxDistSquaredQuadrantIndex].RemoveFarthestEmitter())
 		{
 			m_Count--;
 		}
@@ -106,99 +188,114 @@ bool FStaticSoundEmittersInRange::TryToAddEmitter(UStaticSoundEmitterComponent*
 
 	// try to add new emitter to current quadrant
 	bool countIncreased;
-	bool wasAdded = currentQuadrant.TryToAddEmitter(StaticSoundEmitterComponent,
-		a_StableListenerPosition, a_DistanceToListenerSquared, countIncreased);
+	const bool wasAdded = currentQuadrant.TryToAddEmitter(StaticSoundEmitterComponent, a_InstanceIndex, a_DistanceToListenerSquared,
+		countIncreased);
 
 	if (countIncreased)	{ m_Count++; }
 	return wasAdded;
 }
 
-bool FStaticEmitterQuadrant::TryToAddEmitter(UStaticSoundEmitterComponent* StaticSoundEmitterComponent,
-	const FVector a_StableListenerPosition, const float a_DistanceToListenerSquared, bool& bCountIncreased)
+bool FStaticEmitterQuadrant::TryToAddEmitter(UStaticSoundEmitterComponent* StaticSoundEmitterComponent, const int32 a_InstanceIndex,
+	const float a_DistanceToListenerSquared, bool& bCountIncreased)
 {
 	bCountIncreased = false;
-	if (m_Emitters.Num() < 1) {	return false; }
+	if (m_Capacity < 1) { return false; }
 
-	if (m_Count < m_Emitters.Num())
+	if (!IsFull())
 	{
-		m_Emitters[m_Count] = StaticSoundEmitterComponent;
-
-		if (a_DistanceToListenerSquared > m_MaxDistanceSquared)
-		{
-			m_MaxDistanceSquared = a_DistanceToListenerSquared;
-			m_MaxDistanceIndex = m_Count;
-		}
-
-		m_Count++;
+		m_Candidates.HeapPush(FStaticEmitterCandidate(StaticSoundEmitterComponent, a_DistanceToListenerSquared, a_InstanceIndex),
+			FStaticEmitterCandidateFarthestFirst());
 		bCountIncreased = true;
 		return true;
 	}
 
-	if (a_DistanceToListenerSquared < m_MaxDistanceSquared)
+	if (a_DistanceToListenerSquared < GetMaxDistanceSquared())
 	{
-		m_Emitters[m_MaxDistanceIndex] = StaticSoundEmitterComponent;
-		FindAndUpdateQuadrantMaxDistance(a_StableListenerPosition);
+		m_Candidates.HeapPopDiscard(FStaticEmitterCandidateFarthestFirst(), false);
+		m_Candidates.HeapPush(FStaticEmitterCandidate(StaticSoundEmitterComponent, a_DistanceToListenerSquared, a_InstanceIndex),
+			FStaticEmitterCandidateFarthestFirst());
 		return true;
 	}
 
 	return false;
 }
 
-bool FStaticEmitterQuadrant::RemoveFarthestEmitter(FVector StableListenerPosition)
+bool FStaticEmitterQuadrant::RemoveFarthestEmitter()
 {
-	if (m_Count == 0)
-	{
-		return false;
-	}
-
-	if (m_MaxDistanceIndex < m_Count - 1)
-	{
-		m_Emitters[m_MaxDistanceIndex] = m_Emitters[m_Count - 1];
-	}
-
-	m_Emitters[m_Count - 1] = nullptr;
-	m_Count--;
-	FindAndUpdateQuadrantMaxDistance(StableListenerPosition);
+	if (m_Candidates.IsEmpty()) { return false; }
 
+	m_Candidates.HeapPopDiscard(FStaticEmitterCandidateFarthestFirst(), false);
 	return true;
 }
 
-void FStaticEmitterQuadrant::FindAndUpdateQuadrantMaxDistance(FVector StableListenerPosition)
+int32 FStaticEmitterQuadrant::RemoveEmitter(const UStaticSoundEmitterComponent* StaticSoundEmitterComponent)
 {
-	m_MaxDistanceSquared = 0.f;
-	m_MaxDistanceIndex = 0;
+	const int32 numRemoved = m_Candidates.RemoveAllSwap([StaticSoundEmitterComponent](const FStaticEmitterCandidate& Candidate)
+		{
+			return Candidate.Emitter == StaticSoundEmitterComponent;
+		}, false);
 
-	for (int i = 0; i < m_Count; i++)
+	if (numRemoved > 0)
 	{
-		const float distanceSquared = FVector::DistSquared(m_Emitters[i]->GetComponentLocation(), StableListenerPosition);
-
-		if (distanceSquared > m_MaxDistanceSquared)
-		{
-			m_MaxDistanceSquared = distanceSquared;
-			m_MaxDistanceIndex = i;
-		}
+		m_Candidates.Heapify(FStaticEmitterCandidateFarthestFirst());
 	}
+
+	return numRemoved;
 }
 #pragma endregion
 
 #pragma region TStaticSoundEmitterOctree
-FStaticSoundEmitterOctreeElement::FStaticSoundEmitterOctreeElement(UStaticSoundEmitterComponent* a_StaticSoundEmitterComponent)
+FStaticSoundEmitterOctreeElement::FStaticSoundEmitterOctreeElement(UStaticSoundEmitterComponent* a_StaticSoundEmitterComponent,
+	int32 a_InstanceIndex)
 	: StaticSoundEmitterComponent(a_StaticSoundEmitterComponent)
-	, BoundingBox(FBoxCenterAndExtent(StaticSoundEmitterComponent->GetComponentLocation(), FVector(1.f, 1.f, 1.f)))
+	, Location(FStaticSoundEmitterInstance(a_StaticSoundEmitterComponent, a_InstanceIndex).GetTransform().GetLocation())
+	, InstanceIndex(a_InstanceIndex)
+{
+	BoundingBox = FBoxCenterAndExtent(Location, FVector(1.f, 1.f, 1.f));
+}
+
+FStaticSoundEmitterOctreeElement::FStaticSoundEmitterOctreeElement(const FVector& a_Location, uint64 a_BakedKey)
+	: BoundingBox(FBoxCenterAndExtent(a_Location, FVector(1.f, 1.f, 1.f)))
+	, Location(a_Location)
+	, BakedKey(a_BakedKey)
 {}
 
 void FStaticSoundEmitterOctreeSemantics::SetElementId(FOctree& OctreeOwner, const FStaticSoundEmitterOctreeElement& Element, FOctreeElementId2 Id)
 {
-	static_cast<TStaticSoundEmitterOctree&>(OctreeOwner).ObjectToOctreeId.Add(Element.StaticSoundEmitterComponent->GetUniqueID(), Id);
+	TStaticSoundEmitterOctree& octree = static_cast<TStaticSoundEmitterOctree&>(OctreeOwner);
+
+	if (Element.StaticSoundEmitterComponent != nullptr)
+	{
+		octree.ObjectToOctreeId.Add(
+			TStaticSoundEmitterOctree::GetEmitterKey(Element.StaticSoundEmitterComponent, Element.InstanceIndex), Id);
+	}
+	else
+	{
+		octree.BakedToOctreeId.Add(Element.BakedKey, Id);
+	}
+}
+
+uint64 TStaticSoundEmitterOctree::GetEmitterKey(const UStaticSoundEmitterComponent* StaticSoundEmitterComponent, int32 InstanceIndex)
+{
+	return ((uint64)StaticSoundEmitterComponent->GetUniqueID() << 32) | (uint32)InstanceIndex;
 }
 
 void TStaticSoundEmitterOctree::AddEmitter(UStaticSoundEmitterComponent* StaticSoundEmitterComponent)
 {
-	const uint32 emitterID = StaticSoundEmitterComponent->GetUniqueID();
-	//if (ObjectToOctreeId.Contains(emitterID) && IsValidElementId(ObjectToOctreeId[emitterID])) { return; }
+	if (const UInstancedStaticSoundEmitterComponent* instancedComponent = Cast<UInstancedStaticSoundEmitterComponent>(StaticSoundEmitterComponent))
+	{
+		for (int32 instanceIndex = 0; instanceIndex < instancedComponent->GetInstanceCount(); instanceIndex++)
+		{
+			AddElement(FStaticSoundEmitterOctreeElement{ StaticSoundEmitterComponent, instanceIndex });
+		}
 
-	AddElement(FStaticSoundEmitterOctreeElement{ StaticSoundEmitterComponent });
-	NumElements++;
+		NumElements += instancedComponent->GetInstanceCount();
+	}
+	else
+	{
+		AddElement(FStaticSoundEmitterOctreeElement{ StaticSoundEmitterComponent });
+		NumElements++;
+	}
 
 	if (Private_StaticSoundEmitterManager::bDebugConsoleOctreeStats)
 	{ 
@@ -209,13 +306,66 @@ void TStaticSoundEmitterOctree::AddEmitter(UStaticSoundEmitterComponent* StaticS
 	}
 }
 
-void TStaticSoundEmitterOctree::RemoveEmitter(UStaticSoundEmitterComponent* StaticSoundEmitterComponent)
+void TStaticSoundEmitterOctree::AddEmitters(TConstArrayView<UStaticSoundEmitterComponent*> StaticSoundEmitterComponents)
 {
-	const FOctreeElementId2 elementID = ObjectToOctreeId[StaticSoundEmitterComponent->GetUniqueID()];
-	if (!IsValidElementId(elementID)) { return; }
+	if (StaticSoundEmitterComponents.Num() < Private_StaticSoundEmitterManager::MinBulkBuildEmitters
+		|| StaticSoundEmitterComponents.Num() < (int32)NumElements)
+	{
+		for (UStaticSoundEmitterComponent* staticSoundEmitterComponent : StaticSoundEmitterComponents)
+		{
+			AddEmitter(staticSoundEmitterComponent);
+		}
 
-	RemoveElement(ObjectToOctreeId[StaticSoundEmitterComponent->GetUniqueID()]);
-	NumElements--;
+		return;
+	}
+
+	// TOctree2 has no bulk build. Batches at least as large as the octree rebuild it, which sizes the id maps once and drops the
+	// nodes left behind by earlier streaming
+	TArray<FStaticSoundEmitterOctreeElement> elements{};
+	elements.Reserve(NumElements + StaticSoundEmitterComponents.Num());
+	FindAllElements([&elements](const FStaticSoundEmitterOctreeElement& Element) { elements.Add(Element); });
+
+	for (UStaticSoundEmitterComponent* staticSoundEmitterComponent : StaticSoundEmitterComponents)
+	{
+		if (const UInstancedStaticSoundEmitterComponent* instancedComponent = Cast<UInstancedStaticSoundEmitterComponent>(staticSoundEmitterComponent))
+		{
+			for (int32 instanceIndex = 0; instanceIndex < instancedComponent->GetInstanceCount(); instanceIndex++)
+			{
+				elements.Emplace(staticSoundEmitterComponent, instanceIndex);
+			}
+		}
+		else
+		{
+			elements.Emplace(staticSoundEmitterComponent);
+		}
+	}
+
+	Destroy();
+	ObjectToOctreeId.Reset();
+	ObjectToOctreeId.Reserve(elements.Num() - BakedToOctreeId.Num());
+	BakedToOctreeId.Reset();
+
+	for (const FStaticSoundEmitterOctreeElement& element : elements)
+	{
+		AddElement(element);
+	}
+
+	NumElements = elements.Num();
+}
+
+void TStaticSoundEmitterOctree::RemoveEmitter(UStaticSoundEmitterComponent* StaticSoundEmitterComponent)
+{
+	if (const UInstancedStaticSoundEmitterComponent* instancedComponent = Cast<UInstancedStaticSoundEmitterComponent>(StaticSoundEmitterComponent))
+	{
+		for (int32 instanceIndex = 0; instanceIndex < instancedComponent->GetInstanceCount(); instanceIndex++)
+		{
+			RemoveElementOfEmitter(GetEmitterKey(StaticSoundEmitterComponent, instanceIndex));
+		}
+	}
+	else
+	{
+		RemoveElementOfEmitter(GetEmitterKey(StaticSoundEmitterComponent, INDEX_NONE));
+	}
 
 	if (Private_StaticSoundEmitterManager::bDebugConsoleOctreeStats)
 	{
@@ -225,6 +375,45 @@ void TStaticSoundEmitterOctree::RemoveEmitter(UStaticSoundEmitterComponent* Stat
 		//DumpStats();
 	}
 }
+
+void TStaticSoundEmitterOctree::AddBakedEmitter(const FVector& Location, uint64 BakedKey)
+{
+	if (BakedToOctreeId.Contains(BakedKey)) { return; }
+
+	AddElement(FStaticSoundEmitterOctreeElement{ Location, BakedKey });
+	NumElements++;
+}
+
+bool TStaticSoundEmitterOctree::AttachEmitter(uint64 BakedKey, UStaticSoundEmitterComponent* StaticSoundEmitterComponent)
+{
+	FOctreeElementId2 elementID;
+	if (!BakedToOctreeId.RemoveAndCopyValue(BakedKey, elementID) || !IsValidElementId(elementID)) { return false; }
+
+	GetElementById(elementID).StaticSoundEmitterComponent = StaticSoundEmitterComponent;
+	ObjectToOctreeId.Add(GetEmitterKey(StaticSoundEmitterComponent, INDEX_NONE), elementID);
+
+	return true;
+}
+
+bool TStaticSoundEmitterOctree::RemoveBakedEmitter(uint64 BakedKey)
+{
+	FOctreeElementId2 elementID;
+	if (!BakedToOctreeId.RemoveAndCopyValue(BakedKey, elementID) || !IsValidElementId(elementID)) { return false; }
+
+	RemoveElement(elementID);
+	NumElements--;
+
+	return true;
+}
+
+void TStaticSoundEmitterOctree::RemoveElementOfEmitter(uint64 EmitterKey)
+{
+	FOctreeElementId2 elementID;
+	if (!ObjectToOctreeId.RemoveAndCopyValue(EmitterKey, elementID) || !IsValidElementId(elementID)) { return; }
+
+	RemoveElement(elementID);
+	NumElements--;
+}
 #pragma endregion
 
 #pragma region AStaticSoundEmitterWorldManager
@@ -245,58 +434,56 @@ void AStaticSoundEmitterWorldManager::Initialize(USoundListenerManager* SoundLis
 #endif
 
 	const UWwiserRGameSettings* gameSettings = GetDefault<UWwiserRGameSettings>();
-	m_spreadOverMultipleFrames = gameSettings->bSpreadOverMultipleFrames && !gameSettings->DistanceTresholds.IsEmpty();
+	m_rangeTresholds = GetRangeTresholds();
+	m_spreadOverMultipleFrames = !m_rangeTresholds.IsEmpty();
 
+	// initialize distance ranges if range tresholds are valid
 	if (m_spreadOverMultipleFrames)
 	{
-		m_rangeTresholds = gameSettings->DistanceTresholds;
-
-		// sort and remove duplicate and <= 0.f values
-		m_rangeTresholds.Sort();
+		m_numDistanceRanges = m_rangeTresholds.Num() + 1;
 
-		for (int i = m_rangeTresholds.Num() - 1; i > 0; i--)
+		m_rangeTexts.Init(FString{}, m_numDistanceRanges);
+		m_rangeTexts[0] = FString::Printf(TEXT("0 - %.0f m"), m_rangeTresholds[0] / 100.f);
+		for (int i = 1; i < m_rangeTresholds.Num(); i++)
 		{
-			if (m_rangeTresholds[i] <= 0.f || m_rangeTresholds[i] == m_rangeTresholds[i - 1])
-			{
-				m_rangeTresholds.RemoveAt(i);
-			}
+			m_rangeTexts[i] = FString::Printf(TEXT("%.0f - %.0f m"), m_rangeTresholds[i - 1] / 100.f, m_rangeTresholds[i] / 100.f);
 		}
+		m_rangeTexts[m_rangeTresholds.Num()] = FString::Printf(TEXT(">= %.0f m"), m_rangeTresholds[m_rangeTresholds.Num() - 1] / 100.f);
 
-		if (m_rangeTresholds[0] <= 0.f)
+		m_rangeTextLengths.Init(0, m_numDistanceRanges);
+
+		for (int j = 0; j < m_numDistanceRanges; j++)
 		{
-			m_rangeTresholds.RemoveAt(0);
+			m_rangeTextLengths[j] = m_rangeTexts[j].Len();
 		}
+	}
 
+	m_adaptiveScheduling = gameSettings->bAdaptiveScheduling;
+	m_schedulingBudgetMs = gameSettings->AdaptiveSchedulingBudgetMs;
+	m_minUpdatePeriod = gameSettings->AdaptiveSchedulingMinUpdatePeriod;
+	m_maxUpdatePeriod = FMath::Max(gameSettings->AdaptiveSchedulingMaxUpdatePeriod, m_minUpdatePeriod);
+	m_isRangeScheduled.Init(false, m_numDistanceRanges);
 
-		// initialize distance ranges range tresholds are valid
-		if (m_rangeTresholds.IsEmpty())
-		{
-			m_spreadOverMultipleFrames = false;
-		}
-		else
-		{
-			m_numDistanceRanges = m_rangeTresholds.Num() + 1;
+	m_useBakedEmitters = gameSettings->bUseBakedStaticSoundEmitters;
 
-			m_rangeTexts.Init(FString{}, m_numDistanceRanges);
-			m_rangeTexts[0] = FString::Printf(TEXT("0 - %.0f m"), m_rangeTresholds[0] / 100.f);
-			for (int i = 1; i < m_rangeTresholds.Num(); i++)
-			{
-				m_rangeTexts[i] = FString::Printf(TEXT("%.0f - %.0f m"), m_rangeTresholds[i - 1] / 100.f, m_rangeTresholds[i] / 100.f);
-			}
-			m_rangeTexts[m_rangeTresholds.Num()] = FString::Printf(TEXT(">= %.0f m"), m_rangeTresholds[m_rangeTresholds.Num() - 1] / 100.f);
+	m_batchRegistration = gameSettings->bBatchEmitterRegistration;
+	m_registrationBudgetMs = gameSettings->EmitterRegistrationBudgetMs;
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddUObject(this, &AStaticSoundEmitterWorldManager::OnPreGarbageCollect);
+	FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &AStaticSoundEmitterWorldManager::OnLevelRemovedFromWorld);
 
-			m_rangeTextLengths.Init(0, m_numDistanceRanges);
+	m_useSharedGrid = ShouldUseSharedGrid();
 
-			for (int j = 0; j < m_numDistanceRanges; j++)
-			{
-				m_rangeTextLengths[j] = m_rangeTexts[j].Len();
-			}
+	if (m_useSharedGrid)
+	{
+		for (int i = 0; i < m_numDistanceRanges; i++)
+		{
+			m_grids.Add(MakeUnique<FStaticSoundEmitterGrid>(gameSettings->StaticSoundEmitterGridCellSize));
 		}
 	}
 
 	m_postedLoops.Init(TMap<UDA_StaticSoundLoop*, TSharedPtr<TStaticSoundEmitterOctree>>{}, m_numDistanceRanges);
 	m_loopsToPlayPerRange.Init(TMap<UDA_StaticSoundLoop*, FStaticSoundEmittersInRange>{}, m_numDistanceRanges);
-	m_playingEventsPerRange.Init(TMap<UDA_StaticSoundLoop*, TSet<UStaticSoundEmitterComponent*>>{}, m_numDistanceRanges);
+	m_playingEventsPerRange.Init(TMap<UDA_StaticSoundLoop*, TSet<FStaticSoundEmitterInstance>>{}, m_numDistanceRanges);
 
 #if !UE_BUILD_SHIPPING
 	m_dbgNumLoops.Init(0, m_numDistanceRanges + 1);
@@ -312,7 +499,41 @@ void AStaticSoundEmitterWorldManager::Deinitialize()
 	AStaticSoundEmitterWorldManager::OnDebugViewportStatsChanged.RemoveAll(this);
 #endif
 
+	FWorldDelegates::LevelRemovedFromWorld.RemoveAll(this);
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().RemoveAll(this);
+
+	m_pendingRegistrations.Empty();
+	m_registrationBatch.Empty();
+	m_emittersToAdd.Empty();
+
+	while (!m_multiPositionEmitters.IsEmpty())
+	{
+		StopMultiPositionLoop(m_multiPositionEmitters.CreateConstIterator().Key(), false);
+	}
+
+	// the world is torn down, fade outs are cut
+	UnregisterPendingGameObjects(true);
+
+#if !UE_BUILD_SHIPPING
+	m_dbgMultiPositionLoopsWithGameSyncs.Empty();
+#endif
+
+	for (const TPair<const ULevel*, FBakedStaticSoundEmitters>& bakedLevel : m_bakedLevels)
+	{
+		if (bakedLevel.Value.Database != nullptr)
+		{
+			DEC_DWORD_STAT_BY(STAT_WwiserR_StaticEmittersBaked, bakedLevel.Value.Database->Records.Num());
+			DEC_DWORD_STAT_BY(STAT_WwiserR_StaticEmittersAttached, bakedLevel.Value.IsAttached.CountSetBits());
+		}
+	}
+
+	m_bakedLevels.Empty();
 	m_postedLoops.Empty();
+	m_grids.Empty();
+	m_gridQueries.Empty();
+	m_octreeLoopsToSelect.Empty();
+	m_loopSchedules.Empty();
+	m_dueLoops.Empty();
 	m_loopsToPlayPerRange.Empty();
 	m_playingEventsPerRange.Empty();
 	m_listenerManager = nullptr;
@@ -326,6 +547,10 @@ void AStaticSoundEmitterWorldManager::EndPlay(EEndPlayReason::Type EndPlayReason
 void AStaticSoundEmitterWorldManager::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
+	LLM_SCOPE_BYTAG(WwiserR_StaticSoundEmitters);
+
+	ApplyPendingRegistrations(false);
+	UnregisterPendingGameObjects(false);
 
 	const FVector listenerPosition = m_listenerManager->GetSpatialAudioListenerPosition();
 	const FVector distanceProbePosition = m_listenerManager->GetDistanceProbePosition();
@@ -335,158 +560,423 @@ void AStaticSoundEmitterWorldManager::Tick(float DeltaTime)
 		m_stableDistanceProbePosition = distanceProbePosition;
 	}
 
-#if !UE_BUILD_SHIPPING
-	if (Private_StaticSoundEmitterManager::bViewPortStats) { m_dbgNumInRange[m_rangeIndex] = 0; }
-#endif
-
-	// reset or reinitialize existing loops instead, minimizing memory reallocation
-	for (TPair<UDA_StaticSoundLoop*, FStaticSoundEmittersInRange>& loop : m_loopsToPlayPerRange[m_rangeIndex])
+	if (m_adaptiveScheduling)
 	{
-		if (loop.Key->MaxInstances == loop.Value.m_MaxEmittersTotal
-			&& loop.Key->MaxInstancesPerQuadrant == loop.Value.m_StaticSoundEmitterQuadrants[0].m_Emitters.Num())
-		{
-			loop.Value.Clear();
-		}
-		else
+		ScheduleLoops(listenerPosition, DeltaTime);
+
+		for (uint8 rangeIndex = 0; rangeIndex < m_numDistanceRanges; rangeIndex++)
 		{
-			loop.Value = FStaticSoundEmittersInRange(loop.Key->MaxInstancesPerQuadrant, loop.Key->MaxInstances);
+			if (m_isRangeScheduled[rangeIndex])
+			{
+				m_rangeIndex = rangeIndex;
+				UpdateRange(listenerPosition);
+			}
 		}
 	}
-
-	// convert TMap to TArray for efficient parallel access
-	TMap<UDA_StaticSoundLoop*, TSharedPtr<TStaticSoundEmitterOctree>>& PostedLoopsMap = m_postedLoops[m_rangeIndex];
-	TArray<TPair<UDA_StaticSoundLoop*, TSharedPtr<TStaticSoundEmitterOctree>>> postedLoopsArray;
-	postedLoopsArray.Reserve(PostedLoopsMap.Num());
-	for (const auto& postedLoop : PostedLoopsMap)
+	else
 	{
-		postedLoopsArray.Emplace(postedLoop);
-	}
+		UpdateRange(listenerPosition);
 
-	TArray<FStaticSoundEmittersInRange> tempEmittersToPlayArray;
-	tempEmittersToPlayArray.SetNum(postedLoopsArray.Num());
-
-	ParallelFor(postedLoopsArray.Num(), [&](int32 Index)
+		if (m_spreadOverMultipleFrames)
 		{
-			const auto& pair = postedLoopsArray[Index];
-			UDA_StaticSoundLoop* staticSoundLoop = pair.Key;
-			const TSharedPtr<TStaticSoundEmitterOctree> emitterOctree = pair.Value;
-
-			WR_ASSERT(emitterOctree->RangeIndex == m_rangeIndex,
-				"emitterOctree->RangeIndex (%i) != m_rangeIndex (%i)", emitterOctree->RangeIndex, m_rangeIndex);
-
-			const float activationRange = GetActivationRange(staticSoundLoop);
-			const float activationRangeSquared = activationRange * activationRange;
-			const FVector referencePosition =
-				staticSoundLoop->ReferencePositionLerp * m_stableDistanceProbePosition +
-				(1.f - staticSoundLoop->ReferencePositionLerp) * listenerPosition;
-
-			const FBox Box = FBox(referencePosition + FVector(-activationRange),
-				referencePosition + FVector(activationRange));
-
-			// local emitters for this loop
-			FStaticSoundEmittersInRange localEmittersToPlay(staticSoundLoop->MaxInstancesPerQuadrant, staticSoundLoop->MaxInstances);
+			m_rangeIndex = (m_rangeIndex + 1) % m_numDistanceRanges;
+		}
+	}
 
-			emitterOctree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Box),
-				[&](const FStaticSoundEmitterOctreeElement& EmitterElement)
-				{
 #if !UE_BUILD_SHIPPING
-					if (Private_StaticSoundEmitterManager::bViewPortStats)
-					{
-						FPlatformAtomics::InterlockedIncrement(&m_dbgNumInRange[m_rangeIndex]);
-					}
+	Debug();
 #endif
-					const float distanceToListenerSquared = FVector::DistSquared(referencePosition, EmitterElement.BoundingBox.Center);
+}
 
-					if (distanceToListenerSquared < activationRangeSquared)
-					{
-						// Determine quadrant
-						EQuadrant quadrant{};
-						FVector emitterLocation = EmitterElement.StaticSoundEmitterComponent->GetComponentLocation();
-						if (emitterLocation.Y > referencePosition.Y)
-						{
-							quadrant = (emitterLocation.X > referencePosition.X) ? EQuadrant::NorthEast : EQuadrant::NorthWest;
-						}
-						else
-						{
-							quadrant = (emitterLocation.X > referencePosition.X) ? EQuadrant::SouthEast : EQuadrant::SouthWest;
-						}
+void AStaticSoundEmitterWorldManager::UpdateRange(const FVector& ListenerPosition)
+{
+#if STATS
+	// container growth only sees the persistent containers, the allocation counter also sees temporaries and worker threads
+	const bool bCollectStats = FThreadStats::IsCollectingData();
+	const SIZE_T allocatedSize = bCollectStats ? GetAllocatedSize(m_rangeIndex) : 0;
+#endif
 
-						// Add emitter to local emitters
-						localEmittersToPlay.TryToAddEmitter(EmitterElement.StaticSoundEmitterComponent,
-							referencePosition, distanceToListenerSquared, quadrant);
-					}
-				});
+#if STATS && !UE_BUILD_SHIPPING
+	const bool bCountAllocations = bCollectStats && Private_StaticSoundEmitterManager::bCountAllocations;
+	const uint64 numAllocations = bCountAllocations ? FAllocationCounter::GetNumAllocations() : 0;
+#endif
+	WR_COUNT_ALLOCATIONS_SCOPE();
 
-			tempEmittersToPlayArray[Index] = MoveTemp(localEmittersToPlay);
-		}); // ParallelFor()
+#if !UE_BUILD_SHIPPING
+	if (Private_StaticSoundEmitterManager::bViewPortStats) { m_dbgNumInRange[m_rangeIndex] = 0; }
+#endif
 
-	for (int32 i = 0; i < postedLoopsArray.Num(); ++i)
+	if (m_useSharedGrid)
+	{
+		SelectEmittersFromGrid(ListenerPosition);
+	}
+	else
 	{
-		UDA_StaticSoundLoop* postedLoop = postedLoopsArray[i].Key;
-		m_loopsToPlayPerRange[m_rangeIndex].FindOrAdd(postedLoop) = MoveTemp(tempEmittersToPlayArray[i]);
+		SelectEmittersFromOctrees(ListenerPosition);
 	}
 
 	PlayAndStopAudioEvents(m_rangeIndex);
 
-#if !UE_BUILD_SHIPPING
-	Debug();
+#if STATS
+	if (bCollectStats)
+	{
+		const SIZE_T newAllocatedSize = GetAllocatedSize(m_rangeIndex);
+		INC_DWORD_STAT_BY(STAT_WwiserR_StaticLoopsContainerGrowth,
+			newAllocatedSize > allocatedSize ? (uint32)(newAllocatedSize - allocatedSize) : 0);
+	}
 #endif
 
-	if (m_spreadOverMultipleFrames)
+#if STATS && !UE_BUILD_SHIPPING
+	if (bCountAllocations)
 	{
-		m_rangeIndex = (m_rangeIndex + 1) % m_numDistanceRanges;
+		INC_DWORD_STAT_BY(STAT_WwiserR_StaticLoopsAllocations, (uint32)(FAllocationCounter::GetNumAllocations() - numAllocations));
 	}
+#endif
 }
 
-#if !UE_BUILD_SHIPPING
-void AStaticSoundEmitterWorldManager::Debug()
+#pragma region Adaptive Scheduling
+void AStaticSoundEmitterWorldManager::ScheduleLoops(const FVector& ListenerPosition, const float DeltaTime)
 {
-	if (Private_StaticSoundEmitterManager::bDebugDraw)
+	if (DeltaTime > 0.f && m_hasLastListenerPosition)
 	{
-		const FThemeStaticSoundEmitters& themeSettings = GetDefault<UWwiserRThemeSettings>()->ThemeStaticSoundEmitters;
+		const float listenerSpeed = FVector::Dist(ListenerPosition, m_lastListenerPosition) / DeltaTime;
 
-		UWorld* world = GetWorld();
-		for (int i = 0; i < 3; i++)
+		if (listenerSpeed <= Private_StaticSoundEmitterManager::TeleportSpeedThreshold)
 		{
-			for (const TPair<UDA_StaticSoundLoop*, TSet<UStaticSoundEmitterComponent*>>& playingEvents : m_playingEventsPerRange[i])
-			{
-				for (const UStaticSoundEmitterComponent* playingEmitter : playingEvents.Value)
-				{
-					DrawDebugSphere(world, playingEmitter->GetComponentLocation(),
-						themeSettings.Radius, 12, themeSettings.StaticSoundEmitterColor);
-				}
-			}
+			m_listenerSpeed = FMath::Lerp(m_listenerSpeed, listenerSpeed, 0.25f);
 		}
 	}
 
-	if (Private_StaticSoundEmitterManager::bViewPortStats && GEngine)
-	{
-		// whitespace
-		static const FString msgWhiteSpaceTop = TEXT("\n\n\n\n");
-		
-		// labels
-		static const FString msgLabels = TEXT("\n\nRange                             Loops                     Posted            In Range          Playing");
-
-		// accumulate emitters in range stats
-		m_dbgNumInRange[m_numDistanceRanges] = 0;
-		for (int i = 0; i < m_dbgNumInRange.Num(); i++)
-		{
-			m_dbgNumInRange[m_numDistanceRanges] += m_dbgNumInRange[i];
-		}
+	m_lastListenerPosition = ListenerPosition;
+	m_hasLastListenerPosition = true;
 
-		// ranged stats
-		TArray<FString> msgRangedStatsArray{};
-		msgRangedStatsArray.Init(FString{}, m_numDistanceRanges);
+	// gather the loops that are due
+	const double currentTime = FPlatformTime::Seconds();
+	m_dueLoops.Reset();
 
-		for (int i = 0; i < m_numDistanceRanges; i++)
+	auto gatherIfDue = [&](UDA_StaticSoundLoop* StaticSoundLoop, uint8 RangeIndex)
 		{
-			// posted events
-			msgRangedStatsArray[i] = m_rangeTexts[i];
-			uint8 currentLength = msgRangedStatsArray[i].Len();
+			const FStaticLoopSchedule& schedule = m_loopSchedules.FindOrAdd(StaticSoundLoop);
 
-			if (m_spreadOverMultipleFrames)
+			if (schedule.NextUpdateTime <= currentTime)
 			{
-				for (int j = 0; j < 24 - 2 * (m_rangeTextLengths[i] - m_rangeTextLengths[0]) - i; j++) // very ugly, but Unreal discards .AppendChars() etc...
+				m_dueLoops.Emplace(StaticSoundLoop, schedule.NextUpdateTime, RangeIndex);
+			}
+		};
+
+	for (uint8 rangeIndex = 0; rangeIndex < m_numDistanceRanges; rangeIndex++)
+	{
+		m_isRangeScheduled[rangeIndex] = false;
+
+		if (m_useSharedGrid)
+		{
+			const TArray<UDA_StaticSoundLoop*>& gridLoops = m_grids[rangeIndex]->GetLoops();
+
+			for (int32 loopIndex = 0; loopIndex < gridLoops.Num(); loopIndex++)
+			{
+				if (m_grids[rangeIndex]->GetNumEmitters(loopIndex) > 0) { gatherIfDue(gridLoops[loopIndex], rangeIndex); }
+			}
+		}
+		else
+		{
+			for (const TPair<UDA_StaticSoundLoop*, TSharedPtr<TStaticSoundEmitterOctree>>& postedLoop : m_postedLoops[rangeIndex])
+			{
+				gatherIfDue(postedLoop.Key, rangeIndex);
+			}
+		}
+	}
+
+	// most overdue first, fit as many as the budget allows based on their measured cost
+	m_dueLoops.Sort([](const FStaticLoopDue& A, const FStaticLoopDue& B) { return A.NextUpdateTime < B.NextUpdateTime; });
+
+	float scheduledCostMs = 0.f;
+	int32 numScheduled = 0;
+
+	for (const FStaticLoopDue& dueLoop : m_dueLoops)
+	{
+		FStaticLoopSchedule& schedule = m_loopSchedules.FindChecked(dueLoop.StaticSoundLoop);
+
+		if (numScheduled > 0 && scheduledCostMs + schedule.AverageCostMs > m_schedulingBudgetMs) { continue; }
+
+		scheduledCostMs += schedule.AverageCostMs;
+		numScheduled++;
+
+		schedule.ScheduledFrame = GFrameCounter;
+		schedule.NextUpdateTime = currentTime + GetUpdatePeriod(dueLoop.StaticSoundLoop);
+		m_isRangeScheduled[dueLoop.RangeIndex] = true;
+	}
+
+	INC_DWORD_STAT_BY(STAT_WwiserR_StaticLoopsScheduled, numScheduled);
+	INC_DWORD_STAT_BY(STAT_WwiserR_StaticLoopsDeferred, m_dueLoops.Num() - numScheduled);
+	SET_FLOAT_STAT(STAT_WwiserR_StaticLoopsScheduledCost, scheduledCostMs);
+}
+
+float AStaticSoundEmitterWorldManager::GetUpdatePeriod(const UDA_StaticSoundLoop* StaticSoundLoop) const
+{
+	// time until the reference position may have moved far enough for the loop to be selected again
+	const float toleratedDistance = StaticSoundLoop->ReselectionDistanceFraction * GetActivationRange(StaticSoundLoop);
+	const float updatePeriod = m_listenerSpeed > UE_KINDA_SMALL_NUMBER ? toleratedDistance / m_listenerSpeed : m_maxUpdatePeriod;
+
+	return FMath::Clamp(updatePeriod, m_minUpdatePeriod, m_maxUpdatePeriod);
+}
+
+void AStaticSoundEmitterWorldManager::RecordQueryCost(const UDA_StaticSoundLoop* StaticSoundLoop, const float CostMs)
+{
+	if (!m_adaptiveScheduling) { return; }
+
+	if (FStaticLoopSchedule* schedule = m_loopSchedules.Find(StaticSoundLoop))
+	{
+		schedule->AverageCostMs = schedule->AverageCostMs > 0.f ? FMath::Lerp(schedule->AverageCostMs, CostMs, 0.2f) : CostMs;
+	}
+}
+#pragma endregion
+
+void AStaticSoundEmitterWorldManager::SelectEmittersFromOctrees(const FVector& ListenerPosition)
+{
+	// gather the loops to select into a persistent array for parallel access, skipping loops whose selection is still valid
+	TMap<UDA_StaticSoundLoop*, TSharedPtr<TStaticSoundEmitterOctree>>& PostedLoopsMap = m_postedLoops[m_rangeIndex];
+	TMap<UDA_StaticSoundLoop*, FStaticSoundEmittersInRange>& loopsToPlay = m_loopsToPlayPerRange[m_rangeIndex];
+	m_octreeLoopsToSelect.Reset();
+
+	int32 numEvaluated = 0;
+
+	for (const TPair<UDA_StaticSoundLoop*, TSharedPtr<TStaticSoundEmitterOctree>>& postedLoop : PostedLoopsMap)
+	{
+		if (!IsScheduled(postedLoop.Key)) { continue; }
+		numEvaluated++;
+
+		const FVector referencePosition = GetReferencePosition(postedLoop.Key, ListenerPosition);
+		const FStaticSoundEmittersInRange* selection = loopsToPlay.Find(postedLoop.Key);
+
+		if (selection == nullptr || ShouldReselect(postedLoop.Key, *selection, referencePosition, GetActivationRange(postedLoop.Key)))
+		{
+			ResetSelection(postedLoop.Key, referencePosition);
+			m_octreeLoopsToSelect.Emplace(postedLoop.Key, postedLoop.Value.Get());
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_WwiserR_StaticLoopsSelected, m_octreeLoopsToSelect.Num());
+	INC_DWORD_STAT_BY(STAT_WwiserR_StaticLoopsSkipped, numEvaluated - m_octreeLoopsToSelect.Num());
+	SET_FLOAT_STAT(STAT_WwiserR_StaticLoopsSkipRate, numEvaluated == 0 ? 0.f :
+		100.f * (numEvaluated - m_octreeLoopsToSelect.Num()) / numEvaluated);
+
+	// adding selections can reallocate the map, the selections are resolved after all were added
+	for (FStaticLoopToSelect& loopToSelect : m_octreeLoopsToSelect)
+	{
+		loopToSelect.Selection = loopsToPlay.Find(loopToSelect.StaticSoundLoop);
+	}
+
+	// each loop fills its own selection in place, reusing the memory of its previous selection
+	ParallelFor(m_octreeLoopsToSelect.Num(), [&](int32 Index)
+		{
+			WR_COUNT_ALLOCATIONS_SCOPE();
+			FStaticLoopToSelect& loopToSelect = m_octreeLoopsToSelect[Index];
+			const double startTime = m_adaptiveScheduling ? FPlatformTime::Seconds() : 0.0;
+
+			UDA_StaticSoundLoop* staticSoundLoop = loopToSelect.StaticSoundLoop;
+			const TStaticSoundEmitterOctree* emitterOctree = loopToSelect.Octree;
+			FStaticSoundEmittersInRange& selection = *loopToSelect.Selection;
+
+			WR_ASSERT(emitterOctree->RangeIndex == m_rangeIndex,
+				"emitterOctree->RangeIndex (%i) != m_rangeIndex (%i)", emitterOctree->RangeIndex, m_rangeIndex);
+
+			const float activationRange = GetActivationRange(staticSoundLoop);
+			const float activationRangeSquared = activationRange * activationRange;
+			const FVector referencePosition = selection.m_ReferencePosition;
+
+			const FBox Box = FBox(referencePosition + FVector(-activationRange),
+				referencePosition + FVector(activationRange));
+
+			emitterOctree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Box),
+				[&](const FStaticSoundEmitterOctreeElement& EmitterElement)
+				{
+					if (EmitterElement.StaticSoundEmitterComponent == nullptr) { return; }
+
+#if !UE_BUILD_SHIPPING
+					if (Private_StaticSoundEmitterManager::bViewPortStats)
+					{
+						FPlatformAtomics::InterlockedIncrement(&m_dbgNumInRange[m_rangeIndex]);
+					}
+#endif
+					const FVector& emitterLocation = EmitterElement.Location;
+					const float distanceToListenerSquared = FVector::DistSquared(referencePosition, emitterLocation);
+
+					if (distanceToListenerSquared < activationRangeSquared)
+					{
+						selection.TryToAddEmitter(EmitterElement.StaticSoundEmitterComponent, distanceToListenerSquared,
+							GetQuadrant(emitterLocation, referencePosition), EmitterElement.InstanceIndex);
+					}
+				});
+
+			if (m_adaptiveScheduling)
+			{
+				loopToSelect.CostMs = (float)((FPlatformTime::Seconds() - startTime) * 1000.0);
+			}
+		}); // ParallelFor()
+
+	if (m_adaptiveScheduling)
+	{
+		for (const FStaticLoopToSelect& loopToSelect : m_octreeLoopsToSelect)
+		{
+			RecordQueryCost(loopToSelect.StaticSoundLoop, loopToSelect.CostMs);
+		}
+	}
+}
+
+FStaticSoundEmittersInRange& AStaticSoundEmitterWorldManager::ResetSelection(UDA_StaticSoundLoop* StaticSoundLoop,
+	const FVector& ReferencePosition)
+{
+	FStaticSoundEmittersInRange* selection = m_loopsToPlayPerRange[m_rangeIndex].Find(StaticSoundLoop);
+
+	if (selection == nullptr)
+	{
+		selection = &m_loopsToPlayPerRange[m_rangeIndex].Add(StaticSoundLoop,
+			FStaticSoundEmittersInRange(StaticSoundLoop->MaxInstancesPerQuadrant, StaticSoundLoop->MaxInstances));
+	}
+	// reset or reinitialize the existing selection instead, minimizing memory reallocation
+	else if (selection->HasLimits(StaticSoundLoop->MaxInstancesPerQuadrant, StaticSoundLoop->MaxInstances))
+	{
+		selection->Clear();
+	}
+	else
+	{
+		*selection = FStaticSoundEmittersInRange(StaticSoundLoop->MaxInstancesPerQuadrant, StaticSoundLoop->MaxInstances);
+	}
+
+	selection->m_ReferencePosition = ReferencePosition;
+	selection->m_IsValid = true;
+	selection->m_IsReselected = true;
+
+	return *selection;
+}
+
+void AStaticSoundEmitterWorldManager::SelectEmittersFromGrid(const FVector& ListenerPosition)
+{
+	const FStaticSoundEmitterGrid& grid = *m_grids[m_rangeIndex];
+	const TArray<UDA_StaticSoundLoop*>& gridLoops = grid.GetLoops();
+	TMap<UDA_StaticSoundLoop*, FStaticSoundEmittersInRange>& loopsToPlay = m_loopsToPlayPerRange[m_rangeIndex];
+
+	m_gridQueries.SetNum(gridLoops.Num(), false);
+	FBox queryBounds(ForceInit);
+	int32 numSelected = 0;
+	int32 numSkipped = 0;
+
+	// one query per loop, all binned in a single traversal of the cells overlapping their union
+	for (int32 loopIndex = 0; loopIndex < gridLoops.Num(); loopIndex++)
+	{
+		UDA_StaticSoundLoop* staticSoundLoop = gridLoops[loopIndex];
+		FStaticSoundEmitterGridQuery& query = m_gridQueries[loopIndex];
+
+		if (grid.GetNumEmitters(loopIndex) == 0 || !IsScheduled(staticSoundLoop))
+		{
+			query.Selection = nullptr;
+			continue;
+		}
+
+		const float activationRange = GetActivationRange(staticSoundLoop);
+		query.ActivationRangeSquared = activationRange * activationRange;
+		query.ReferencePosition = GetReferencePosition(staticSoundLoop, ListenerPosition);
+
+		const FStaticSoundEmittersInRange* selection = loopsToPlay.Find(staticSoundLoop);
+		if (selection != nullptr && !ShouldReselect(staticSoundLoop, *selection, query.ReferencePosition, activationRange))
+		{
+			query.Selection = nullptr;
+			numSkipped++;
+			continue;
+		}
+
+		query.Selection = &ResetSelection(staticSoundLoop, query.ReferencePosition);
+		numSelected++;
+		queryBounds += FBox(query.ReferencePosition - FVector(activationRange), query.ReferencePosition + FVector(activationRange));
+	}
+
+	// adding loops can reallocate the map, the selections are resolved after all were added
+	for (int32 loopIndex = 0; loopIndex < gridLoops.Num(); loopIndex++)
+	{
+		if (m_gridQueries[loopIndex].Selection != nullptr)
+		{
+			m_gridQueries[loopIndex].Selection = loopsToPlay.Find(gridLoops[loopIndex]);
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_WwiserR_StaticLoopsSelected, numSelected);
+	INC_DWORD_STAT_BY(STAT_WwiserR_StaticLoopsSkipped, numSkipped);
+	SET_FLOAT_STAT(STAT_WwiserR_StaticLoopsSkipRate, numSelected + numSkipped == 0 ? 0.f :
+		100.f * numSkipped / (numSelected + numSkipped));
+
+	if (numSelected == 0) { return; }
+
+	const double startTime = m_adaptiveScheduling ? FPlatformTime::Seconds() : 0.0;
+	const int32 numTested = grid.Query(queryBounds, m_gridQueries);
+
+	// the loops share one traversal, its cost is split evenly
+	if (m_adaptiveScheduling)
+	{
+		const float costMs = (float)((FPlatformTime::Seconds() - startTime) * 1000.0) / numSelected;
+
+		for (int32 loopIndex = 0; loopIndex < gridLoops.Num(); loopIndex++)
+		{
+			if (m_gridQueries[loopIndex].Selection != nullptr) { RecordQueryCost(gridLoops[loopIndex], costMs); }
+		}
+	}
+
+#if !UE_BUILD_SHIPPING
+	if (Private_StaticSoundEmitterManager::bViewPortStats)
+	{
+		m_dbgNumInRange[m_rangeIndex] += numTested;
+	}
+#endif
+}
+
+#if !UE_BUILD_SHIPPING
+void AStaticSoundEmitterWorldManager::Debug()
+{
+	if (Private_StaticSoundEmitterManager::bDebugDraw)
+	{
+		const FThemeStaticSoundEmitters& themeSettings = GetDefault<UWwiserRThemeSettings>()->ThemeStaticSoundEmitters;
+
+		UWorld* world = GetWorld();
+		for (int i = 0; i < 3; i++)
+		{
+			for (const TPair<UDA_StaticSoundLoop*, TSet<FStaticSoundEmitterInstance>>& playingEvents : m_playingEventsPerRange[i])
+			{
+				for (const FStaticSoundEmitterInstance& playingEmitter : playingEvents.Value)
+				{
+					DrawDebugSphere(world, playingEmitter.GetTransform().GetLocation(),
+						themeSettings.Radius, 12, themeSettings.StaticSoundEmitterColor);
+				}
+			}
+		}
+	}
+
+	if (Private_StaticSoundEmitterManager::bViewPortStats && GEngine)
+	{
+		// whitespace
+		static const FString msgWhiteSpaceTop = TEXT("\n\n\n\n");
+		
+		// labels
+		static const FString msgLabels = TEXT("\n\nRange                             Loops                     Posted            In Range          Playing");
+
+		// accumulate emitters in range stats
+		m_dbgNumInRange[m_numDistanceRanges] = 0;
+		for (int i = 0; i < m_dbgNumInRange.Num(); i++)
+		{
+			m_dbgNumInRange[m_numDistanceRanges] += m_dbgNumInRange[i];
+		}
+
+		// ranged stats
+		TArray<FString> msgRangedStatsArray{};
+		msgRangedStatsArray.Init(FString{}, m_numDistanceRanges);
+
+		for (int i = 0; i < m_numDistanceRanges; i++)
+		{
+			// posted events
+			msgRangedStatsArray[i] = m_rangeTexts[i];
+			uint8 currentLength = msgRangedStatsArray[i].Len();
+
+			if (m_spreadOverMultipleFrames)
+			{
+				for (int j = 0; j < 24 - 2 * (m_rangeTextLengths[i] - m_rangeTextLengths[0]) - i; j++) // very ugly, but Unreal discards .AppendChars() etc...
 				{
 					msgRangedStatsArray[i].Append(" ");
 				}
@@ -547,197 +1037,829 @@ void AStaticSoundEmitterWorldManager::Debug()
 	}
 }
 
-void AStaticSoundEmitterWorldManager::UpdateDbgNumLoopsAndEmitters()
+void AStaticSoundEmitterWorldManager::UpdateDbgNumLoopsAndEmitters()
+{
+	m_dbgNumLoops[m_numDistanceRanges] = 0;
+	m_dbgNumPosted[m_numDistanceRanges] = 0;
+
+	for (int i = 0; i < m_numDistanceRanges; i++)
+	{
+		if (m_useSharedGrid)
+		{
+			m_dbgNumLoops[i] = m_grids[i]->GetNumLoops();
+			m_dbgNumPosted[i] = m_grids[i]->Num();
+		}
+		else
+		{
+			m_dbgNumLoops[i] = m_postedLoops[i].Num();
+
+			m_dbgNumPosted[i] = 0;
+			for (TPair<UDA_StaticSoundLoop*, TSharedPtr<TStaticSoundEmitterOctree>> loop : m_postedLoops[i])
+			{
+				m_dbgNumPosted[i] += loop.Value->NumElements;
+			}
+		}
+
+		m_dbgNumLoops[m_numDistanceRanges] += m_dbgNumLoops[i];
+		m_dbgNumPosted[m_numDistanceRanges] += m_dbgNumPosted[i];
+	}
+}
+#endif
+
+void AStaticSoundEmitterWorldManager::PlayAndStopAudioEvents(const uint8 a_distanceIndex)
+{
+	TMap<UDA_StaticSoundLoop*, FStaticSoundEmittersInRange>& eventsToPlay = m_loopsToPlayPerRange[a_distanceIndex];
+	TMap<UDA_StaticSoundLoop*, TSet<FStaticSoundEmitterInstance>>& playingEvents = m_playingEventsPerRange[a_distanceIndex];
+
+	// identify and remove events to stop playing
+	for (auto playingEvent = playingEvents.CreateIterator(); playingEvent; ++playingEvent)
+	{
+		WR_ASSERT(IsValid(playingEvent.Key()), "!IsValid(playingEvent.Key())");
+
+		if (!eventsToPlay.Contains(playingEvent.Key()))
+		{
+			const bool bUseMultiplePositions = playingEvent.Key()->bUseMultiplePositions;
+			if (bUseMultiplePositions) { StopMultiPositionLoop(playingEvent.Key()); }
+
+			// stop playing all sound emitters for this event
+			for (const FStaticSoundEmitterInstance& playingEmitter : playingEvent.Value())
+			{
+				if (IsValid(playingEmitter.Emitter))
+				{
+					if (bUseMultiplePositions)
+					{
+						playingEmitter.Emitter->OnPlayingStateChanged.Broadcast(false, playingEvent.Key());
+					}
+					else
+					{
+						playingEmitter.StopPlayAudio(playingEvent.Key());
+					}
+				}
+				else
+				{
+					WR_DBG_FUNC(Warning, "Trying to stop %s on invalid or destroyed StaticSoundEmitterComponent. Current World: %s",
+						*playingEvent.Key()->GetName(), IsValid(GetWorld()) ? *GetWorld()->GetName() : TEXT("none"));
+				}
+			}
+
+			playingEvent.RemoveCurrent();
+		}
+	}
+
+	// process the events to play
+	for (TPair<UDA_StaticSoundLoop*, FStaticSoundEmittersInRange>& eventToPlay : eventsToPlay)
+	{
+		WR_ASSERT(IsValid(eventToPlay.Key), "!IsValid(eventToPlay.Key)");
+
+		UDA_StaticSoundLoop* loop = eventToPlay.Key;
+		FStaticSoundEmittersInRange& emittersInRange = eventToPlay.Value;
+
+		TSet<FStaticSoundEmitterInstance>* playingEmittersPtr = playingEvents.Find(loop);
+
+		// the playing emitters of a kept selection are unchanged
+		if (playingEmittersPtr != nullptr && !emittersInRange.m_IsReselected) { continue; }
+		emittersInRange.m_IsReselected = false;
+
+		if (playingEmittersPtr == nullptr) // staticSoundLoop not yet playing
+		{
+			playingEmittersPtr = &playingEvents.Emplace(loop);
+			playingEmittersPtr->Reserve(emittersInRange.m_Count);
+		}
+
+		TSet<FStaticSoundEmitterInstance>& playingEmitters = *playingEmittersPtr;
+
+		// stamp the emitters that need to play, instead of gathering them in a set
+		if (++m_selectionStamp == 0) { m_selectionStamp = 1; }
+
+		for (const FStaticEmitterQuadrant& quadrant : emittersInRange.m_StaticSoundEmitterQuadrants)
+		{
+			for (const FStaticEmitterCandidate& candidate : quadrant.m_Candidates)
+			{
+				if (IsValid(candidate.Emitter))
+				{
+					candidate.GetInstance().GetSelectionStamp() = m_selectionStamp;
+				}
+			}
+		}
+
+		// stop emitters that must no longer play
+		for (auto playingEmitter = playingEmitters.CreateIterator(); playingEmitter; ++playingEmitter)
+		{
+			if (playingEmitter->GetSelectionStamp() != m_selectionStamp)
+			{
+				if (loop->bUseMultiplePositions)
+				{
+					playingEmitter->Emitter->OnPlayingStateChanged.Broadcast(false, loop);
+				}
+				else
+				{
+					playingEmitter->StopPlayAudio(loop);
+				}
+
+				playingEmitter.RemoveCurrent();
+			}
+		}
+
+		// start emitters that must begin playing
+		for (const FStaticEmitterQuadrant& quadrant : emittersInRange.m_StaticSoundEmitterQuadrants)
+		{
+			for (const FStaticEmitterCandidate& candidate : quadrant.m_Candidates)
+			{
+				if (IsValid(candidate.Emitter))
+				{
+					bool bWasPlaying = false;
+					playingEmitters.Add(candidate.GetInstance(), &bWasPlaying);
+
+					if (bWasPlaying) { continue; }
+
+					if (loop->bUseMultiplePositions)
+					{
+						candidate.Emitter->OnPlayingStateChanged.Broadcast(true, loop);
+
+#if !UE_BUILD_SHIPPING
+						if (candidate.Emitter->HasGameSyncs() && !m_dbgMultiPositionLoopsWithGameSyncs.Contains(loop))
+						{
+							m_dbgMultiPositionLoopsWithGameSyncs.Add(loop);
+							WR_DBG_FUNC(Warning, "switches and Rtpcs of %s are not applied to %s, which plays on multiple positions",
+								*UAudioUtils::GetFullObjectName(candidate.Emitter), *loop->GetName());
+						}
+#endif
+					}
+					else
+					{
+						candidate.GetInstance().StartPlayAudio(loop);
+					}
+				}
+			}
+		}
+
+		if (loop->bUseMultiplePositions)
+		{
+			PlayMultiPositionLoop(loop, playingEmitters);
+		}
+	}
+
+#if !UE_BUILD_SHIPPING
+	if (Private_StaticSoundEmitterManager::bViewPortStats)
+	{
+		m_dbgNumPlaying[a_distanceIndex] = 0;
+		m_dbgNumPlaying[m_numDistanceRanges] = 0;
+
+		for (const auto& playingEvent : playingEvents)
+		{
+			m_dbgNumPlaying[a_distanceIndex] += playingEvent.Value.Num();
+		}
+
+		for (int i = 0; i < m_numDistanceRanges; i++)
+		{
+			m_dbgNumPlaying[m_numDistanceRanges] += m_dbgNumPlaying[i];
+		}
+	}
+#endif
+}
+
+void AStaticSoundEmitterWorldManager::PlayMultiPositionLoop(UDA_StaticSoundLoop* StaticSoundLoop,
+	const TSet<FStaticSoundEmitterInstance>& PlayingEmitters)
+{
+	if (PlayingEmitters.IsEmpty())
+	{
+		StopMultiPositionLoop(StaticSoundLoop);
+		return;
+	}
+
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (UNLIKELY(!AkAudioDevice || !SoundEngine)) { return; }
+
+	TSharedPtr<FStaticLoopMultiPositionEmitter>& multiPositionEmitter = m_multiPositionEmitters.FindOrAdd(StaticSoundLoop);
+
+	if (!multiPositionEmitter.IsValid())
+	{
+		multiPositionEmitter = MakeShared<FStaticLoopMultiPositionEmitter>();
+
+		// same convention as UAkGameObject, the game object ID is the address of its owner
+		const AkGameObjectID gameObjectID = (AkGameObjectID)multiPositionEmitter.Get();
+
+		if (AkAudioDevice->RegisterGameObject(gameObjectID, StaticSoundLoop->GetName()) != AK_Success)
+		{
+			WR_DBG_FUNC(Warning, "could not register game object for %s", *StaticSoundLoop->GetName());
+			m_multiPositionEmitters.Remove(StaticSoundLoop);
+			return;
+		}
+
+		multiPositionEmitter->GameObjectID = gameObjectID;
+	}
+
+	// one position per playing emitter
+	TArray<AkSoundPosition>& positions = multiPositionEmitter->Positions;
+	positions.SetNum(FMath::Min(PlayingEmitters.Num(), (int32)MAX_uint16), false);
+	int32 positionIndex = 0;
+	FVector closestLocation = m_stableDistanceProbePosition;
+	double closestDistanceSquared = TNumericLimits<double>::Max();
+
+	for (const FStaticSoundEmitterInstance& playingEmitter : PlayingEmitters)
+	{
+		if (positionIndex == positions.Num()) { break; }
+
+		const FTransform transform = playingEmitter.GetTransform();
+		FAkAudioDevice::FVectorsToAKWorldTransform(transform.GetLocation(), transform.GetRotation().GetForwardVector(),
+			transform.GetRotation().GetUpVector(), positions[positionIndex++]);
+
+		const double distanceSquared = FVector::DistSquared(transform.GetLocation(), m_stableDistanceProbePosition);
+
+		if (distanceSquared < closestDistanceSquared)
+		{
+			closestDistanceSquared = distanceSquared;
+			closestLocation = transform.GetLocation();
+		}
+	}
+
+	// one game object can only be in one room
+	multiPositionEmitter->Room = PlaceStaticGameObject(multiPositionEmitter->GameObjectID, closestLocation, GetWorld(),
+		multiPositionEmitter->Room.Get());
+
+	AK::SoundEngine::MultiPositionType multiPositionType;
+	switch (StaticSoundLoop->MultiPositionType)
+	{
+	case AkMultiPositionType::SingleSource:		multiPositionType = AK::SoundEngine::MultiPositionType_SingleSource; break;
+	case AkMultiPositionType::MultiDirections:	multiPositionType = AK::SoundEngine::MultiPositionType_MultiDirections; break;
+	default:									multiPositionType = AK::SoundEngine::MultiPositionType_MultiSources; break;
+	}
+
+	AkAudioDevice->SetMultiplePositions(multiPositionEmitter->GameObjectID, positions.GetData(), (AkUInt16)positions.Num(),
+		multiPositionType);
+
+	if (multiPositionEmitter->PlayingID == AK_INVALID_PLAYING_ID)
+	{
+		multiPositionEmitter->PlayingID = SoundEngine->PostEvent(StaticSoundLoop->LoopEvent->GetShortID(),
+			multiPositionEmitter->GameObjectID);
+
+		if (multiPositionEmitter->PlayingID == AK_INVALID_PLAYING_ID)
+		{
+			WR_DBG_FUNC(Warning, "could not post %s on multi position game object", *StaticSoundLoop->LoopEvent->GetName());
+		}
+	}
+
+	// one voice and game object instead of one per emitter
+	const uint32 numVoicesSaved = positions.Num() - 1;
+	DEC_DWORD_STAT_BY(STAT_WwiserR_StaticLoopVoicesSaved, multiPositionEmitter->NumVoicesSaved);
+	INC_DWORD_STAT_BY(STAT_WwiserR_StaticLoopVoicesSaved, numVoicesSaved);
+	multiPositionEmitter->NumVoicesSaved = numVoicesSaved;
+}
+
+void AStaticSoundEmitterWorldManager::StopMultiPositionLoop(UDA_StaticSoundLoop* StaticSoundLoop, const bool bWaitForFadeOut)
+{
+	TSharedPtr<FStaticLoopMultiPositionEmitter> multiPositionEmitter;
+	if (!m_multiPositionEmitters.RemoveAndCopyValue(StaticSoundLoop, multiPositionEmitter) || !multiPositionEmitter.IsValid()) { return; }
+
+	DEC_DWORD_STAT_BY(STAT_WwiserR_StaticLoopVoicesSaved, multiPositionEmitter->NumVoicesSaved);
+
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	if (UNLIKELY(!AkAudioDevice)) { return; }
+
+	if (multiPositionEmitter->PlayingID != AK_INVALID_PLAYING_ID)
+	{
+		AkAudioDevice->StopPlayingID(multiPositionEmitter->PlayingID,
+			StaticSoundLoop->FadeOutTimeInMs, (AkCurveInterpolation)StaticSoundLoop->FadeOutCurve);
+	}
+
+	UnregisterStaticGameObject(multiPositionEmitter->GameObjectID, multiPositionEmitter, bWaitForFadeOut ? StaticSoundLoop->FadeOutTimeInMs : 0);
+}
+
+void AStaticSoundEmitterWorldManager::UnregisterStaticGameObject(AkGameObjectID GameObjectID, TSharedPtr<const void> Owner,
+	int32 FadeOutTimeInMs)
+{
+	// unregistering the game object cuts the fade out
+	const UWorld* world = GetWorld();
+
+	if (FadeOutTimeInMs > 0 && world != nullptr)
+	{
+		FStaticGameObjectUnregistration& unregistration = m_pendingUnregistrations.AddDefaulted_GetRef();
+		unregistration.GameObjectID = GameObjectID;
+		unregistration.Owner = MoveTemp(Owner);
+		unregistration.UnregisterTime = world->GetTimeSeconds() + FadeOutTimeInMs * 0.001 + 0.1;
+		return;
+	}
+
+	if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
+	{
+		AkAudioDevice->UnregisterComponent(GameObjectID);
+	}
+}
+
+void AStaticSoundEmitterWorldManager::UnregisterPendingGameObjects(const bool bFlush)
+{
+	if (m_pendingUnregistrations.IsEmpty()) { return; }
+
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	const UWorld* world = GetWorld();
+	const double time = world != nullptr ? world->GetTimeSeconds() : 0.0;
+
+	for (int32 i = m_pendingUnregistrations.Num() - 1; i >= 0; i--)
+	{
+		if (bFlush || world == nullptr || m_pendingUnregistrations[i].UnregisterTime <= time)
+		{
+			if (AkAudioDevice != nullptr)
+			{
+				AkAudioDevice->UnregisterComponent(m_pendingUnregistrations[i].GameObjectID);
+			}
+
+			m_pendingUnregistrations.RemoveAtSwap(i, 1, false);
+		}
+	}
+}
+
+const UAkRoomComponent* AStaticSoundEmitterWorldManager::PlaceStaticGameObject(AkGameObjectID GameObjectID, const FVector& Location,
+	UWorld* World, const UAkRoomComponent* CurrentRoom)
+{
+	UWorldSoundListener::UpdateSoundEmitterSendLevels(GameObjectID, Location);
+
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	if (UNLIKELY(!AkAudioDevice) || !AkAudioDevice->WorldHasActiveRooms(World)) { return nullptr; }
+
+	// same as UAkComponent::UpdateSpatialAudioRoom(), newly registered game objects are outdoors
+	const TArray<UAkRoomComponent*> roomComps = AkAudioDevice->FindRoomComponentsAtLocation(Location, World);
+	const UAkRoomComponent* room = roomComps.IsEmpty() ? nullptr : roomComps[0];
+
+	if (room != CurrentRoom)
+	{
+		AkAudioDevice->SetInSpatialAudioRoom(GameObjectID, room != nullptr ? room->GetRoomID() : AkRoomID(AK::SpatialAudio::kOutdoorRoomID));
+	}
+
+	return room;
+}
+
+#if STATS
+SIZE_T AStaticSoundEmitterWorldManager::GetAllocatedSize(const uint8 a_distanceIndex) const
+{
+	SIZE_T allocatedSize = m_octreeLoopsToSelect.GetAllocatedSize() + m_gridQueries.GetAllocatedSize()
+		+ m_loopsToPlayPerRange[a_distanceIndex].GetAllocatedSize() + m_playingEventsPerRange[a_distanceIndex].GetAllocatedSize();
+
+	for (const TPair<UDA_StaticSoundLoop*, FStaticSoundEmittersInRange>& loop : m_loopsToPlayPerRange[a_distanceIndex])
+	{
+		allocatedSize += loop.Value.GetAllocatedSize();
+	}
+
+	for (const TPair<UDA_StaticSoundLoop*, TSet<FStaticSoundEmitterInstance>>& playingEvent : m_playingEventsPerRange[a_distanceIndex])
+	{
+		allocatedSize += playingEvent.Value.GetAllocatedSize();
+	}
+
+	return allocatedSize;
+}
+#endif
+
+TArray<float> AStaticSoundEmitterWorldManager::GetRangeTresholds()
+{
+	const UWwiserRGameSettings* gameSettings = GetDefault<UWwiserRGameSettings>();
+	if (!gameSettings->bSpreadOverMultipleFrames) { return TArray<float>{}; }
+
+	TArray<float> rangeTresholds = gameSettings->DistanceTresholds;
+
+	// sort and remove duplicate and <= 0.f values
+	rangeTresholds.Sort();
+
+	for (int i = rangeTresholds.Num() - 1; i >= 0; i--)
+	{
+		if (rangeTresholds[i] <= 0.f || (i > 0 && rangeTresholds[i] == rangeTresholds[i - 1]))
+		{
+			rangeTresholds.RemoveAt(i);
+		}
+	}
+
+	return rangeTresholds;
+}
+
+uint8 AStaticSoundEmitterWorldManager::GetDistanceRangeIndex(const TArray<float>& RangeTresholds, const float Distance)
+{
+	for (int i = 0; i < RangeTresholds.Num(); i++)
+	{
+		if (Distance < RangeTresholds[i]) { return i; }
+	}
+
+	return RangeTresholds.Num();
+}
+
+float AStaticSoundEmitterWorldManager::GetActivationRange(const UDA_StaticSoundLoop* StaticSoundLoop)
+{
+	return StaticSoundLoop->ActivationRangeOverride > 0.f
+		&& StaticSoundLoop->ActivationRangeOverride < StaticSoundLoop->LoopEvent->MaxAttenuationRadius
+		? StaticSoundLoop->ActivationRangeOverride : StaticSoundLoop->LoopEvent->MaxAttenuationRadius;
+}
+
+float AStaticSoundEmitterWorldManager::GetOrAddPostedLoopRange(UDA_StaticSoundLoop* StaticSoundLoop)
+{
+	if (const float* postedLoopRange = m_postedLoopRanges.Find(StaticSoundLoop))
+	{
+		return *postedLoopRange;
+	}
+
+	const float activationRange = GetActivationRange(StaticSoundLoop);
+
+	if (activationRange <= 0.f)
+	{
+		WR_DBG_FUNC(Warning, "no attenuation range set on %s. Loop was not posted", *StaticSoundLoop->LoopEvent->GetName());
+		return activationRange;
+	}
+
+	m_postedLoopRanges.Add(TPair<UDA_StaticSoundLoop*, float>(StaticSoundLoop, activationRange));
+	return activationRange;
+}
+
+TStaticSoundEmitterOctree& AStaticSoundEmitterWorldManager::GetOrAddOctree(UDA_StaticSoundLoop* StaticSoundLoop,
+	const uint8 a_distanceIndex)
+{
+	if (!m_postedLoops[a_distanceIndex].Contains(StaticSoundLoop))
+	{
+		TSharedPtr<TStaticSoundEmitterOctree> emitterOctree = MakeShared<TStaticSoundEmitterOctree>(a_distanceIndex);
+
+		m_postedLoops[a_distanceIndex].Add(TPair<UDA_StaticSoundLoop*, TSharedPtr<TStaticSoundEmitterOctree>>(
+			StaticSoundLoop, emitterOctree));
+	}
+
+	return *m_postedLoops[a_distanceIndex][StaticSoundLoop];
+}
+
+void AStaticSoundEmitterWorldManager::InvalidateLoop(UDA_StaticSoundLoop* StaticSoundLoop, const uint8 a_distanceIndex)
+{
+	if (FStaticSoundEmittersInRange* selection = m_loopsToPlayPerRange[a_distanceIndex].Find(StaticSoundLoop))
+	{
+		selection->m_IsValid = false;
+	}
+
+	if (FStaticLoopSchedule* schedule = m_loopSchedules.Find(StaticSoundLoop))
+	{
+		schedule->NextUpdateTime = 0.0;
+	}
+}
+
+#pragma region Baked Emitters
+FBakedStaticSoundEmitters& AStaticSoundEmitterWorldManager::RegisterBakedLevel(ULevel* Level)
+{
+	FBakedStaticSoundEmitters& bakedLevel = m_bakedLevels.Add(Level);
+
+	const UStaticSoundEmitterDatabase* database = Level->GetAssetUserData<UStaticSoundEmitterDatabase>();
+	if (database == nullptr || database->Records.IsEmpty()) { return bakedLevel; }
+
+	bakedLevel.Database = database;
+	bakedLevel.Serial = m_nextBakedSerial++;
+	bakedLevel.IsAttached.Init(false, database->Records.Num());
+
+	// streamed levels can be placed with a transform
+	if (const ULevelStreaming* levelStreaming = ULevelStreaming::FindStreamingLevel(Level))
+	{
+		bakedLevel.LevelTransform = levelStreaming->LevelTransform;
+	}
+
+	// resolve each loop once instead of per emitter
+	const bool bRangeTresholdsChanged = database->RangeTresholdsHash != UStaticSoundEmitterDatabase::GetRangeTresholdsHash(m_rangeTresholds);
+	bakedLevel.LoopRangeIndices.Init(INDEX_NONE, database->Loops.Num());
+
+	for (int32 loopIndex = 0; loopIndex < database->Loops.Num(); loopIndex++)
+	{
+		UDA_StaticSoundLoop* staticSoundLoop = database->Loops[loopIndex];
+		if (!IsValid(staticSoundLoop) || !IsValid(staticSoundLoop->LoopEvent)) { continue; }
+
+		const float activationRange = GetOrAddPostedLoopRange(staticSoundLoop);
+		if (activationRange <= 0.f) { continue; }
+
+		const uint8 distRangeIdx = GetDistanceRangeIndex(activationRange);
+		bakedLevel.LoopRangeIndices[loopIndex] = distRangeIdx;
+		InvalidateLoop(staticSoundLoop, distRangeIdx);
+	}
+
+	// bulk build
+	bool bHasOutdatedRanges = false;
+
+	for (const FStaticSoundEmitterRecord& record : database->Records)
+	{
+		const int8 distRangeIdx = bakedLevel.LoopRangeIndices[record.LoopIndex];
+		if (distRangeIdx == INDEX_NONE) { continue; }
+
+		bHasOutdatedRanges |= !bRangeTresholdsChanged && record.RangeIndex != distRangeIdx;
+
+		UDA_StaticSoundLoop* staticSoundLoop = database->Loops[record.LoopIndex];
+		const FVector location = bakedLevel.LevelTransform.TransformPosition(FVector(record.Location));
+		const uint64 bakedKey = GetBakedKey(bakedLevel.Serial, record);
+
+		if (m_useSharedGrid)
+		{
+			m_grids[distRangeIdx]->AddBakedEmitter(location, staticSoundLoop, bakedKey);
+		}
+		else
+		{
+			GetOrAddOctree(staticSoundLoop, distRangeIdx).AddBakedEmitter(location, bakedKey);
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_WwiserR_StaticEmittersBaked, database->Records.Num());
+
+	if (bRangeTresholdsChanged || bHasOutdatedRanges)
+	{
+		WR_DBG_FUNC(Warning, "static sound emitters of %s were baked with other distance ranges or activation ranges, resave the level",
+			*Level->GetOutermost()->GetName());
+	}
+
+	if (Private_StaticSoundEmitterManager::bDebugConsole)
+	{
+		WR_DBG_FUNC(Log, "%i baked static sound emitters of %s registered", database->Records.Num(), *Level->GetOutermost()->GetName());
+	}
+
+#if !UE_BUILD_SHIPPING
+	if (Private_StaticSoundEmitterManager::bViewPortStats) { UpdateDbgNumLoopsAndEmitters(); }
+#endif
+
+	return bakedLevel;
+}
+
+bool AStaticSoundEmitterWorldManager::TryToAttachBakedEmitter(UStaticSoundEmitterComponent* StaticSoundEmitterComponent,
+	UDA_StaticSoundLoop* StaticSoundLoop)
+{
+	if (!m_useBakedEmitters || StaticSoundEmitterComponent->m_bakedSlot == INDEX_NONE) { return false; }
+
+	ULevel* level = StaticSoundEmitterComponent->GetComponentLevel();
+	if (level == nullptr) { return false; }
+
+	FBakedStaticSoundEmitters* bakedLevel = m_bakedLevels.Find(level);
+	if (bakedLevel == nullptr)
+	{
+		bakedLevel = &RegisterBakedLevel(level);
+	}
+
+	if (bakedLevel->Database == nullptr) { return false; }
+
+	// the records of a component are contiguous, starting at its baked slot
+	const TArray<FStaticSoundEmitterRecord>& records = bakedLevel->Database->Records;
+
+	for (int32 slot = StaticSoundEmitterComponent->m_bakedSlot;
+		slot < records.Num() && records[slot].StableID == StaticSoundEmitterComponent->m_stableID; slot++)
+	{
+		const FStaticSoundEmitterRecord& record = records[slot];
+		if (bakedLevel->Database->Loops[record.LoopIndex] != StaticSoundLoop) { continue; }
+
+		const int8 distRangeIdx = bakedLevel->LoopRangeIndices[record.LoopIndex];
+		if (bakedLevel->IsAttached[slot] || distRangeIdx == INDEX_NONE) { return false; }
+
+		const uint64 bakedKey = GetBakedKey(bakedLevel->Serial, record);
+
+		// moved since the level was saved (construction script, moved parent, unsaved database), the baked emitter is dropped and
+		// the component is inserted at its actual location
+		const FVector bakedLocation = bakedLevel->LevelTransform.TransformPosition(FVector(record.Location));
+
+		if (!bakedLocation.Equals(StaticSoundEmitterComponent->GetComponentLocation(), Private_StaticSoundEmitterManager::BakedLocationTolerance))
+		{
+			WR_DBG_FUNC(Warning, "%s moved since its level was baked, resave the level", *UAudioUtils::GetFullObjectName(StaticSoundEmitterComponent));
+
+			if (m_useSharedGrid)
+			{
+				m_grids[distRangeIdx]->RemoveBakedEmitter(bakedKey);
+			}
+			else if (TSharedPtr<TStaticSoundEmitterOctree>* emitterOctree = m_postedLoops[distRangeIdx].Find(StaticSoundLoop))
+			{
+				(*emitterOctree)->RemoveBakedEmitter(bakedKey);
+			}
+
+			// the slot is taken by the component, it's removed with the component instead of with the level
+			bakedLevel->IsAttached[slot] = true;
+			InvalidateLoop(StaticSoundLoop, distRangeIdx);
+			INC_DWORD_STAT(STAT_WwiserR_StaticEmittersAttached);
+			return false;
+		}
+
+		const bool bAttached = m_useSharedGrid ? m_grids[distRangeIdx]->AttachEmitter(bakedKey, StaticSoundEmitterComponent)
+			: m_postedLoops[distRangeIdx].Contains(StaticSoundLoop)
+			&& m_postedLoops[distRangeIdx][StaticSoundLoop]->AttachEmitter(bakedKey, StaticSoundEmitterComponent);
+
+		if (bAttached)
+		{
+			bakedLevel->IsAttached[slot] = true;
+			InvalidateLoop(StaticSoundLoop, distRangeIdx);
+			INC_DWORD_STAT(STAT_WwiserR_StaticEmittersAttached);
+		}
+
+		return bAttached;
+	}
+
+	return false;
+}
+
+void AStaticSoundEmitterWorldManager::OnLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld()) { return; }
+
+	FBakedStaticSoundEmitters bakedLevel;
+	if (!m_bakedLevels.RemoveAndCopyValue(Level, bakedLevel) || bakedLevel.Database == nullptr) { return; }
+
+	LLM_SCOPE_BYTAG(WwiserR_StaticSoundEmitters);
+
+	// attached emitters were removed when their components stopped their loops
+	const TArray<FStaticSoundEmitterRecord>& records = bakedLevel.Database->Records;
+
+	for (int32 slot = 0; slot < records.Num(); slot++)
+	{
+		const int8 distRangeIdx = bakedLevel.LoopRangeIndices[records[slot].LoopIndex];
+		if (bakedLevel.IsAttached[slot] || distRangeIdx == INDEX_NONE) { continue; }
+
+		UDA_StaticSoundLoop* staticSoundLoop = bakedLevel.Database->Loops[records[slot].LoopIndex];
+		const uint64 bakedKey = GetBakedKey(bakedLevel.Serial, records[slot]);
+
+		if (m_useSharedGrid)
+		{
+			m_grids[distRangeIdx]->RemoveBakedEmitter(bakedKey);
+
+			if (m_grids[distRangeIdx]->GetNumEmitters(staticSoundLoop) <= 0)
+			{
+				m_postedLoopRanges.Remove(staticSoundLoop);
+				m_loopSchedules.Remove(staticSoundLoop);
+			}
+		}
+		else if (TSharedPtr<TStaticSoundEmitterOctree>* emitterOctree = m_postedLoops[distRangeIdx].Find(staticSoundLoop))
+		{
+			(*emitterOctree)->RemoveBakedEmitter(bakedKey);
+
+			if ((*emitterOctree)->NumElements <= 0)
+			{
+				m_postedLoops[distRangeIdx].Remove(staticSoundLoop);
+				m_postedLoopRanges.Remove(staticSoundLoop);
+				m_loopSchedules.Remove(staticSoundLoop);
+			}
+		}
+	}
+
+	DEC_DWORD_STAT_BY(STAT_WwiserR_StaticEmittersBaked, records.Num());
+	DEC_DWORD_STAT_BY(STAT_WwiserR_StaticEmittersAttached, bakedLevel.IsAttached.CountSetBits());
+
+#if !UE_BUILD_SHIPPING
+	if (Private_StaticSoundEmitterManager::bViewPortStats) { UpdateDbgNumLoopsAndEmitters(); }
+#endif
+}
+#pragma endregion
+
+#pragma region Registration
+void AStaticSoundEmitterWorldManager::PostLoop(
+	UStaticSoundEmitterComponent* StaticSoundEmitterComponent, UDA_StaticSoundLoop* StaticSoundLoop)
 {
-	m_dbgNumLoops[m_numDistanceRanges] = 0;
-	m_dbgNumPosted[m_numDistanceRanges] = 0;
+	const FStaticSoundEmitterRegistration registration(StaticSoundEmitterComponent, StaticSoundLoop);
 
-	for (int i = 0; i < m_numDistanceRanges; i++)
+	if (!m_batchRegistration)
 	{
-		m_dbgNumLoops[i] = m_postedLoops[i].Num();
-		m_dbgNumLoops[m_numDistanceRanges] += m_dbgNumLoops[i];
+		AddEmitters(StaticSoundLoop, MakeArrayView(&registration, 1));
+		return;
+	}
 
-		m_dbgNumPosted[i] = 0;
-		for (TPair<UDA_StaticSoundLoop*, TSharedPtr<TStaticSoundEmitterOctree>> loop : m_postedLoops[i])
-		{
-			m_dbgNumPosted[i] += loop.Value->NumElements;
-		}
-		m_dbgNumPosted[m_numDistanceRanges] += m_dbgNumPosted[i];
+	// a queued removal cancels out
+	if (const bool* isAdded = m_pendingRegistrations.Find(registration))
+	{
+		if (!*isAdded) { m_pendingRegistrations.Remove(registration); }
+		return;
 	}
+
+	m_pendingRegistrations.Add(registration, true);
 }
-#endif
 
-void AStaticSoundEmitterWorldManager::PlayAndStopAudioEvents(const uint8 a_distanceIndex)
+void AStaticSoundEmitterWorldManager::StopLoop(
+	UStaticSoundEmitterComponent* StaticSoundEmitterComponent, UDA_StaticSoundLoop* StaticSoundLoop)
 {
-	TMap<UDA_StaticSoundLoop*, FStaticSoundEmittersInRange>& eventsToPlay = m_loopsToPlayPerRange[a_distanceIndex];
-	TMap<UDA_StaticSoundLoop*, TSet<UStaticSoundEmitterComponent*>>& playingEvents = m_playingEventsPerRange[a_distanceIndex];
-	TSet<UDA_StaticSoundLoop*> eventsToRemove = TSet<UDA_StaticSoundLoop*>();
-	
-	// identify and remove events to stop playing
-	for (TPair<UDA_StaticSoundLoop*, TSet<UStaticSoundEmitterComponent*>>& playingEvent : playingEvents)
+	if (!m_batchRegistration)
 	{
-		WR_ASSERT(IsValid(playingEvent.Key), "!IsValid(playingEvent.Key)");
-		
-		if (!eventsToPlay.Contains(playingEvent.Key))
-		{
-			// stop playing all sound emitters for this event
-			for (UStaticSoundEmitterComponent* StaticSoundEmitterComponent : playingEvent.Value)
-			{
-				if (IsValid(StaticSoundEmitterComponent))
-				{
-					StaticSoundEmitterComponent->StopPlayAudio(playingEvent.Key);
-				}
-				else
-				{
-					WR_DBG_FUNC(Warning, "Trying to stop %s on invalid or destroyed StaticSoundEmitterComponent. Current World: %s",
-						*playingEvent.Key->GetName(), IsValid(GetWorld()) ? *GetWorld()->GetName() : TEXT("none"));
-				}
-			}
-
-			eventsToRemove.Emplace(playingEvent.Key);
-		}
+		RemoveEmitter(StaticSoundEmitterComponent, StaticSoundLoop);
+		return;
 	}
 
-	for (UDA_StaticSoundLoop* eventToRemove : eventsToRemove)
+	// a queued add cancels out
+	const FStaticSoundEmitterRegistration registration(StaticSoundEmitterComponent, StaticSoundLoop);
+
+	if (const bool* isAdded = m_pendingRegistrations.Find(registration))
 	{
-		playingEvents.Remove(eventToRemove);
+		if (*isAdded) { m_pendingRegistrations.Remove(registration); }
+		return;
 	}
 
-	// process the events to play
-	for (TPair<UDA_StaticSoundLoop*, FStaticSoundEmittersInRange>& eventToPlay : eventsToPlay)
+	m_pendingRegistrations.Add(registration, false);
+}
+
+void AStaticSoundEmitterWorldManager::ApplyPendingRegistrations(const bool bRemovalsOnly)
+{
+	SET_DWORD_STAT(STAT_WwiserR_StaticEmitterRegistrationsApplied, 0);
+	SET_DWORD_STAT(STAT_WwiserR_StaticEmitterRegistrationsPending, m_pendingRegistrations.Num());
+	if (m_pendingRegistrations.IsEmpty()) { return; }
+
+	const double startTime = FPlatformTime::Seconds();
+	uint32 numApplied = 0;
+
+	// removals are never deferred, components can be garbage collected once they ended play
+	m_registrationBatch.Reset();
+
+	for (TMap<FStaticSoundEmitterRegistration, bool>::TIterator it = m_pendingRegistrations.CreateIterator(); it; ++it)
 	{
-		WR_ASSERT(IsValid(eventToPlay.Key), "!IsValid(eventToPlay.Key)");
+		if (it->Value)
+		{
+			m_registrationBatch.Add(it->Key);
+			continue;
+		}
 
-		UDA_StaticSoundLoop* loop = eventToPlay.Key;
-		FStaticSoundEmittersInRange& emittersInRange = eventToPlay.Value;
+		RemoveEmitter(it->Key.StaticSoundEmitterComponent, it->Key.StaticSoundLoop);
+		it.RemoveCurrent();
+		numApplied++;
+	}
 
-		TSet<UStaticSoundEmitterComponent*>* playingEmittersPtr = playingEvents.Find(loop);
+	if (!bRemovalsOnly)
+	{
+		// adds grouped per loop, so each octree or grid is filled in one go
+		Algo::SortBy(m_registrationBatch, &FStaticSoundEmitterRegistration::StaticSoundLoop);
 
-		if (playingEmittersPtr != nullptr)
+		for (int32 first = 0; first < m_registrationBatch.Num();)
 		{
-			TSet<UStaticSoundEmitterComponent*>& playingEmitters = *playingEmittersPtr;
+			UDA_StaticSoundLoop* staticSoundLoop = m_registrationBatch[first].StaticSoundLoop;
+			int32 last = first + 1;
 
-			// gather emitters that need to play
-			TSet<UStaticSoundEmitterComponent*> emittersToPlay;
-			emittersToPlay.Reserve(emittersInRange.m_Count);
+			while (last < m_registrationBatch.Num() && m_registrationBatch[last].StaticSoundLoop == staticSoundLoop) { last++; }
 
-			for (const FStaticEmitterQuadrant& quadrant : eventToPlay.Value.m_StaticSoundEmitterQuadrants)
-			{
-				emittersToPlay.Append(quadrant.m_Emitters.FilterByPredicate([](UStaticSoundEmitterComponent* emitter)
-					{
-						return IsValid(emitter);
-					}));
-			}
+			const TConstArrayView<FStaticSoundEmitterRegistration> registrations(&m_registrationBatch[first], last - first);
+			AddEmitters(staticSoundLoop, registrations);
 
-			// stop emitters that must no longer play
-			TSet<UStaticSoundEmitterComponent*> emittersToRemove;
-			for (UStaticSoundEmitterComponent* emitter : playingEmitters)
+			for (const FStaticSoundEmitterRegistration& registration : registrations)
 			{
-				if (!emittersToPlay.Contains(emitter))
-				{
-					emitter->StopPlayAudio(loop);
-					emittersToRemove.Emplace(emitter);
-				}
+				m_pendingRegistrations.Remove(registration);
 			}
-			playingEmitters = playingEmitters.Difference(emittersToRemove);
 
-			// start emitters that must begin playing
-			for (UStaticSoundEmitterComponent* emitter : emittersToPlay)
-			{
-				if (!playingEmitters.Contains(emitter))
-				{
-					emitter->StartPlayAudio(loop);
-					playingEmitters.Emplace(emitter);
-				}
-			}
-		}
-		else // staticSoundLoop not yet playing
-		{
-			TSet<UStaticSoundEmitterComponent*>& newEmitters = playingEvents.Emplace(loop);
-			newEmitters.Reserve(emittersInRange.m_Count);
+			numApplied += registrations.Num();
+			first = last;
 
-			for (const FStaticEmitterQuadrant& quadrant : emittersInRange.m_StaticSoundEmitterQuadrants)
-			{
-				for (UStaticSoundEmitterComponent* emitter : quadrant.m_Emitters)
-				{
-					if (IsValid(emitter))
-					{
-						newEmitters.Emplace(emitter);
-						emitter->StartPlayAudio(loop);
-					}
-				}
-			}
+			// the remaining loops are added next frame
+			if ((FPlatformTime::Seconds() - startTime) * 1000.0 > m_registrationBudgetMs) { break; }
 		}
 	}
 
-#if !UE_BUILD_SHIPPING
-	if (Private_StaticSoundEmitterManager::bViewPortStats)
-	{
-		m_dbgNumPlaying[a_distanceIndex] = 0;
-		m_dbgNumPlaying[m_numDistanceRanges] = 0;
-
-		for (const auto& playingEvent : playingEvents)
-		{
-			m_dbgNumPlaying[a_distanceIndex] += playingEvent.Value.Num();
-		}
+	SET_DWORD_STAT(STAT_WwiserR_StaticEmitterRegistrationsApplied, numApplied);
+	SET_DWORD_STAT(STAT_WwiserR_StaticEmitterRegistrationsPending, m_pendingRegistrations.Num());
 
-		for (int i = 0; i < m_numDistanceRanges; i++)
-		{
-			m_dbgNumPlaying[m_numDistanceRanges] += m_dbgNumPlaying[i];
-		}
+	if (Private_StaticSoundEmitterManager::bDebugConsole)
+	{
+		WR_DBG_FUNC(Log, "%i registrations applied in %.3f ms, %i pending", numApplied,
+			(FPlatformTime::Seconds() - startTime) * 1000.0, m_pendingRegistrations.Num());
 	}
-#endif
 }
 
-
-float AStaticSoundEmitterWorldManager::GetActivationRange(const UDA_StaticSoundLoop* StaticSoundLoop) const
+void AStaticSoundEmitterWorldManager::OnPreGarbageCollect()
 {
-	return StaticSoundLoop->ActivationRangeOverride > 0.f
-		&& StaticSoundLoop->ActivationRangeOverride < StaticSoundLoop->LoopEvent->MaxAttenuationRadius
-		? StaticSoundLoop->ActivationRangeOverride : StaticSoundLoop->LoopEvent->MaxAttenuationRadius;
+	LLM_SCOPE_BYTAG(WwiserR_StaticSoundEmitters);
+	ApplyPendingRegistrations(true);
 }
 
-void AStaticSoundEmitterWorldManager::PostLoop(
-	UStaticSoundEmitterComponent* StaticSoundEmitterComponent, UDA_StaticSoundLoop* StaticSoundLoop)
+void AStaticSoundEmitterWorldManager::AddEmitters(
+	UDA_StaticSoundLoop* StaticSoundLoop, TConstArrayView<FStaticSoundEmitterRegistration> Registrations)
 {
-	float activationRange;
+	LLM_SCOPE_BYTAG(WwiserR_StaticSoundEmitters);
 
-	if (m_postedLoopRanges.Contains(StaticSoundLoop))
-	{
-		activationRange = m_postedLoopRanges[StaticSoundLoop];
-	}
-	else
-	{
-		activationRange = GetActivationRange(StaticSoundLoop);
+	// baked emitters attach to their slot
+	m_emittersToAdd.Reset();
 
-		if (activationRange <= 0.f)
+	for (const FStaticSoundEmitterRegistration& registration : Registrations)
+	{
+		if (!TryToAttachBakedEmitter(registration.StaticSoundEmitterComponent, StaticSoundLoop))
 		{
-			WR_DBG_FUNC(Warning, "no attenuation range set on %s. Loop was not posted", *StaticSoundLoop->LoopEvent->GetName());
-			return;
+			m_emittersToAdd.Add(registration.StaticSoundEmitterComponent);
 		}
+	}
+
+	const float activationRange = m_emittersToAdd.IsEmpty() ? 0.f : GetOrAddPostedLoopRange(StaticSoundLoop);
 
-		m_postedLoopRanges.Add(TPair<UDA_StaticSoundLoop*, float>(StaticSoundLoop, activationRange));
+	if (activationRange <= 0.f)
+	{
+#if !UE_BUILD_SHIPPING
+		if (Private_StaticSoundEmitterManager::bViewPortStats) { UpdateDbgNumLoopsAndEmitters(); }
+#endif
+		return;
 	}
 
 	uint8 distRangeIdx = GetDistanceRangeIndex(activationRange);
+	InvalidateLoop(StaticSoundLoop, distRangeIdx);
 
-	if (!m_postedLoops[distRangeIdx].Contains(StaticSoundLoop))
+	if (m_useSharedGrid)
 	{
-		TSharedPtr<TStaticSoundEmitterOctree> emitterOctree = MakeShared<TStaticSoundEmitterOctree>(distRangeIdx);
+		m_grids[distRangeIdx]->Reserve(m_emittersToAdd.Num());
 
-		m_postedLoops[distRangeIdx].Add(TPair<UDA_StaticSoundLoop*, TSharedPtr<TStaticSoundEmitterOctree>>(
-			StaticSoundLoop, emitterOctree));
+		for (UStaticSoundEmitterComponent* staticSoundEmitterComponent : m_emittersToAdd)
+		{
+			m_grids[distRangeIdx]->AddEmitter(staticSoundEmitterComponent, StaticSoundLoop);
+		}
+	}
+	else
+	{
+		GetOrAddOctree(StaticSoundLoop, distRangeIdx).AddEmitters(m_emittersToAdd);
 	}
-
-	m_postedLoops[distRangeIdx][StaticSoundLoop]->AddEmitter(StaticSoundEmitterComponent);
 
 	if (Private_StaticSoundEmitterManager::bDebugConsole)
 	{
-		WR_DBG_FUNC(Log, "[%s] posted on %s. Activation Range: %.2f, Range: %s",
-			*StaticSoundLoop->LoopEvent->GetName(), *UAudioUtils::GetFullObjectName(StaticSoundEmitterComponent),
-			activationRange, *m_rangeTexts[distRangeIdx]);
+		for (UStaticSoundEmitterComponent* staticSoundEmitterComponent : m_emittersToAdd)
+		{
+			WR_DBG_FUNC(Log, "[%s] posted on %s. Activation Range: %.2f, Range: %s%s",
+				*StaticSoundLoop->LoopEvent->GetName(), *UAudioUtils::GetFullObjectName(staticSoundEmitterComponent),
+				activationRange, *m_rangeTexts[distRangeIdx], m_useSharedGrid ? TEXT(" (shared grid)") : TEXT(""));
+		}
 
-		if (Private_StaticSoundEmitterManager::bDebugConsoleOctreeStats)
+		if (Private_StaticSoundEmitterManager::bDebugConsoleOctreeStats && !m_useSharedGrid)
 		{
 			WR_DBG_FUNC(Log, "Dump Octree Stats - %s", *StaticSoundLoop->GetName());
 			m_postedLoops[distRangeIdx][StaticSoundLoop]->DumpStats();
@@ -749,52 +1871,80 @@ void AStaticSoundEmitterWorldManager::PostLoop(
 #endif
 }
 
-void AStaticSoundEmitterWorldManager::StopLoop(
+void AStaticSoundEmitterWorldManager::RemoveEmitter(
 	UStaticSoundEmitterComponent* StaticSoundEmitterComponent, UDA_StaticSoundLoop* StaticSoundLoop)
 {
+	LLM_SCOPE_BYTAG(WwiserR_StaticSoundEmitters);
 	if (!m_postedLoopRanges.Contains(StaticSoundLoop)) { return; }
 
 	const float activationRange = m_postedLoopRanges[StaticSoundLoop];
 	const uint8 distRangeIdx = GetDistanceRangeIndex(activationRange);
 
-	// remove from m_postedLoops
-	if (m_postedLoops[distRangeIdx][StaticSoundLoop]->ObjectToOctreeId.Contains(StaticSoundEmitterComponent->GetUniqueID()))
+	// remove from m_grids or m_postedLoops
+	if (m_useSharedGrid)
 	{
-		m_postedLoops[distRangeIdx][StaticSoundLoop]->RemoveEmitter(StaticSoundEmitterComponent);
-	}
+		m_grids[distRangeIdx]->RemoveEmitter(StaticSoundEmitterComponent, StaticSoundLoop);
 
-	if (m_postedLoops[distRangeIdx][StaticSoundLoop]->NumElements <= 0)
+		if (m_grids[distRangeIdx]->GetNumEmitters(StaticSoundLoop) <= 0)
+		{
+			m_postedLoopRanges.Remove(StaticSoundLoop);
+			m_loopSchedules.Remove(StaticSoundLoop);
+		}
+	}
+	else
 	{
-		m_postedLoops[distRangeIdx].Remove(StaticSoundLoop);
-		m_postedLoopRanges.Remove(StaticSoundLoop);
+		m_postedLoops[distRangeIdx][StaticSoundLoop]->RemoveEmitter(StaticSoundEmitterComponent);
+
+		if (m_postedLoops[distRangeIdx][StaticSoundLoop]->NumElements <= 0)
+		{
+			m_postedLoops[distRangeIdx].Remove(StaticSoundLoop);
+			m_postedLoopRanges.Remove(StaticSoundLoop);
+			m_loopSchedules.Remove(StaticSoundLoop);
+		}
 	}
 
 	// remove from m_playingEventsPerRange
-	if (m_playingEventsPerRange[distRangeIdx].Contains(StaticSoundLoop)
-		&& m_playingEventsPerRange[distRangeIdx][StaticSoundLoop].Contains(StaticSoundEmitterComponent))
+	UInstancedStaticSoundEmitterComponent* instancedComponent = Cast<UInstancedStaticSoundEmitterComponent>(StaticSoundEmitterComponent);
+	TSet<FStaticSoundEmitterInstance>* playingEmitters = m_playingEventsPerRange[distRangeIdx].Find(StaticSoundLoop);
+
+	if (playingEmitters != nullptr)
 	{
-		m_playingEventsPerRange[distRangeIdx][StaticSoundLoop].Remove(StaticSoundEmitterComponent);
+		if (instancedComponent != nullptr)
+		{
+			// instance game objects aren't owned by the component's lifetime, stop them here
+			for (auto playingEmitter = playingEmitters->CreateIterator(); playingEmitter; ++playingEmitter)
+			{
+				if (playingEmitter->Emitter == StaticSoundEmitterComponent) { playingEmitter.RemoveCurrent(); }
+			}
+
+			instancedComponent->StopPlayAllInstances(StaticSoundLoop);
+		}
+		else
+		{
+			playingEmitters->Remove(FStaticSoundEmitterInstance(StaticSoundEmitterComponent));
+		}
 
-		if (m_playingEventsPerRange[distRangeIdx][StaticSoundLoop].IsEmpty())
+		if (playingEmitters->IsEmpty())
 		{
 			const bool wasRemoved = m_playingEventsPerRange[distRangeIdx].Remove(StaticSoundLoop) > 0;
+			StopMultiPositionLoop(StaticSoundLoop);
 		}
 	}
 
 	// remove from m_loopsToPlayPerRange
 	if (m_loopsToPlayPerRange[distRangeIdx].Contains(StaticSoundLoop))
 	{
-		for (int i = 0; i < 4; i++)
+		FStaticSoundEmittersInRange& emittersInRange = m_loopsToPlayPerRange[distRangeIdx][StaticSoundLoop];
+		emittersInRange.m_IsValid = false;
+
+		if (FStaticLoopSchedule* schedule = m_loopSchedules.Find(StaticSoundLoop))
 		{
-			if (m_loopsToPlayPerRange[distRangeIdx][StaticSoundLoop].m_StaticSoundEmitterQuadrants[i].m_Emitters.Contains(StaticSoundEmitterComponent))
-			{
-				m_loopsToPlayPerRange[distRangeIdx][StaticSoundLoop].m_StaticSoundEmitterQuadrants[i].m_Emitters.Remove(
-					StaticSoundEmitterComponent);
-				m_loopsToPlayPerRange[distRangeIdx][StaticSoundLoop].m_StaticSoundEmitterQuadrants[i].m_Count--;
-				m_loopsToPlayPerRange[distRangeIdx][StaticSoundLoop].m_Count--;
+			schedule->NextUpdateTime = 0.0;
+		}
 
-				break;
-			}
+		for (FStaticEmitterQuadrant& quadrant : emittersInRange.m_StaticSoundEmitterQuadrants)
+		{
+			emittersInRange.m_Count -= quadrant.RemoveEmitter(StaticSoundEmitterComponent);
 		}
 
 		if (m_loopsToPlayPerRange[distRangeIdx][StaticSoundLoop].m_Count == 0)
@@ -809,7 +1959,7 @@ void AStaticSoundEmitterWorldManager::StopLoop(
 			*StaticSoundLoop->LoopEvent->GetName(), *UAudioUtils::GetFullObjectName(StaticSoundEmitterComponent),
 			activationRange, *m_rangeTexts[distRangeIdx]);
 
-		if (Private_StaticSoundEmitterManager::bDebugConsoleOctreeStats)
+		if (Private_StaticSoundEmitterManager::bDebugConsoleOctreeStats && m_postedLoops[distRangeIdx].Contains(StaticSoundLoop))
 		{
 			WR_DBG_FUNC(Log, "Dump Octree Stats - %s", *StaticSoundLoop->GetName());
 			m_postedLoops[distRangeIdx][StaticSoundLoop]->DumpStats();
@@ -820,6 +1970,49 @@ void AStaticSoundEmitterWorldManager::StopLoop(
 	if (Private_StaticSoundEmitterManager::bViewPortStats) { UpdateDbgNumLoopsAndEmitters(); }
 #endif
 }
+
+#pragma endregion
+
+bool AStaticSoundEmitterWorldManager::ShouldReselect(const UDA_StaticSoundLoop* StaticSoundLoop,
+	const FStaticSoundEmittersInRange& Selection, const FVector& ReferencePosition, const float ActivationRange) const
+{
+	if (!Private_StaticSoundEmitterManager::bTemporalCoherence || !Selection.m_IsValid
+		|| !Selection.HasLimits(StaticSoundLoop->MaxInstancesPerQuadrant, StaticSoundLoop->MaxInstances))
+	{
+		return true;
+	}
+
+	const float toleratedDistance = StaticSoundLoop->ReselectionDistanceFraction * ActivationRange;
+	return FVector::DistSquared(ReferencePosition, Selection.m_ReferencePosition) > toleratedDistance * toleratedDistance;
+}
+
+bool AStaticSoundEmitterWorldManager::ShouldUseSharedGrid() const
+{
+	if (Private_StaticSoundEmitterManager::SpatialIndex >= 0)
+	{
+		return Private_StaticSoundEmitterManager::SpatialIndex == (int32)EStaticSoundEmitterSpatialIndex::SharedGrid;
+	}
+
+	const UWwiserRGameSettings* gameSettings = GetDefault<UWwiserRGameSettings>();
+	EStaticSoundEmitterSpatialIndex spatialIndex = gameSettings->StaticSoundEmitterSpatialIndex;
+
+	if (!gameSettings->StaticSoundEmitterSpatialIndexOverrides.IsEmpty())
+	{
+		const FString packageName = UWorld::RemovePIEPrefix(GetWorld()->GetOutermost()->GetName());
+
+		for (const TPair<FSoftObjectPath, EStaticSoundEmitterSpatialIndex>& spatialIndexOverride :
+			gameSettings->StaticSoundEmitterSpatialIndexOverrides)
+		{
+			if (spatialIndexOverride.Key.GetLongPackageName() == packageName)
+			{
+				spatialIndex = spatialIndexOverride.Value;
+				break;
+			}
+		}
+	}
+
+	return spatialIndex == EStaticSoundEmitterSpatialIndex::SharedGrid;
+}
 #pragma endregion
 
 #pragma region UStaticSoundEmitterManager
@@ -894,3 +2087,187 @@ void UStaticSoundEmitterManager::OnPostWorldCleanup(UWorld* World, bool bSession
 	m_worldManagers.Remove(World);
 }
 #pragma endregion
+
+#pragma region Benchmark
+#if !UE_BUILD_SHIPPING
+namespace Private_StaticSoundEmitterManager
+{
+	// quadrant as selected before the per quadrant max-heaps: the selected positions are rescanned on every replacement
+	struct FLinearQuadrantSelection
+	{
+		TArray<int32> Emitters{};	// indices into the candidate positions
+		float MaxDistanceSquared = -1.f;
+		int32 MaxDistanceIndex = 0;
+		int32 Capacity = 0;
+
+		void UpdateMaxDistance(const TArray<FVector>& Positions, const FVector& ReferencePosition)
+		{
+			MaxDistanceSquared = 0.f;
+			MaxDistanceIndex = 0;
+
+			for (int32 i = 0; i < Emitters.Num(); i++)
+			{
+				const float distanceSquared = FVector::DistSquared(Positions[Emitters[i]], ReferencePosition);
+
+				if (distanceSquared > MaxDistanceSquared)
+				{
+					MaxDistanceSquared = distanceSquared;
+					MaxDistanceIndex = i;
+				}
+			}
+		}
+	};
+
+	static double SelectLinear(TArray<FLinearQuadrantSelection>& Quadrants, int32 MaxEmittersTotal, const TArray<FVector>& Positions,
+		const FVector& ReferencePosition)
+	{
+		int32 count = 0;
+
+		for (int32 e = 0; e < Positions.Num(); e++)
+		{
+			const float distanceSquared = FVector::DistSquared(Positions[e], ReferencePosition);
+			FLinearQuadrantSelection& quadrant = Quadrants[(uint8)GetQuadrant(Positions[e], ReferencePosition)];
+
+			if (count >= MaxEmittersTotal && quadrant.Emitters.Num() < quadrant.Capacity)
+			{
+				int32 farthestQuadrant = 0;
+
+				for (int32 i = 1; i < 4; i++)
+				{
+					if (Quadrants[i].MaxDistanceSquared > Quadrants[farthestQuadrant].MaxDistanceSquared) { farthestQuadrant = i; }
+				}
+
+				FLinearQuadrantSelection& farthest = Quadrants[farthestQuadrant];
+				if (distanceSquared >= farthest.MaxDistanceSquared || farthest.Emitters.IsEmpty()) { continue; }
+
+				farthest.Emitters.RemoveAtSwap(farthest.MaxDistanceIndex, 1, false);
+				farthest.UpdateMaxDistance(Positions, ReferencePosition);
+				count--;
+			}
+
+			if (quadrant.Emitters.Num() < quadrant.Capacity)
+			{
+				if (distanceSquared > quadrant.MaxDistanceSquared)
+				{
+					quadrant.MaxDistanceSquared = distanceSquared;
+					quadrant.MaxDistanceIndex = quadrant.Emitters.Num();
+				}
+
+				quadrant.Emitters.Add(e);
+				count++;
+			}
+			else if (distanceSquared < quadrant.MaxDistanceSquared)
+			{
+				quadrant.Emitters[quadrant.MaxDistanceIndex] = e;
+				quadrant.UpdateMaxDistance(Positions, ReferencePosition);
+			}
+		}
+
+		double sumDistanceSquared = 0.;
+
+		for (const FLinearQuadrantSelection& quadrant : Quadrants)
+		{
+			for (const int32 e : quadrant.Emitters)
+			{
+				sumDistanceSquared += FVector::DistSquared(Positions[e], ReferencePosition);
+			}
+		}
+
+		return sumDistanceSquared;
+	}
+
+	static double SelectHeap(FStaticSoundEmittersInRange& Selection, const TArray<FVector>& Positions, const FVector& ReferencePosition)
+	{
+		for (const FVector& location : Positions)
+		{
+			Selection.TryToAddEmitter(nullptr, FVector::DistSquared(location, ReferencePosition),
+				GetQuadrant(location, ReferencePosition));
+		}
+
+		double sumDistanceSquared = 0.;
+
+		for (const FStaticEmitterQuadrant& quadrant : Selection.m_StaticSoundEmitterQuadrants)
+		{
+			for (const FStaticEmitterCandidate& candidate : quadrant.m_Candidates)
+			{
+				sumDistanceSquared += candidate.DistanceSquared;
+			}
+		}
+
+		return sumDistanceSquared;
+	}
+
+	static void RunSelectionBenchmark(const TArray<FString>& Args)
+	{
+		const int32 numCandidates = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+		const int32 iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 100;
+		const int32 maxInstances[] = { 4, 8, 16, 32, 64 };
+		const FVector referencePosition = FVector::ZeroVector;
+
+		FRandomStream random(1337);
+		TArray<FVector> positions;
+		positions.Reserve(numCandidates);
+
+		for (int32 i = 0; i < numCandidates; i++)
+		{
+			positions.Emplace(random.FRandRange(-5000.f, 5000.f), random.FRandRange(-5000.f, 5000.f), random.FRandRange(-500.f, 500.f));
+		}
+
+		for (const int32 k : maxInstances)
+		{
+			const uint8 maxInstancesPerQuadrant = (uint8)FMath::Max(1, k / 2);
+
+			TArray<FLinearQuadrantSelection> linearQuadrants;
+			linearQuadrants.SetNum(4);
+			double linearSum = 0.;
+
+			double startTime = FPlatformTime::Seconds();
+			for (int32 i = 0; i < iterations; i++)
+			{
+				for (FLinearQuadrantSelection& quadrant : linearQuadrants)
+				{
+					quadrant.Emitters.Reset();
+					quadrant.MaxDistanceSquared = -1.f;
+					quadrant.MaxDistanceIndex = 0;
+					quadrant.Capacity = maxInstancesPerQuadrant;
+				}
+
+				linearSum = SelectLinear(linearQuadrants, k, positions, referencePosition);
+			}
+			const double linearMs = (FPlatformTime::Seconds() - startTime) * 1000. / iterations;
+
+			FStaticSoundEmittersInRange selection(maxInstancesPerQuadrant, (uint8)k);
+			double heapSum = 0.;
+
+			startTime = FPlatformTime::Seconds();
+			for (int32 i = 0; i < iterations; i++)
+			{
+				selection.Clear();
+				heapSum = SelectHeap(selection, positions, referencePosition);
+			}
+			const double heapMs = (FPlatformTime::Seconds() - startTime) * 1000. / iterations;
+
+			WR_DBG_STATIC_FUNC(Log, "K = %2i (%2i per quadrant), %i candidates : linear %.4f ms, heap %.4f ms (x%.2f), selection %s",
+				k, maxInstancesPerQuadrant, numCandidates, linearMs, heapMs, heapMs > 0. ? linearMs / heapMs : 0.,
+				FMath::IsNearlyEqual(linearSum, heapSum, FMath::Max(1., linearSum) * 1.e-5) ? TEXT("matches") : TEXT("differs"));
+		}
+	}
+
+	static FAutoConsoleCommand CCmd_StaticSoundEmitter_SelectionBenchmark(TEXT("WwiserR.StaticSoundEmitter.SelectionBenchmark"),
+		TEXT("Compares the nearest static sound emitter selection with linear rescans and with per quadrant max-heaps, for K = 4..64. ")
+		TEXT("(optional: candidates, default 10000, iterations, default 100)"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunSelectionBenchmark), ECVF_Cheat);
+
+	static void RunInstancedMemoryComparison(const TArray<FString>& Args)
+	{
+		UInstancedStaticSoundEmitterComponent::LogMemoryComparison(Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000);
+	}
+
+	static FAutoConsoleCommand CCmd_StaticSoundEmitter_InstancedMemoryComparison(
+		TEXT("WwiserR.StaticSoundEmitter.InstancedMemoryComparison"),
+		TEXT("Compares the estimated memory (sizeof based) of static sound emitters as separate components and as instances of one component. ")
+		TEXT("(optional: emitters, default 10000)"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunInstancedMemoryComparison), ECVF_Cheat);
+} // namespace Private_StaticSoundEmitterManager
+#endif
+#pragma endregion
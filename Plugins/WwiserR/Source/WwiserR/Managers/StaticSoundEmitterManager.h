@@ -6,7 +6,10 @@
 #include "UObject/NoExportTypes.h"
 #include "Math/GenericOctree.h"
 #include "EngineDefines.h"
+#include "AK/SoundEngine/Common/AkTypes.h"
 #include "DataAssets/DA_StaticSoundLoop.h"
+#include "Managers/StaticSoundEmitterGrid.h"
+#include "Managers/StaticSoundEmitterDatabase.h"
 #include "StaticSoundEmitterManager.generated.h"
 
 class UDA_StaticSoundLoop;
@@ -21,45 +24,95 @@ enum class EQuadrant : uint8
 	NorthWest
 };
 
+FORCEINLINE EQuadrant GetQuadrant(const FVector& Location, const FVector& ReferencePosition)
+{
+	return Location.Y > ReferencePosition.Y
+		? (Location.X > ReferencePosition.X ? EQuadrant::NorthEast : EQuadrant::NorthWest)
+		: (Location.X > ReferencePosition.X ? EQuadrant::SouthEast : EQuadrant::SouthWest);
+}
+
+// emitter component, or one instance of a UInstancedStaticSoundEmitterComponent
+struct FStaticSoundEmitterInstance
+{
+	UStaticSoundEmitterComponent* Emitter{};
+	int32 InstanceIndex = INDEX_NONE;		// INDEX_NONE for non instanced emitters
+
+	FStaticSoundEmitterInstance() {}
+	FStaticSoundEmitterInstance(UStaticSoundEmitterComponent* a_Emitter, int32 a_InstanceIndex = INDEX_NONE)
+		: Emitter(a_Emitter)
+		, InstanceIndex(a_InstanceIndex)
+	{}
+
+	bool operator==(const FStaticSoundEmitterInstance& Other) const
+	{
+		return Emitter == Other.Emitter && InstanceIndex == Other.InstanceIndex;
+	}
+
+	FTransform GetTransform() const;
+	uint32& GetSelectionStamp() const;
+	void StartPlayAudio(UDA_StaticSoundLoop* StaticSoundLoop) const;
+	void StopPlayAudio(UDA_StaticSoundLoop* StaticSoundLoop) const;
+};
+
+FORCEINLINE uint32 GetTypeHash(const FStaticSoundEmitterInstance& Instance)
+{
+	return HashCombineFast(GetTypeHash(Instance.Emitter), GetTypeHash(Instance.InstanceIndex));
+}
+
+// emitter selected in a quadrant, with its cached squared distance to the reference position
+struct FStaticEmitterCandidate
+{
+	UStaticSoundEmitterComponent* Emitter{};
+	float DistanceSquared = 0.f;
+	int32 InstanceIndex = INDEX_NONE;
+
+	FStaticEmitterCandidate() {}
+	FStaticEmitterCandidate(UStaticSoundEmitterComponent* a_Emitter, float a_DistanceSquared, int32 a_InstanceIndex)
+		: Emitter(a_Emitter)
+		, DistanceSquared(a_DistanceSquared)
+		, InstanceIndex(a_InstanceIndex)
+	{}
+
+	FORCEINLINE FStaticSoundEmitterInstance GetInstance() const { return FStaticSoundEmitterInstance(Emitter, InstanceIndex); }
+};
+
+// max-heap predicate, the farthest candidate is at the top
+struct FStaticEmitterCandidateFarthestFirst
+{
+	FORCEINLINE bool operator()(const FStaticEmitterCandidate& A, const FStaticEmitterCandidate& B) const
+	{
+		return A.DistanceSquared > B.DistanceSquared;
+	}
+};
+
 USTRUCT()
 struct FStaticEmitterQuadrant
 {
 	GENERATED_BODY()
 
 public:
-	TArray<UStaticSoundEmitterComponent*> m_Emitters;
-
-	float m_MaxDistanceSquared = -1.f;
-	uint8 m_MaxDistanceIndex = 0;
-	uint8 m_Count = 0;
+	TArray<FStaticEmitterCandidate> m_Candidates;	// max-heap on distance
+	uint8 m_Capacity = 0;
 
 public:
-	FStaticEmitterQuadrant(
-		TArray<UStaticSoundEmitterComponent*> a_Emitters, float a_MaxDistanceSquared, uint8 a_MaxDistanceIndex, uint8 a_Count)
-		: m_Emitters(a_Emitters)
-		, m_MaxDistanceSquared(a_MaxDistanceSquared)
-		, m_MaxDistanceIndex(a_MaxDistanceIndex)
-		, m_Count(a_Count)
-	{}
 	explicit FStaticEmitterQuadrant(uint8 a_EmittersPerQuadrant)
-		: m_MaxDistanceSquared(-1.f)
-		, m_MaxDistanceIndex(0)
-		, m_Count(0)
+		: m_Capacity(a_EmittersPerQuadrant)
 	{
-		m_Emitters.Init(nullptr, a_EmittersPerQuadrant);
+		m_Candidates.Reserve(a_EmittersPerQuadrant);
 	}
-	FStaticEmitterQuadrant()
-		: m_Emitters(TArray<UStaticSoundEmitterComponent*>())
-		, m_MaxDistanceSquared(-1.f)
-		, m_MaxDistanceIndex(0)
-		, m_Count(0)
-	{}
+	FStaticEmitterQuadrant() {}
 
 public:
-	bool TryToAddEmitter(UStaticSoundEmitterComponent* a_StaticSoundEmitterComponent,
-		const FVector a_StableListenerPosition,	const float a_DistanceToListenerSquared, bool& bCountIncreased);
-	bool RemoveFarthestEmitter(FVector StableListenerPosition);
-	void FindAndUpdateQuadrantMaxDistance(FVector StableListenerPosition);
+	FORCEINLINE bool IsFull() const { return m_Candidates.Num() >= m_Capacity; }
+	FORCEINLINE int32 Num() const { return m_Candidates.Num(); }
+	FORCEINLINE float GetMaxDistanceSquared() const { return m_Candidates.IsEmpty() ? -1.f : m_Candidates.HeapTop().DistanceSquared; }
+
+	/** adds the emitter if the quadrant isn't full, or replaces the farthest emitter if it is closer. O(log K) */
+	bool TryToAddEmitter(UStaticSoundEmitterComponent* a_StaticSoundEmitterComponent, const int32 a_InstanceIndex,
+		const float a_DistanceToListenerSquared, bool& bCountIncreased);
+	bool RemoveFarthestEmitter();
+	/** removes all candidates of the component (all its instances), returns the number removed */
+	int32 RemoveEmitter(const UStaticSoundEmitterComponent* StaticSoundEmitterComponent);
 };
 
 USTRUCT()
@@ -75,12 +128,18 @@ public:
 	UPROPERTY()
 	TArray<FStaticEmitterQuadrant> m_StaticSoundEmitterQuadrants;
 
+	uint8 m_MaxEmittersPerQuadrant {};	// as set by the user, to detect changes
 	uint8 m_MaxEmittersTotal {};
 	uint8 m_Count {};
 
+	FVector m_ReferencePosition {};		// reference position the selection was made from
+	bool m_IsValid = false;				// false until selected, or after emitters of its loop were added or removed
+	bool m_IsReselected = false;		// selected again this tick, the playing emitters need to be updated
+
 public:
 	FStaticSoundEmittersInRange(uint8 a_MaxEmittersPerQuadrant, uint8 a_MaxEmittersTotal)
-		: m_MaxEmittersTotal(a_MaxEmittersTotal > 0 ? a_MaxEmittersTotal : s_maxEmittersTotalIfNotDefinedByUser)
+		: m_MaxEmittersPerQuadrant(a_MaxEmittersPerQuadrant)
+		, m_MaxEmittersTotal(a_MaxEmittersTotal > 0 ? a_MaxEmittersTotal : s_maxEmittersTotalIfNotDefinedByUser)
 		, m_Count(0)
 	{
 		m_StaticSoundEmitterQuadrants.Init(FStaticEmitterQuadrant(a_MaxEmittersPerQuadrant > 0 ?
@@ -95,18 +154,34 @@ public:
 		m_StaticSoundEmitterQuadrants.Init(FStaticEmitterQuadrant(), 4);
 	}
 
+	/** keeps the nearest emitters within the per quadrant and total limits, the squared distance is computed from cached positions */
 	bool TryToAddEmitter(UStaticSoundEmitterComponent* StaticSoundEmitterComponent,
-		const FVector a_StableListenerPosition, const float a_DistanceToListenerSquared, const EQuadrant a_Quadrant);
+		const float a_DistanceToListenerSquared, const EQuadrant a_Quadrant, const int32 a_InstanceIndex = INDEX_NONE);
+
+	FORCEINLINE bool HasLimits(uint8 a_MaxEmittersPerQuadrant, uint8 a_MaxEmittersTotal) const
+	{
+		return m_MaxEmittersPerQuadrant == a_MaxEmittersPerQuadrant
+			&& m_MaxEmittersTotal == (a_MaxEmittersTotal > 0 ? a_MaxEmittersTotal : s_maxEmittersTotalIfNotDefinedByUser);
+	}
+
+	FORCEINLINE SIZE_T GetAllocatedSize() const
+	{
+		SIZE_T allocatedSize = m_StaticSoundEmitterQuadrants.GetAllocatedSize();
+
+		for (const FStaticEmitterQuadrant& quadrant : m_StaticSoundEmitterQuadrants)
+		{
+			allocatedSize += quadrant.m_Candidates.GetAllocatedSize();
+		}
+
+		return allocatedSize;
+	}
 
-	// clears all counters, "resetting" all counters, without reallocating memory or clearing elements
+	// clears all counters, without reallocating memory
 	FORCEINLINE void Clear()
 	{
 		for (FStaticEmitterQuadrant& quadrant : m_StaticSoundEmitterQuadrants)
 		{
-			quadrant.m_Emitters.Init(nullptr, quadrant.m_Emitters.Num());
-			quadrant.m_MaxDistanceSquared = -1.f;
-			quadrant.m_MaxDistanceIndex = 0;
-			quadrant.m_Count = 0;
+			quadrant.m_Candidates.Reset();
 		}
 
 		m_Count = 0;
@@ -115,10 +190,15 @@ public:
 
 struct FStaticSoundEmitterOctreeElement
 {
-	UStaticSoundEmitterComponent* StaticSoundEmitterComponent{};
+	UStaticSoundEmitterComponent* StaticSoundEmitterComponent{};	// nullptr while a baked emitter's component isn't attached
 	FBoxCenterAndExtent BoundingBox{};
+	FVector Location{};	// static emitters don't move, cached to avoid touching the component when selecting emitters
+	uint64 BakedKey = 0;	// baked emitters only
+	int32 InstanceIndex = INDEX_NONE;
 
-	explicit FStaticSoundEmitterOctreeElement(UStaticSoundEmitterComponent* a_StaticSoundEmitterComponent);
+	explicit FStaticSoundEmitterOctreeElement(UStaticSoundEmitterComponent* a_StaticSoundEmitterComponent,
+		int32 a_InstanceIndex = INDEX_NONE);
+	FStaticSoundEmitterOctreeElement(const FVector& a_Location, uint64 a_BakedKey);
 };
 
 struct FStaticSoundEmitterOctreeSemantics
@@ -135,7 +215,8 @@ struct FStaticSoundEmitterOctreeSemantics
 
 	FORCEINLINE static bool AreElementsEqual(const FStaticSoundEmitterOctreeElement& A, const FStaticSoundEmitterOctreeElement& B)
 	{
-		return (A.StaticSoundEmitterComponent == B.StaticSoundEmitterComponent);
+		return A.StaticSoundEmitterComponent == B.StaticSoundEmitterComponent && A.BakedKey == B.BakedKey
+			&& A.InstanceIndex == B.InstanceIndex;
 	}
 
 	static void SetElementId(FOctree& OctreeOwner, const FStaticSoundEmitterOctreeElement& Element, FOctreeElementId2 Id);
@@ -144,7 +225,8 @@ struct FStaticSoundEmitterOctreeSemantics
 class TStaticSoundEmitterOctree : public TOctree2<FStaticSoundEmitterOctreeElement, FStaticSoundEmitterOctreeSemantics>
 {
 public:
-	TMap<uint32, FOctreeElementId2> ObjectToOctreeId{};
+	TMap<uint64, FOctreeElementId2> ObjectToOctreeId{};	// emitter unique ID and instance index, see GetEmitterKey()
+	TMap<uint64, FOctreeElementId2> BakedToOctreeId{};	// baked emitters without attached component
 	uint8 RangeIndex = 0;
 	uint32 NumElements = 0;
 
@@ -157,7 +239,107 @@ public:
 	{}
 
 	void AddEmitter(UStaticSoundEmitterComponent* StaticSoundEmitterComponent);
+	void AddEmitters(TConstArrayView<UStaticSoundEmitterComponent*> StaticSoundEmitterComponents);
 	void RemoveEmitter(UStaticSoundEmitterComponent* StaticSoundEmitterComponent);
+
+	/** baked emitters are added without component and skipped when selecting until their component attaches */
+	void AddBakedEmitter(const FVector& Location, uint64 BakedKey);
+	bool AttachEmitter(uint64 BakedKey, UStaticSoundEmitterComponent* StaticSoundEmitterComponent);
+	bool RemoveBakedEmitter(uint64 BakedKey);
+
+	static uint64 GetEmitterKey(const UStaticSoundEmitterComponent* StaticSoundEmitterComponent, int32 InstanceIndex);
+
+protected:
+	void RemoveElementOfEmitter(uint64 EmitterKey);
+};
+
+// queued add or remove of a static sound loop on an emitter
+struct FStaticSoundEmitterRegistration
+{
+	UStaticSoundEmitterComponent* StaticSoundEmitterComponent{};
+	UDA_StaticSoundLoop* StaticSoundLoop{};
+
+	FStaticSoundEmitterRegistration() {}
+	FStaticSoundEmitterRegistration(UStaticSoundEmitterComponent* a_StaticSoundEmitterComponent, UDA_StaticSoundLoop* a_StaticSoundLoop)
+		: StaticSoundEmitterComponent(a_StaticSoundEmitterComponent)
+		, StaticSoundLoop(a_StaticSoundLoop)
+	{}
+
+	bool operator==(const FStaticSoundEmitterRegistration& Other) const
+	{
+		return StaticSoundEmitterComponent == Other.StaticSoundEmitterComponent && StaticSoundLoop == Other.StaticSoundLoop;
+	}
+};
+
+FORCEINLINE uint32 GetTypeHash(const FStaticSoundEmitterRegistration& Registration)
+{
+	return HashCombineFast(GetTypeHash(Registration.StaticSoundEmitterComponent), GetTypeHash(Registration.StaticSoundLoop));
+}
+
+// loop whose selection is updated this tick, gathered for parallel access
+struct FStaticLoopToSelect
+{
+	UDA_StaticSoundLoop* StaticSoundLoop{};
+	const TStaticSoundEmitterOctree* Octree{};
+	FStaticSoundEmittersInRange* Selection{};
+	float CostMs = 0.f;		// measured query time, for adaptive scheduling
+
+	FStaticLoopToSelect() {}
+	FStaticLoopToSelect(UDA_StaticSoundLoop* a_StaticSoundLoop, const TStaticSoundEmitterOctree* a_Octree)
+		: StaticSoundLoop(a_StaticSoundLoop)
+		, Octree(a_Octree)
+	{}
+};
+
+// adaptive scheduling state of a static sound loop
+struct FStaticLoopSchedule
+{
+	double NextUpdateTime = 0.0;
+	float AverageCostMs = 0.f;			// moving average of the measured query time
+	uint64 ScheduledFrame = MAX_uint64;	// frame the loop was last scheduled to update in
+};
+
+// static sound loop that is due for an update, gathered for scheduling
+struct FStaticLoopDue
+{
+	UDA_StaticSoundLoop* StaticSoundLoop{};
+	double NextUpdateTime = 0.0;
+	uint8 RangeIndex = 0;
+
+	FStaticLoopDue() {}
+	FStaticLoopDue(UDA_StaticSoundLoop* a_StaticSoundLoop, double a_NextUpdateTime, uint8 a_RangeIndex)
+		: StaticSoundLoop(a_StaticSoundLoop)
+		, NextUpdateTime(a_NextUpdateTime)
+		, RangeIndex(a_RangeIndex)
+	{}
+};
+
+// game object playing a loop at the positions of all its selected emitters
+struct FStaticLoopMultiPositionEmitter
+{
+	AkGameObjectID GameObjectID = AK_INVALID_GAME_OBJECT;	// address of this struct, kept alive until unregistered
+	AkPlayingID PlayingID = AK_INVALID_PLAYING_ID;
+	TArray<AkSoundPosition> Positions{};					// persistent scratch buffer
+	uint32 NumVoicesSaved = 0;
+	TWeakObjectPtr<const class UAkRoomComponent> Room{};	// spatial audio room at the emitter closest to the distance probe
+};
+
+// bare game object (no AkComponent) waiting for the fade out of its last loop before it is unregistered
+struct FStaticGameObjectUnregistration
+{
+	AkGameObjectID GameObjectID = AK_INVALID_GAME_OBJECT;
+	TSharedPtr<const void> Owner{};							// keeps the game object ID (address) in use until unregistered
+	double UnregisterTime = 0.0;
+};
+
+// registered UStaticSoundEmitterDatabase of a level in the world
+struct FBakedStaticSoundEmitters
+{
+	const UStaticSoundEmitterDatabase* Database = nullptr;	// nullptr if the level has no (usable) database
+	uint16 Serial = 0;										// distinguishes the baked keys of levels
+	FTransform LevelTransform{};
+	TArray<int8> LoopRangeIndices{};						// per database loop, INDEX_NONE if the loop can't be posted
+	TBitArray<> IsAttached{};								// per record
 };
 
 /**
@@ -165,8 +347,25 @@ public:
  * ------------------------------
  *
  * - stores StaticSoundEmitters within its world in 3 octrees, depending on their range (close, medium, far)
+ * - alternatively stores the StaticSoundEmitters of all loops in one shared grid per range, selectable per world
+ *   (StaticSoundEmitterSpatialIndex)
  * - selects the StaticSoundEmitters and events that need to play
- * - handles starting and stopping audio playback
+ * - keeps the nearest emitters of each loop in per quadrant max-heaps, using emitter positions cached in the octree elements
+ * - keeps a loop's selection until its reference position moved by ReselectionDistanceFraction of its activation range, its emitters
+ *   changed or its instance limits changed (stat WwiserR)
+ * - builds its index from the baked UStaticSoundEmitterDatabase of a level in one pass, components attach to their baked slot by
+ *   stable ID when they post their loops
+ * - queues the registration of emitters and applies it in batches before ticking, grouped per loop so each octree or grid is
+ *   filled once. Batches are spread over frames within a time budget, queued removals are applied before garbage collection
+ * - updates one distance range per frame, or with adaptive scheduling the loops that are due within a per frame time budget.
+ *   A loop's update period is the time the listener needs to move ReselectionDistanceFraction of its activation range, its
+ *   measured query time decides how many loops fit in a frame
+ * - plays loops with bUseMultiplePositions on one game object per loop, positioned at all its selected emitters. The game object
+ *   takes the room and world listener sends of the emitter closest to the distance probe, emitter game syncs are not applied
+ * - indexes each instance of a UInstancedStaticSoundEmitterComponent as a separate emitter, selected and played per instance
+ * - handles starting and stopping audio playback, diffing selections in place with frame stamped emitters (no allocations
+ *   in steady state, see the Static Loops Allocations stat with WwiserR.StaticSoundEmitter.CountAllocations, LLM tag
+ *   WwiserR_StaticSoundEmitters)
  */
 #if !UE_BUILD_SHIPPING
 DECLARE_MULTICAST_DELEGATE(FOnDebugViewportStatsChanged);
@@ -193,10 +392,41 @@ private:
 	uint8 m_numDistanceRanges = 1;
 
 	TArray<TMap<UDA_StaticSoundLoop*, FStaticSoundEmittersInRange>> m_loopsToPlayPerRange{};
-	TArray<TMap<UDA_StaticSoundLoop*, TSet<UStaticSoundEmitterComponent*>>> m_playingEventsPerRange{};
+	TArray<TMap<UDA_StaticSoundLoop*, TSet<FStaticSoundEmitterInstance>>> m_playingEventsPerRange{};
 	//FCriticalSection CriticalSection;
 
+	bool m_useSharedGrid = false;
+	TArray<TUniquePtr<FStaticSoundEmitterGrid>> m_grids{};		// per range, replaces m_postedLoops when using the shared grid
+	TArray<FStaticSoundEmitterGridQuery> m_gridQueries{};		// persistent scratch buffer, per loop index
+	TArray<FStaticLoopToSelect> m_octreeLoopsToSelect{};		// persistent scratch buffer
+	uint32 m_selectionStamp = 0;								// marks the emitters of the selection being diffed
+
+	bool m_adaptiveScheduling = false;
+	float m_schedulingBudgetMs = 0.5f;
+	float m_minUpdatePeriod = 0.f;
+	float m_maxUpdatePeriod = 1.f;
+	FVector m_lastListenerPosition{};
+	bool m_hasLastListenerPosition = false;						// the first tick only seeds the last position
+	float m_listenerSpeed = 0.f;								// smoothed, in units per second
+	TMap<UDA_StaticSoundLoop*, FStaticLoopSchedule> m_loopSchedules{};
+	TArray<FStaticLoopDue> m_dueLoops{};						// persistent scratch buffer
+	TArray<bool> m_isRangeScheduled{};
+
+	bool m_useBakedEmitters = true;
+	TMap<const ULevel*, FBakedStaticSoundEmitters> m_bakedLevels{};
+	uint16 m_nextBakedSerial = 0;
+
+	bool m_batchRegistration = true;
+	float m_registrationBudgetMs = 1.f;
+	TMap<FStaticSoundEmitterRegistration, bool> m_pendingRegistrations{};	// true = add, false = remove
+	TArray<FStaticSoundEmitterRegistration> m_registrationBatch{};			// persistent scratch buffer
+	TArray<UStaticSoundEmitterComponent*> m_emittersToAdd{};				// persistent scratch buffer
+
+	TMap<UDA_StaticSoundLoop*, TSharedPtr<FStaticLoopMultiPositionEmitter>> m_multiPositionEmitters{};
+	TArray<FStaticGameObjectUnregistration> m_pendingUnregistrations{};
+
 #if !UE_BUILD_SHIPPING
+	TSet<UDA_StaticSoundLoop*> m_dbgMultiPositionLoopsWithGameSyncs{};	// so we can log warnings only once per loop
 	TArray<uint32> m_dbgNumLoops{};		// posted loops per range
 	TArray<uint32> m_dbgNumPosted{};	// posted emitters per range
 	TArray<uint32> m_dbgNumPlaying{};	// playing emitters per range
@@ -210,19 +440,63 @@ public:
 #endif
 
 protected:
+	void UpdateRange(const FVector& ListenerPosition);
+	void ScheduleLoops(const FVector& ListenerPosition, const float DeltaTime);
+	float GetUpdatePeriod(const UDA_StaticSoundLoop* StaticSoundLoop) const;
+	void RecordQueryCost(const UDA_StaticSoundLoop* StaticSoundLoop, const float CostMs);
+
+	FORCEINLINE bool IsScheduled(const UDA_StaticSoundLoop* StaticSoundLoop) const
+	{
+		if (!m_adaptiveScheduling) { return true; }
+
+		const FStaticLoopSchedule* schedule = m_loopSchedules.Find(StaticSoundLoop);
+		return schedule != nullptr && schedule->ScheduledFrame == GFrameCounter;
+	}
+
+	void SelectEmittersFromOctrees(const FVector& ListenerPosition);
+	void SelectEmittersFromGrid(const FVector& ListenerPosition);
+	FStaticSoundEmittersInRange& ResetSelection(UDA_StaticSoundLoop* StaticSoundLoop, const FVector& ReferencePosition);
 	void PlayAndStopAudioEvents(const uint8 a_distanceIndex);
-	float GetActivationRange(const UDA_StaticSoundLoop* StaticSoundLoop) const;
+	void PlayMultiPositionLoop(UDA_StaticSoundLoop* StaticSoundLoop, const TSet<FStaticSoundEmitterInstance>& PlayingEmitters);
+	void StopMultiPositionLoop(UDA_StaticSoundLoop* StaticSoundLoop, const bool bWaitForFadeOut = true);
+	void UnregisterPendingGameObjects(const bool bFlush);
+	bool ShouldUseSharedGrid() const;
+
+#if STATS
+	/** memory owned by the selection and playback containers of a distance range, steady state ticks should not grow it */
+	SIZE_T GetAllocatedSize(const uint8 a_distanceIndex) const;
+#endif
+
+	bool ShouldReselect(const UDA_StaticSoundLoop* StaticSoundLoop, const FStaticSoundEmittersInRange& Selection,
+		const FVector& ReferencePosition, const float ActivationRange) const;
+
+	FORCEINLINE FVector GetReferencePosition(const UDA_StaticSoundLoop* StaticSoundLoop, const FVector& ListenerPosition) const
+	{
+		return StaticSoundLoop->ReferencePositionLerp * m_stableDistanceProbePosition +
+			(1.f - StaticSoundLoop->ReferencePositionLerp) * ListenerPosition;
+	}
 
 	FORCEINLINE uint8 GetDistanceRangeIndex(const float Distance) const
 	{
-		if (!m_spreadOverMultipleFrames) { return 0; }
+		return m_spreadOverMultipleFrames ? GetDistanceRangeIndex(m_rangeTresholds, Distance) : 0;
+	}
 
-		for (int i = 0; i < m_numDistanceRanges - 1; i++)
-		{
-			if (Distance < m_rangeTresholds[i]) { return i; }
-		}
+	float GetOrAddPostedLoopRange(UDA_StaticSoundLoop* StaticSoundLoop);
+	TStaticSoundEmitterOctree& GetOrAddOctree(UDA_StaticSoundLoop* StaticSoundLoop, const uint8 a_distanceIndex);
 
-		return m_numDistanceRanges - 1;
+	FBakedStaticSoundEmitters& RegisterBakedLevel(ULevel* Level);
+	void OnLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+	bool TryToAttachBakedEmitter(UStaticSoundEmitterComponent* StaticSoundEmitterComponent, UDA_StaticSoundLoop* StaticSoundLoop);
+	void InvalidateLoop(UDA_StaticSoundLoop* StaticSoundLoop, const uint8 a_distanceIndex);
+
+	void ApplyPendingRegistrations(const bool bRemovalsOnly);
+	void OnPreGarbageCollect();
+	void AddEmitters(UDA_StaticSoundLoop* StaticSoundLoop, TConstArrayView<FStaticSoundEmitterRegistration> Registrations);
+	void RemoveEmitter(UStaticSoundEmitterComponent* StaticSoundEmitterComponent, UDA_StaticSoundLoop* StaticSoundLoop);
+
+	FORCEINLINE static uint64 GetBakedKey(uint16 Serial, const FStaticSoundEmitterRecord& Record)
+	{
+		return ((uint64)Serial << 48) | ((uint64)Record.StableID << 16) | Record.LoopIndex;
 	}
 
 public:
@@ -237,6 +511,19 @@ public:
 	void PostLoop(UStaticSoundEmitterComponent* StaticSoundEmitterComponent, UDA_StaticSoundLoop* StaticSoundLoop);
 	void StopLoop(UStaticSoundEmitterComponent* StaticSoundEmitterComponent, UDA_StaticSoundLoop* StaticSoundLoop);
 
+	/** unregisters a bare game object once the fade out of its last loop ended. Pending game objects are unregistered when the
+	world manager is deinitialized */
+	void UnregisterStaticGameObject(AkGameObjectID GameObjectID, TSharedPtr<const void> Owner, int32 FadeOutTimeInMs);
+
+	/** puts a bare game object in the spatial audio room and world listener sends at Location, returns the room (nullptr if outdoors) */
+	static const class UAkRoomComponent* PlaceStaticGameObject(AkGameObjectID GameObjectID, const FVector& Location, UWorld* World,
+		const UAkRoomComponent* CurrentRoom = nullptr);
+
+	/** distance range tresholds from the game settings, sorted and without duplicate or <= 0.f values. Empty if not spread */
+	static TArray<float> GetRangeTresholds();
+	static uint8 GetDistanceRangeIndex(const TArray<float>& RangeTresholds, const float Distance);
+	static float GetActivationRange(const UDA_StaticSoundLoop* StaticSoundLoop);
+
 #if !UE_BUILD_SHIPPING
 protected:
 	void Debug();
@@ -287,6 +574,12 @@ public:
 	void PostLoop(UWorld* World, UStaticSoundEmitterComponent* StaticSoundEmitterComponent, UDA_StaticSoundLoop* StaticSoundLoop);
 	void StopLoop(UWorld* World, UStaticSoundEmitterComponent* StaticSoundEmitterComponent, UDA_StaticSoundLoop* StaticSoundLoop);
 
+	FORCEINLINE AStaticSoundEmitterWorldManager* GetWorldManager(UWorld* World) const
+	{
+		AStaticSoundEmitterWorldManager* const* worldManager = m_worldManagers.Find(World);
+		return worldManager != nullptr ? *worldManager : nullptr;
+	}
+
 protected:
 	void OnPostWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
 };
@@ -2,11 +2,36 @@
 
 #include "WwiserR.h"
 
+#if WITH_EDITOR
+#include "Managers/StaticSoundEmitterDatabase.h"
+#include "Managers/AmbientWeightField.h"
+#include "Engine/World.h"
+#include "UObject/ObjectSaveContext.h"
+#endif
+
 #define LOCTEXT_NAMESPACE "FWwiserRModule"
 
+#if WITH_EDITOR
+namespace Private_WwiserRModule
+{
+	// bake the static sound emitters and ambient bed weights into the level when it's saved or cooked
+	static void OnObjectPreSave(UObject* Object, FObjectPreSaveContext SaveContext)
+	{
+		UWorld* world = Cast<UWorld>(Object);
+		if (world == nullptr || world->IsGameWorld() || world->PersistentLevel == nullptr) { return; }
+
+		UStaticSoundEmitterDatabase::BakeLevel(world->PersistentLevel);
+		UAmbientWeightFieldDatabase::BakeLevel(world->PersistentLevel);
+	}
+} // namespace Private_WwiserRModule
+#endif
+
 void FWwiserRModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+#if WITH_EDITOR
+	m_onObjectPreSaveHandle = FCoreUObjectDelegates::OnObjectPreSave.AddStatic(&Private_WwiserRModule::OnObjectPreSave);
+#endif
 
 }
 
@@ -14,6 +39,9 @@ void FWwiserRModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPreSave.Remove(m_onObjectPreSaveHandle);
+#endif
 }
 
 #undef LOCTEXT_NAMESPACE
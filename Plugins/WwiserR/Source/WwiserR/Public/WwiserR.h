@@ -12,4 +12,9 @@ public:
 	/** IModuleInterface implementation */
 	void StartupModule() override;
 	void ShutdownModule() override;
+
+#if WITH_EDITOR
+private:
+	FDelegateHandle m_onObjectPreSaveHandle{};
+#endif
 };
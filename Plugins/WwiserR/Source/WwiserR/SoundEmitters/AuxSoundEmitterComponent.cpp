@@ -406,16 +406,16 @@ void UAuxSoundEmitterComponent::UpdateListenerConnections()
 	}
 }
 
-TSet<TWeakObjectPtr<UWorldSoundListener>> UAuxSoundEmitterComponent::GetWorldListeners()
+const TSet<TWeakObjectPtr<UWorldSoundListener>>& UAuxSoundEmitterComponent::GetWorldListeners()
 {
-	TSet<TWeakObjectPtr<UWorldSoundListener>> worldListeners = s_listenerManager->GetWorldListeners();
+	/*TSet<TWeakObjectPtr<UWorldSoundListener>> worldListeners = s_listenerManager->GetWorldListeners();
 
-	/*for (TPair<UAkAuxBus*, FAuxBusConfig> auxBus : m_auxBusses)
+	for (TPair<UAkAuxBus*, FAuxBusConfig> auxBus : m_auxBusses)
 	{
 		worldListeners.Remove(auxBus.Value.WorldSoundListener);
 	}*/
 
-	return worldListeners;
+	return s_listenerManager->GetWorldListeners();
 }
 
 #if !UE_BUILD_SHIPPING
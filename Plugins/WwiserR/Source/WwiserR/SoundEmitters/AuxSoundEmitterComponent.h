@@ -67,9 +67,13 @@ public:
 protected:
 	UFUNCTION()	void UpdateListenerConnections();
 	void InitializeAkComponent() override;
+	// world listeners connect to the AkComponent of aux emitters
+	FORCEINLINE bool CanUseLightweightGameObject() const override { return false; }
 
 	// invalidate any of the listeners that are feeding this aux bus, to prevent feedback loops
-	TSet<TWeakObjectPtr<UWorldSoundListener>> GetWorldListeners() override;
+	const TSet<TWeakObjectPtr<UWorldSoundListener>>& GetWorldListeners() override;
+	// listener filtering is emitter specific, so aux emitters are never culled by the shared batch
+	FORCEINLINE bool AddLoopsToCullingBatch(FCullingLoopBatch& LoopBatch, TArray<int32>& LoopIndices) override { return false; }
 
 	UFUNCTION() void CullAuxBus();
 	void RecullAllLoops() override;
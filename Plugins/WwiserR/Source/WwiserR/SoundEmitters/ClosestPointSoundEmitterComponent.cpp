@@ -0,0 +1,258 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#include "ClosestPointSoundEmitterComponent.h"
+#include "Managers/SoundListenerManager.h"
+#include "Components/SplineComponent.h"
+#include "Components/BoxComponent.h"
+#include "AkAudioDevice.h"
+#include "Core/AudioUtils.h"
+
+#if !UE_BUILD_SHIPPING
+#include "DrawDebugHelpers.h"
+#endif
+
+UClosestPointSoundEmitterComponent::UClosestPointSoundEmitterComponent()
+{
+	// the distance to the closest point changes at most at the speed of the distance probe
+	bCanMove = false;
+	bAutoEmitterMaxSpeed = false;
+	ManualEmitterMaxSpeed = 0.f;
+	bUseParentLocationForCulling = false;
+}
+
+void UClosestPointSoundEmitterComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	UPrimitiveComponent* sourceComponent = Cast<UPrimitiveComponent>(SourceComponent.GetComponent(GetOwner()));
+
+	if (!IsValid(sourceComponent) && IsValid(GetOwner()))
+	{
+		sourceComponent = GetOwner()->FindComponentByClass<USplineComponent>();
+
+		if (!IsValid(sourceComponent))
+		{
+			sourceComponent = GetOwner()->FindComponentByClass<UBoxComponent>();
+		}
+	}
+
+	if (!IsValid(sourceComponent))
+	{
+		WR_DBG_FUNC(Warning, "no source component found, the emitter won't follow any closest point");
+		return;
+	}
+
+	SetSourceComponent(sourceComponent);
+}
+
+void UClosestPointSoundEmitterComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	m_sourceComponent = nullptr;
+	m_segmentBVH.Reset();
+	m_closestSegments.Reset();
+	m_bHasClosestPoint = false;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UClosestPointSoundEmitterComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (HasActiveEvents())
+	{
+		UpdateClosestPoint();
+	}
+	else
+	{
+		TryToStopTicking();
+	}
+}
+
+void UClosestPointSoundEmitterComponent::SetSourceComponent(UPrimitiveComponent* NewSourceComponent)
+{
+	m_sourceComponent = NewSourceComponent;
+	RebuildSegments();
+
+	if (HasActiveEvents())
+	{
+		UpdateClosestPoint(true);
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UClosestPointSoundEmitterComponent::RebuildSegments()
+{
+	m_segmentBVH.Reset();
+	m_bHasClosestPoint = false;
+
+	if (!IsValid(m_sourceComponent)) { return; }
+	m_builtSourceTransform = m_sourceComponent->GetComponentTransform();
+
+	const USplineComponent* spline = Cast<USplineComponent>(m_sourceComponent);
+	if (!IsValid(spline)) { return; }
+
+	// the last sample of a closed loop coincides with the first one
+	const bool bClosedLoop = spline->IsClosedLoop();
+	const float splineLength = spline->GetSplineLength();
+	const int32 numSegments = FMath::Max(1, FMath::CeilToInt(splineLength / FMath::Max(SplineSegmentLength, 10.f)));
+
+	TArray<FVector> points;
+	points.Reserve(numSegments + 1);
+
+	for (int32 i = 0; i < (bClosedLoop ? numSegments : numSegments + 1); i++)
+	{
+		points.Add(spline->GetLocationAtDistanceAlongSpline(splineLength * i / numSegments, ESplineCoordinateSpace::World));
+	}
+
+	m_segmentBVH.Build(points, bClosedLoop);
+}
+
+int32 UClosestPointSoundEmitterComponent::PostLoop(UAkAudioEvent* LoopAkEvent, float ActivationRangeBuffer, bool bQueryAndPostEnvironmentSwitches)
+{
+	// activation is checked against the closest point
+	UpdateClosestPoint(true);
+
+	const int32 playingID = Super::PostLoop(LoopAkEvent, ActivationRangeBuffer, bQueryAndPostEnvironmentSwitches);
+
+	if (IsValid(m_sourceComponent))
+	{
+		SetComponentTickEnabled(true);
+	}
+
+	return playingID;
+}
+
+bool UClosestPointSoundEmitterComponent::TryToStopTicking()
+{
+	if (IsValid(m_sourceComponent) && HasActiveEvents()) { return false; }
+
+	return Super::TryToStopTicking();
+}
+
+void UClosestPointSoundEmitterComponent::UpdateClosestPoint(bool bForceUpdate)
+{
+	if (!IsValid(m_sourceComponent) || !IsValid(GetListenerManager())) { return; }
+
+	// moved sources are resampled
+	if (!m_sourceComponent->GetComponentTransform().Equals(m_builtSourceTransform))
+	{
+		RebuildSegments();
+		bForceUpdate = true;
+	}
+
+	const FVector probePosition = GetListenerManager()->GetDistanceProbePosition();
+
+	if (!bForceUpdate && m_bHasClosestPoint
+		&& FVector::DistSquared(probePosition, m_lastProbePosition) < FMath::Square(MinProbeMovement))
+	{
+		// a game object registered since the last update only received the single position
+		if (NumClosestPoints > 1 && HasGameObject() && GetAkGameObjectID() != m_multiPositionGameObjectID)
+		{
+			SetMultiplePositions();
+		}
+
+		return;
+	}
+
+	FVector closestPoint;
+	if (!FindClosestPoint(probePosition, closestPoint)) { return; }
+
+	m_lastProbePosition = probePosition;
+	m_bHasClosestPoint = true;
+
+	SetWorldLocation(closestPoint);
+
+	if (NumClosestPoints > 1 && HasGameObject())
+	{
+		SetMultiplePositions();
+	}
+}
+
+bool UClosestPointSoundEmitterComponent::FindClosestPoint(const FVector& ProbePosition, FVector& OutClosestPoint)
+{
+	if (!m_segmentBVH.IsEmpty())
+	{
+		if (m_segmentBVH.FindClosestSegments(ProbePosition, FMath::Clamp(NumClosestPoints, 1, 8), m_closestSegments) == 0) { return false; }
+
+		OutClosestPoint = m_closestSegments[0].Point;
+		return true;
+	}
+
+	m_closestSegments.Reset();
+
+	if (const UBoxComponent* box = Cast<UBoxComponent>(m_sourceComponent))
+	{
+		const FTransform& boxTransform = box->GetComponentTransform();
+		const FVector extent = box->GetUnscaledBoxExtent();
+
+		OutClosestPoint = boxTransform.TransformPosition(
+			boxTransform.InverseTransformPosition(ProbePosition).BoundToBox(-extent, extent));
+		return true;
+	}
+
+	// convex and other collision shapes, inside the volume the distance is zero
+	const float distance = m_sourceComponent->GetClosestPointOnCollision(ProbePosition, OutClosestPoint);
+
+	if (distance == 0.f)
+	{
+		OutClosestPoint = ProbePosition;
+	}
+	else if (distance < 0.f)
+	{
+		// no collision, fall back on the bounds
+		OutClosestPoint = m_sourceComponent->Bounds.GetBox().GetClosestPointTo(ProbePosition);
+	}
+
+	return true;
+}
+
+void UClosestPointSoundEmitterComponent::SetMultiplePositions()
+{
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	if (!AkAudioDevice || m_closestSegments.Num() < 2) { return; }
+
+	const FVector forward = GetForwardVector();
+	const FVector up = GetUpVector();
+
+	TArray<AkSoundPosition, TInlineAllocator<8>> positions;
+	positions.SetNum(m_closestSegments.Num());
+
+	for (int32 i = 0; i < m_closestSegments.Num(); i++)
+	{
+		FAkAudioDevice::FVectorsToAKWorldTransform(m_closestSegments[i].Point, forward, up, positions[i]);
+	}
+
+	AK::SoundEngine::MultiPositionType multiPositionType;
+	switch (MultiPositionType)
+	{
+	case AkMultiPositionType::SingleSource:		multiPositionType = AK::SoundEngine::MultiPositionType_SingleSource; break;
+	case AkMultiPositionType::MultiDirections:	multiPositionType = AK::SoundEngine::MultiPositionType_MultiDirections; break;
+	default:									multiPositionType = AK::SoundEngine::MultiPositionType_MultiSources; break;
+	}
+
+	m_multiPositionGameObjectID = GetAkGameObjectID();
+	AkAudioDevice->SetMultiplePositions(m_multiPositionGameObjectID, positions.GetData(), (AkUInt16)positions.Num(), multiPositionType);
+}
+
+#if !UE_BUILD_SHIPPING
+void UClosestPointSoundEmitterComponent::DebugDrawOnTick(UWorld* World)
+{
+	if (!IsValid(World)) { return; }
+
+	if (m_bHasClosestPoint)
+	{
+		if (m_closestSegments.IsEmpty())
+		{
+			DrawDebugLine(World, m_lastProbePosition, GetComponentLocation(), FColor::Cyan);
+		}
+
+		for (const FClosestSegment& closestSegment : m_closestSegments)
+		{
+			DrawDebugLine(World, m_lastProbePosition, closestSegment.Point, FColor::Cyan);
+		}
+	}
+
+	Super::DebugDrawOnTick(World);
+}
+#endif
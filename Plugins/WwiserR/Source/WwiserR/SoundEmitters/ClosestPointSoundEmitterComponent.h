@@ -0,0 +1,94 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AkGameplayTypes.h"
+#include "Engine/EngineTypes.h"
+#include "Core/SegmentDistanceKernel.h"
+#include "SoundEmitters/SoundEmitterComponent.h"
+#include "ClosestPointSoundEmitterComponent.generated.h"
+
+/*****************************************
+* UClosestPointSoundEmitterComponent
+* ****************************************
+*
+* SoundEmitterComponent for rivers, roads, shorelines,... that follows the point of a spline or volume closest to the distance probe,
+* instead of placing many point emitters along it.
+* - source: a USplineComponent (sampled into segments of SplineSegmentLength, indexed by a FSegmentBVH), a UBoxComponent (analytic)
+*   or any other primitive with (convex) collision
+* - the emitter moves to the closest point while it has active events, so distance culling uses the true closest distance
+* - that distance changes at most at the speed of the distance probe, so loops are culled as if this emitter doesn't move
+* - with NumClosestPoints > 1 (splines only), the game object gets multiple positions on the closest points of the N closest segments,
+*   its position is then not uploaded by the GameObjectPositionManager
+***/
+
+UCLASS(ClassGroup = "WwiserR", BlueprintType, Blueprintable, meta = (BlueprintSpawnableComponent))
+class WWISERR_API UClosestPointSoundEmitterComponent : public USoundEmitterComponent
+{
+	GENERATED_BODY()
+
+public:
+	/** spline, box or other primitive component this emitter follows. Defaults to the first spline or box component of the owner */
+	UPROPERTY(EditAnywhere, Category = "Sound Emitter|Closest Point", meta = (UseComponentPicker, AllowedClasses = "/Script/Engine.PrimitiveComponent"))
+	FComponentReference SourceComponent{};
+
+	/** splines are sampled into segments of this length on BeginPlay */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sound Emitter|Closest Point", meta = (ClampMin = "10.0", UIMin = "10.0"))
+	float SplineSegmentLength = 250.f;
+
+	/** number of closest spline segments that get a position on the game object */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sound Emitter|Closest Point", meta = (ClampMin = "1", ClampMax = "8"))
+	int32 NumClosestPoints = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sound Emitter|Closest Point", meta = (EditCondition = "NumClosestPoints > 1"))
+	AkMultiPositionType MultiPositionType = AkMultiPositionType::MultiSources;
+
+	/** the closest point is only updated when the distance probe moved more than this distance (in Centimeters) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sound Emitter|Closest Point", meta = (ClampMin = "0.0"))
+	float MinProbeMovement = 10.f;
+
+protected:
+	UPROPERTY(Transient) TObjectPtr<UPrimitiveComponent> m_sourceComponent = nullptr;
+
+	FSegmentBVH m_segmentBVH{};
+	TArray<FClosestSegment> m_closestSegments{};
+
+	FTransform m_builtSourceTransform = FTransform::Identity;	// source transform the segments were sampled with
+	FVector m_lastProbePosition = FVector::ZeroVector;
+	AkGameObjectID m_multiPositionGameObjectID = AK_INVALID_GAME_OBJECT;
+	bool m_bHasClosestPoint = false;
+
+public:
+	UClosestPointSoundEmitterComponent();
+	void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	UFUNCTION(BlueprintCallable, Category = "WwiserR|Sound Emitter|Closest Point")
+	void SetSourceComponent(UPrimitiveComponent* NewSourceComponent);
+
+	UFUNCTION(BlueprintPure, Category = "WwiserR|Sound Emitter|Closest Point")
+	FORCEINLINE UPrimitiveComponent* GetSourceComponent() const { return m_sourceComponent; }
+
+	/** resamples the source spline, e.g. after editing its points at runtime */
+	UFUNCTION(BlueprintCallable, Category = "WwiserR|Sound Emitter|Closest Point")
+	void RebuildSegments();
+
+	int32 PostLoop(UAkAudioEvent* LoopAkEvent, float ActivationRangeBuffer = 50.f, bool bQueryAndPostEnvironmentSwitches = false) override;
+
+protected:
+	void BeginPlay() override;
+	void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	bool TryToStopTicking() override;
+
+	// a batched single position upload would overwrite the multiple positions
+	bool CanDeferPositionUploads() const override { return NumClosestPoints <= 1; }
+
+#if !UE_BUILD_SHIPPING
+	void DebugDrawOnTick(UWorld* World) override;
+#endif
+
+	/** moves this emitter to the closest point of the source, if the distance probe or the source moved */
+	void UpdateClosestPoint(bool bForceUpdate = false);
+	bool FindClosestPoint(const FVector& ProbePosition, FVector& OutClosestPoint);
+	void SetMultiplePositions();
+};
@@ -0,0 +1,362 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#include "SoundEmitters/InstancedStaticSoundEmitterComponent.h"
+#include "Managers/StaticSoundEmitterManager.h"
+#include "DataAssets/DA_StaticSoundLoop.h"
+#include "Core/AudioSubsystem.h"
+#include "Core/AudioUtils.h"
+#include "AkAudioDevice.h"
+#include "AkAudioEvent.h"
+#include "AkSwitchValue.h"
+#include "Algo/Find.h"
+#include "WwiseSoundEngine/Public/Wwise/API/WwiseSoundEngineAPI.h"
+#include "UObject/UObjectArray.h"
+
+int32 UInstancedStaticSoundEmitterComponent::AddInstance(const FTransform& InstanceTransform, bool bWorldSpace)
+{
+	if (!CanEditInstances()) { return INDEX_NONE; }
+
+	if (InstanceTransforms.Num() >= MaxInstances)
+	{
+		WR_DBG_FUNC(Warning, "%s already has the maximum of %i instances", *UAudioUtils::GetFullObjectName(this), MaxInstances);
+		return INDEX_NONE;
+	}
+
+	return InstanceTransforms.Add(bWorldSpace ? InstanceTransform.GetRelativeTransform(GetComponentTransform()) : InstanceTransform);
+}
+
+bool UInstancedStaticSoundEmitterComponent::RemoveInstance(int32 InstanceIndex)
+{
+	if (!CanEditInstances() || !InstanceTransforms.IsValidIndex(InstanceIndex)) { return false; }
+
+	InstanceTransforms.RemoveAtSwap(InstanceIndex);
+	return true;
+}
+
+void UInstancedStaticSoundEmitterComponent::ClearInstances()
+{
+	if (!CanEditInstances()) { return; }
+
+	InstanceTransforms.Empty();
+}
+
+FTransform UInstancedStaticSoundEmitterComponent::GetInstanceWorldTransform(int32 InstanceIndex) const
+{
+	return InstanceTransforms.IsValidIndex(InstanceIndex) ? InstanceTransforms[InstanceIndex] * GetComponentTransform() : GetComponentTransform();
+}
+
+bool UInstancedStaticSoundEmitterComponent::HasActiveEvents() const
+{
+	return !m_playingInstances.IsEmpty() || Super::HasActiveEvents();
+}
+
+void UInstancedStaticSoundEmitterComponent::BeginPlay()
+{
+	if (InstanceTransforms.Num() > MaxInstances)
+	{
+		WR_DBG_FUNC(Warning, "%s has %i instances, only the first %i are used", *UAudioUtils::GetFullObjectName(this),
+			InstanceTransforms.Num(), MaxInstances);
+		InstanceTransforms.SetNum(MaxInstances);
+	}
+
+	// sized before Super::BeginPlay() posts the loops
+	m_instanceSelectionStamps.SetNumZeroed(InstanceTransforms.Num());
+
+	Super::BeginPlay();
+}
+
+void UInstancedStaticSoundEmitterComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Super::EndPlay(EndPlayReason);
+
+	// the world manager drops the instances without stopping them once the component is gone, fade them out as if they were stopped
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+
+	for (TPair<int32, TSharedPtr<FStaticSoundEmitterInstancePlayback>>& playingInstance : m_playingInstances)
+	{
+		int32 fadeOutTimeInMs = 0;
+
+		for (const TPair<UAkAudioEvent*, AkPlayingID>& playingLoop : playingInstance.Value->PlayingLoops)
+		{
+			UDA_StaticSoundLoop* const* staticSoundLoop = Algo::FindByPredicate(m_postedLoops,
+				[&playingLoop](const UDA_StaticSoundLoop* PostedLoop) { return PostedLoop->LoopEvent == playingLoop.Key; });
+
+			if (staticSoundLoop != nullptr)
+			{
+				fadeOutTimeInMs = FMath::Max(fadeOutTimeInMs, (*staticSoundLoop)->FadeOutTimeInMs);
+			}
+
+			if (AkAudioDevice != nullptr)
+			{
+				AkAudioDevice->StopPlayingID(playingLoop.Value, staticSoundLoop != nullptr ? (*staticSoundLoop)->FadeOutTimeInMs : 0,
+					staticSoundLoop != nullptr ? (AkCurveInterpolation)(*staticSoundLoop)->FadeOutCurve : AkCurveInterpolation_Linear);
+			}
+		}
+
+		UnregisterInstancePlayback(playingInstance.Value, fadeOutTimeInMs);
+	}
+
+	m_playingInstances.Empty();
+}
+
+#if WITH_EDITOR
+void UInstancedStaticSoundEmitterComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UInstancedStaticSoundEmitterComponent, InstanceTransforms)
+		&& InstanceTransforms.Num() > MaxInstances)
+	{
+		InstanceTransforms.SetNum(MaxInstances);
+	}
+}
+#endif
+
+void UInstancedStaticSoundEmitterComponent::StartPlayInstance(UDA_StaticSoundLoop* StaticSoundLoop, int32 InstanceIndex)
+{
+	// already checked in UStaticSoundEmitterManager::PostLoop()
+	WR_ASSERT(IsValid(StaticSoundLoop->LoopEvent), "missing Wwise event in %s", *StaticSoundLoop->GetName());
+
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (UNLIKELY(!AkAudioDevice || !SoundEngine)) { return; }
+
+	TSharedPtr<FStaticSoundEmitterInstancePlayback>& playback = m_playingInstances.FindOrAdd(InstanceIndex);
+
+	if (!playback.IsValid())
+	{
+		playback = MakeShared<FStaticSoundEmitterInstancePlayback>();
+
+		// same convention as UAkGameObject, the game object ID is the address of its owner
+		const AkGameObjectID gameObjectID = (AkGameObjectID)playback.Get();
+
+		if (AkAudioDevice->RegisterGameObject(gameObjectID, FString::Printf(TEXT("%s_%i"), *GetName(), InstanceIndex)) != AK_Success)
+		{
+			WR_DBG_FUNC(Warning, "could not register game object for instance %i of %s", InstanceIndex,
+				*UAudioUtils::GetFullObjectName(this));
+			m_playingInstances.Remove(InstanceIndex);
+			return;
+		}
+
+		playback->GameObjectID = gameObjectID;
+
+		// static, positioned once
+		const FTransform instanceTransform = GetInstanceWorldTransform(InstanceIndex);
+		AkSoundPosition soundPosition;
+		AkAudioDevice->FVectorsToAKWorldTransform(instanceTransform.GetLocation(), instanceTransform.GetRotation().GetForwardVector(),
+			instanceTransform.GetRotation().GetUpVector(), soundPosition);
+		SoundEngine->SetPosition(gameObjectID, soundPosition);
+
+		AStaticSoundEmitterWorldManager::PlaceStaticGameObject(gameObjectID, instanceTransform.GetLocation(), GetWorld());
+		InitializeInstanceGameSyncs(gameObjectID);
+	}
+
+	if (playback->PlayingLoops.Contains(StaticSoundLoop->LoopEvent))
+	{
+		WR_DBG_FUNC(Error, "%s already playing on instance %i of %s", *StaticSoundLoop->LoopEvent->GetName(), InstanceIndex,
+			*UAudioUtils::GetFullObjectName(this));
+		return;
+	}
+
+	const AkPlayingID playingID = SoundEngine->PostEvent(StaticSoundLoop->LoopEvent->GetShortID(), playback->GameObjectID);
+
+	if (playingID != AK_INVALID_PLAYING_ID)
+	{
+		OnPlayingStateChanged.Broadcast(true, StaticSoundLoop);
+		playback->PlayingLoops.Emplace(StaticSoundLoop->LoopEvent, playingID);
+
+		if (s_debugToConsole && s_logEvents)
+		{
+			WR_DBG_FUNC(Log, "AkEvent posted : %s on instance %i - PlayingID = %i", *StaticSoundLoop->LoopEvent->GetName(),
+				InstanceIndex, playingID);
+		}
+	}
+	else
+	{
+		WR_DBG_FUNC(Warning, "failed to post Wwise event [%s] on instance %i", *StaticSoundLoop->LoopEvent->GetName(), InstanceIndex);
+
+		if (playback->PlayingLoops.IsEmpty())
+		{
+			AkAudioDevice->UnregisterComponent(playback->GameObjectID);
+			m_playingInstances.Remove(InstanceIndex);
+		}
+	}
+}
+
+void UInstancedStaticSoundEmitterComponent::StopPlayInstance(UDA_StaticSoundLoop* StaticSoundLoop, int32 InstanceIndex)
+{
+	TSharedPtr<FStaticSoundEmitterInstancePlayback>* playback = m_playingInstances.Find(InstanceIndex);
+	if (playback == nullptr) { return; }
+
+	AkPlayingID playingID;
+	if (!(*playback)->PlayingLoops.RemoveAndCopyValue(StaticSoundLoop->LoopEvent, playingID)) { return; }
+
+	if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
+	{
+		AkAudioDevice->StopPlayingID(playingID, StaticSoundLoop->FadeOutTimeInMs, (AkCurveInterpolation)StaticSoundLoop->FadeOutCurve);
+	}
+
+	OnPlayingStateChanged.Broadcast(false, StaticSoundLoop);
+
+	if (s_debugToConsole && s_logEvents)
+	{
+		WR_DBG_FUNC(Log, "AkEvent stopped : %s on instance %i - PlayingID = %i", *StaticSoundLoop->LoopEvent->GetName(),
+			InstanceIndex, playingID);
+	}
+
+	// the game object is released once its last loop faded out
+	if ((*playback)->PlayingLoops.IsEmpty())
+	{
+		TSharedPtr<FStaticSoundEmitterInstancePlayback> releasedPlayback = *playback;
+		m_playingInstances.Remove(InstanceIndex);
+		UnregisterInstancePlayback(releasedPlayback, StaticSoundLoop->FadeOutTimeInMs);
+	}
+}
+
+void UInstancedStaticSoundEmitterComponent::StopPlayAllInstances(UDA_StaticSoundLoop* StaticSoundLoop)
+{
+	TArray<int32, TInlineAllocator<16>> playingInstanceIndices;
+	m_playingInstances.GetKeys(playingInstanceIndices);
+
+	for (const int32 instanceIndex : playingInstanceIndices)
+	{
+		StopPlayInstance(StaticSoundLoop, instanceIndex);
+	}
+}
+
+void UInstancedStaticSoundEmitterComponent::InitializeInstanceGameSyncs(AkGameObjectID GameObjectID) const
+{
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (UNLIKELY(!SoundEngine)) { return; }
+
+	for (const TPair<AkSwitchGroupID, UAkSwitchValue*>& activeSwitch : m_activeSwitches)
+	{
+		SoundEngine->SetSwitch(activeSwitch.Key, activeSwitch.Value->GetShortID(), GameObjectID);
+	}
+
+	// the latest values, including those not flushed yet
+	for (const FEmitterRtpc& rtpc : m_rtpcs.Entries)
+	{
+		SoundEngine->SetRTPCValue(rtpc.ShortID, rtpc.Value, GameObjectID, 0);
+	}
+}
+
+void UInstancedStaticSoundEmitterComponent::SetSwitchOnGameObject(const UAkSwitchValue* AkSwitchValue)
+{
+	// through the ID overload, which also sends it to the instances
+	SetSwitchOnGameObject(AkSwitchValue->GetGroupID(), AkSwitchValue->GetShortID());
+}
+
+void UInstancedStaticSoundEmitterComponent::SetSwitchOnGameObject(AkSwitchGroupID SwitchGroupID, AkSwitchStateID SwitchStateID)
+{
+	Super::SetSwitchOnGameObject(SwitchGroupID, SwitchStateID);
+
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (UNLIKELY(!SoundEngine)) { return; }
+
+	for (const TPair<int32, TSharedPtr<FStaticSoundEmitterInstancePlayback>>& playingInstance : m_playingInstances)
+	{
+		SoundEngine->SetSwitch(SwitchGroupID, SwitchStateID, playingInstance.Value->GameObjectID);
+	}
+}
+
+void UInstancedStaticSoundEmitterComponent::SetRtpcOnGameObject(AkRtpcID RtpcID, float Value, int32 InterpolationTimeMs)
+{
+	Super::SetRtpcOnGameObject(RtpcID, Value, InterpolationTimeMs);
+
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (UNLIKELY(!SoundEngine)) { return; }
+
+	for (const TPair<int32, TSharedPtr<FStaticSoundEmitterInstancePlayback>>& playingInstance : m_playingInstances)
+	{
+		SoundEngine->SetRTPCValue(RtpcID, Value, playingInstance.Value->GameObjectID, InterpolationTimeMs);
+	}
+}
+
+void UInstancedStaticSoundEmitterComponent::ResetRtpcOnGameObject(AkRtpcID RtpcID)
+{
+	Super::ResetRtpcOnGameObject(RtpcID);
+
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (UNLIKELY(!SoundEngine)) { return; }
+
+	for (const TPair<int32, TSharedPtr<FStaticSoundEmitterInstancePlayback>>& playingInstance : m_playingInstances)
+	{
+		SoundEngine->ResetRTPCValue(RtpcID, playingInstance.Value->GameObjectID);
+	}
+}
+
+void UInstancedStaticSoundEmitterComponent::UnregisterInstancePlayback(TSharedPtr<FStaticSoundEmitterInstancePlayback> Playback,
+	int32 FadeOutTimeInMs)
+{
+	// the world manager keeps the game object ID (address) in use until the fade out ended, and unregisters it on teardown
+	UWorld* world = GetWorld();
+	UAudioSubsystem* audioSubsystem = UAudioSubsystem::Get(world);
+	UStaticSoundEmitterManager* staticSoundEmitterManager = audioSubsystem ? audioSubsystem->GetStaticSoundEmitterManager() : nullptr;
+	AStaticSoundEmitterWorldManager* worldManager = staticSoundEmitterManager ? staticSoundEmitterManager->GetWorldManager(world) : nullptr;
+
+	if (IsValid(worldManager))
+	{
+		worldManager->UnregisterStaticGameObject(Playback->GameObjectID, Playback, FadeOutTimeInMs);
+		return;
+	}
+
+	if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
+	{
+		AkAudioDevice->UnregisterComponent(Playback->GameObjectID);
+	}
+}
+
+bool UInstancedStaticSoundEmitterComponent::CanEditInstances() const
+{
+	// the world manager indexes the instances by index while the component plays
+	if (HasBegunPlay())
+	{
+		WR_DBG_FUNC(Warning, "instances of %s can't be edited after BeginPlay", *UAudioUtils::GetFullObjectName(this));
+		return false;
+	}
+
+	return true;
+}
+
+#if !UE_BUILD_SHIPPING
+void UInstancedStaticSoundEmitterComponent::LogMemoryComparison(int32 NumInstances)
+{
+	NumInstances = FMath::Clamp(NumInstances, 1, MaxInstances);
+
+	// one posted loop per emitter, as set up in a level
+	UDA_StaticSoundLoop* staticSoundLoop = NewObject<UDA_StaticSoundLoop>(GetTransientPackage());
+
+	UStaticSoundEmitterComponent* component = NewObject<UStaticSoundEmitterComponent>(GetTransientPackage());
+	component->StaticSoundLoops.Add(staticSoundLoop);
+
+	UInstancedStaticSoundEmitterComponent* instancedComponent = NewObject<UInstancedStaticSoundEmitterComponent>(GetTransientPackage());
+	instancedComponent->StaticSoundLoops.Add(staticSoundLoop);
+	instancedComponent->m_postedLoops.Add(staticSoundLoop);
+	instancedComponent->InstanceTransforms.SetNum(NumInstances);
+	instancedComponent->m_instanceSelectionStamps.SetNumZeroed(NumInstances);
+
+	// object, object array item and owned allocations, the posted loops set is the same for both.
+	// The world manager's index holds one entry per emitter or instance either way
+	const SIZE_T postedLoopsBytes = instancedComponent->m_postedLoops.GetAllocatedSize();
+
+	const SIZE_T componentBytes = UStaticSoundEmitterComponent::StaticClass()->GetStructureSize() + sizeof(FUObjectItem)
+		+ component->StaticSoundLoops.GetAllocatedSize() + postedLoopsBytes;
+	const SIZE_T componentsBytes = componentBytes * NumInstances;
+
+	const SIZE_T instancedBytes = UInstancedStaticSoundEmitterComponent::StaticClass()->GetStructureSize() + sizeof(FUObjectItem)
+		+ instancedComponent->StaticSoundLoops.GetAllocatedSize() + postedLoopsBytes
+		+ instancedComponent->InstanceTransforms.GetAllocatedSize() + instancedComponent->m_instanceSelectionStamps.GetAllocatedSize();
+
+	const SIZE_T indexBytes = NumInstances * (sizeof(FStaticSoundEmitterOctreeElement) + sizeof(TPair<uint64, FOctreeElementId2>));
+
+	// a playing instance allocates its game object on demand, a playing component its AkComponent
+	WR_DBG_STATIC_FUNC(Log, "%i emitters (sizeof estimate) : components ~%.1f KB (%llu bytes each), instanced ~%.1f KB (x%.1f less), index ~%.1f KB",
+		NumInstances, componentsBytes / 1024.f, (uint64)componentBytes, instancedBytes / 1024.f,
+		instancedBytes > 0 ? (float)componentsBytes / instancedBytes : 0.f, indexBytes / 1024.f);
+
+	component->MarkAsGarbage();
+	instancedComponent->MarkAsGarbage();
+	staticSoundLoop->MarkAsGarbage();
+}
+#endif
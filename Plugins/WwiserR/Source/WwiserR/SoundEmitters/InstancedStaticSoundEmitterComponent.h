@@ -0,0 +1,106 @@
+// Copyright Yoerik Roevens. All Rights Reserved.(c)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AkGameplayTypes.h"
+#include "SoundEmitters/StaticSoundEmitterComponent.h"
+#include "InstancedStaticSoundEmitterComponent.generated.h"
+
+class UAkAudioEvent;
+
+// playback of a selected instance, on a game object allocated when the instance starts playing
+struct FStaticSoundEmitterInstancePlayback
+{
+	AkGameObjectID GameObjectID = AK_INVALID_GAME_OBJECT;	// address of this struct, kept alive until unregistered
+	TMap<UAkAudioEvent*, AkPlayingID> PlayingLoops{};
+};
+
+/*****************************************
+* UInstancedStaticSoundEmitterComponent
+* ****************************************
+*
+* StaticSoundEmitterComponent with many emitter positions, as instanced static meshes are for meshes.
+* - one component holds the (relative) transforms of all its instances, placed with the transform widgets in the editor
+* - AStaticSoundEmitterWorldManager indexes every instance as a lightweight entry, selection and voice limiting are per instance
+* - only selected instances get a game object, registered when they start playing and unregistered after their last loop faded out
+*   (by the world manager, which unregisters the pending game objects when it is torn down)
+* - instance game objects are placed in the spatial audio room and world listener sends at their position, and get the switches and
+*   Rtpcs set on the component
+* - instances are edited before BeginPlay (editor, construction script), the instance count is limited to MaxInstances
+* - WwiserR.StaticSoundEmitter.InstancedMemoryComparison logs an estimate of the memory of N instances against N
+*   StaticSoundEmitterComponents
+***/
+
+UCLASS(ClassGroup = "WwiserR", BlueprintType, Blueprintable, meta = (BlueprintSpawnableComponent))
+class WWISERR_API UInstancedStaticSoundEmitterComponent : public UStaticSoundEmitterComponent
+{
+	GENERATED_BODY()
+
+	friend class AStaticSoundEmitterWorldManager;
+	friend struct FStaticSoundEmitterInstance;
+
+public:
+	// instance indices are packed in 16 bits by the shared grid
+	static constexpr int32 MaxInstances = MAX_uint16 - 1;
+
+	/** instance transforms, relative to this component */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "WwiserR|InstancedStaticSoundEmitterComponent", meta = (MakeEditWidget))
+	TArray<FTransform> InstanceTransforms{};
+
+protected:
+	TArray<uint32> m_instanceSelectionStamps{};	// per instance, see UStaticSoundEmitterComponent::m_selectionStamp
+	TMap<int32, TSharedPtr<FStaticSoundEmitterInstancePlayback>> m_playingInstances{};
+
+public:
+	/** returns the index of the new instance, or INDEX_NONE if MaxInstances is reached */
+	UFUNCTION(BlueprintCallable, Category = "WwiserR|InstancedStaticSoundEmitterComponent")
+	int32 AddInstance(const FTransform& InstanceTransform, bool bWorldSpace = false);
+
+	/** the last instance takes the index of the removed one */
+	UFUNCTION(BlueprintCallable, Category = "WwiserR|InstancedStaticSoundEmitterComponent")
+	bool RemoveInstance(int32 InstanceIndex);
+
+	UFUNCTION(BlueprintCallable, Category = "WwiserR|InstancedStaticSoundEmitterComponent")
+	void ClearInstances();
+
+	UFUNCTION(BlueprintPure, Category = "WwiserR|InstancedStaticSoundEmitterComponent")
+	FORCEINLINE int32 GetInstanceCount() const { return InstanceTransforms.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "WwiserR|InstancedStaticSoundEmitterComponent")
+	FTransform GetInstanceWorldTransform(int32 InstanceIndex) const;
+
+	bool HasActiveEvents() const override;
+
+#if !UE_BUILD_SHIPPING
+	/** logs a sizeof based estimate of the memory of NumInstances emitters as separate components and as instances of one component */
+	static void LogMemoryComparison(int32 NumInstances);
+#endif
+
+protected:
+	// also sent to the game objects of the playing instances
+	using Super::SetSwitchOnGameObject;
+	void SetSwitchOnGameObject(const class UAkSwitchValue* AkSwitchValue) override;
+	void SetSwitchOnGameObject(AkSwitchGroupID SwitchGroupID, AkSwitchStateID SwitchStateID) override;
+	void SetRtpcOnGameObject(AkRtpcID RtpcID, float Value, int32 InterpolationTimeMs) override;
+	void ResetRtpcOnGameObject(AkRtpcID RtpcID) override;
+	bool HasGameSyncTargets() const override { return !m_playingInstances.IsEmpty() || Super::HasGameSyncTargets(); }
+
+	void BeginPlay() override;
+	void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+#if WITH_EDITOR
+	void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// called from AStaticSoundEmitterWorldManager
+	void StartPlayInstance(UDA_StaticSoundLoop* StaticSoundLoop, int32 InstanceIndex);
+	void StopPlayInstance(UDA_StaticSoundLoop* StaticSoundLoop, int32 InstanceIndex);
+	void StopPlayAllInstances(UDA_StaticSoundLoop* StaticSoundLoop);
+
+	FORCEINLINE uint32& GetInstanceSelectionStamp(int32 InstanceIndex) { return m_instanceSelectionStamps[InstanceIndex]; }
+
+	void InitializeInstanceGameSyncs(AkGameObjectID GameObjectID) const;
+	void UnregisterInstancePlayback(TSharedPtr<FStaticSoundEmitterInstancePlayback> Playback, int32 FadeOutTimeInMs);
+	bool CanEditInstances() const;
+};
@@ -3,6 +3,8 @@
 
 #include "SoundEmitterComponent.h"
 #include "Managers/SoundListenerManager.h"
+#include "Managers/DistanceCullingManager.h"
+#include "Core/AudioSubsystem.h"
 #include "WorldSoundListenerComponent.h"
 #include "AkAudioDevice.h"
 #include "AkComponent.h"
@@ -93,6 +95,11 @@ void USoundEmitterComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		}
 	}
 
+	if (IsValid(m_distanceCullingManager))
+	{
+		m_distanceCullingManager->CancelDistanceCulling(this);
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -131,7 +138,7 @@ void USoundEmitterComponent::OnDebugDrawChanged()
 
 	if (s_debugDraw)
 	{
-		if (!m_culledPlayingLoops.IsEmpty() || IsValid(m_AkComp))
+		if (!m_culledPlayingLoops.IsEmpty() || HasGameObject())
 		{
 			SetComponentTickEnabled(true);
 
@@ -288,7 +295,7 @@ void USoundEmitterComponent::UpdateOnMovedDelegates()
 
 		if (!s_listenerManager->OnAttenuationReferenceChanged.IsBoundToObject(this))
 		{
-			s_listenerManager->OnAttenuationReferenceChanged.AddUObject(this, &USoundEmitterComponent::RecullAllLoops);
+			s_listenerManager->OnAttenuationReferenceChanged.AddUObject(this, &USoundEmitterComponent::RequestRecullAllLoops);
 		}
 	}
 	else if(m_culledPlayingLoops.IsEmpty() && IsValid(s_listenerManager))
@@ -433,9 +440,9 @@ void USoundEmitterComponent::UpdateDistanceCullingRelativeMaxSpeed()
 	{
 		m_bMustRecalculateAllLoopCullTimes = true;
 
-		// if (m_nextCullIndex > 0)
+		if (m_culledPlayingLoops.IsValidIndex(m_nextCullIndex))
 		{
-			CalculateAndSetNextLoopCullTime(m_culledPlayingLoops[m_nextCullIndex]);
+			m_nextCullTime = FMath::Min(m_nextCullTime, CalculateAndSetNextLoopCullTime(m_culledPlayingLoops[m_nextCullIndex]));
 		}
 
 		ScheduleNextDistanceCulling();
@@ -444,39 +451,40 @@ void USoundEmitterComponent::UpdateDistanceCullingRelativeMaxSpeed()
 
 bool USoundEmitterComponent::ScheduleNextDistanceCulling()
 {
-	const UWorld* world = GetWorld();
+	UDistanceCullingManager* distanceCullingManager = GetDistanceCullingManager();
 
-	if (!IsValid(world))
+	if (!IsValid(distanceCullingManager))
 	{
 		return false;
 	}
 
 	if (!FMath::IsFinite(m_nextCullTime))
 	{
-		world->GetTimerManager().ClearTimer(m_timerNextDistanceCull);
+		distanceCullingManager->CancelDistanceCulling(this);
 		return false;
 	}
 
-	const float nextCullTimeFromNow = m_nextCullTime - world->GetTimeSeconds();
+	// due (or overdue) cull times are processed on the manager's next tick
+	distanceCullingManager->ScheduleDistanceCulling(this, m_nextCullTime);
+	return true;
+}
 
-	if (nextCullTimeFromNow > 0.f)
-	{
-		world->GetTimerManager().SetTimer(m_timerNextDistanceCull, this, &USoundEmitterComponent::DistanceCull, nextCullTimeFromNow, false);
-		return true;
-	}
-	else
+UDistanceCullingManager* USoundEmitterComponent::GetDistanceCullingManager()
+{
+	if (!IsValid(m_distanceCullingManager))
 	{
-		world->GetTimerManager().ClearTimer(m_timerNextDistanceCull);
-		m_timerNextDistanceCull = world->GetTimerManager().SetTimerForNextTick(this, &USoundEmitterComponent::DistanceCull);
-		return true;
+		if (UAudioSubsystem* audioSubsystem = UAudioSubsystem::Get(GetWorld()))
+		{
+			m_distanceCullingManager = audioSubsystem->GetDistanceCullingManager();
+		}
 	}
 
-	return false;
+	return m_distanceCullingManager;
 }
 
 void USoundEmitterComponent::DistanceCull()
 {
-	//if (m_nextCullIndex > 0)
+	if (m_culledPlayingLoops.IsValidIndex(m_nextCullIndex))
 	{
 		CullByDistance(m_culledPlayingLoops[m_nextCullIndex]);
 	}
@@ -564,7 +572,7 @@ int32 USoundEmitterComponent::DevirtualizeLoop(FPlayingAudioLoop& Loop)
 		QueryAndPostEnvironmentSwitches();
 	}
 
-	Loop.LastPlayingID = m_AkComp->PostAkEvent(Loop.AkEvent, 0, FOnAkPostEventCallback());
+	Loop.LastPlayingID = PostAkEventOnGameObject(Loop.AkEvent);
 	Loop.bIsVirtual = false;
 
 	for (TPair<UAkRtpc*, float> rtpcOnPlayingID : Loop.RtpcsOnPlayingID)
@@ -589,7 +597,7 @@ int32 USoundEmitterComponent::DevirtualizeLoop(FPlayingAudioLoop& Loop)
 	return Loop.LastPlayingID;
 }
 
-float USoundEmitterComponent::CalculateAndSetNextLoopCullTime(FPlayingAudioLoop& Loop)
+double USoundEmitterComponent::CalculateAndSetNextLoopCullTime(FPlayingAudioLoop& Loop)
 {
 	WR_ASSERT(Loop.AkEvent, "invalid AkEvent found in culledPlayingLoops array");
 
@@ -601,7 +609,7 @@ float USoundEmitterComponent::CalculateAndSetNextLoopCullTime(FPlayingAudioLoop&
 	}
 
 	const FVector emitterLocation = GetCullingLocation();
-	const float currentTime = GetWorld()->GetTimeSeconds();
+	const double currentTime = GetWorld()->GetTimeSeconds();
 	const float emitterMaxSpeed = bCanMove ? m_emitterMaxSpeed : 0.f;
 
 	if (bCanMove && (UseParentLocationForCulling() && IsValid(m_characterMovementData.MovementComp)))
@@ -611,18 +619,16 @@ float USoundEmitterComponent::CalculateAndSetNextLoopCullTime(FPlayingAudioLoop&
 	}
 
 	const float cullRange = Loop.AkEvent->MaxAttenuationRadius * AttenuationScalingFactor + innerRadius + Loop.AttenuationRangeBuffer;
-	float maxRelativeSpeed{ 0.f };
 
-	// world listeners
-	for (TWeakObjectPtr<UWorldSoundListener> worldListener : GetWorldListeners())
+	// world listeners, default listeners and spatial audio listener
+	for (const FListenerSnapshotEntry& listener : GetListenerManager()->GetListenerSnapshot().Listeners)
 	{
-		maxRelativeSpeed = emitterMaxSpeed + worldListener->GetMaxSpeed();
+		const float maxRelativeSpeed = emitterMaxSpeed + listener.MaxSpeed;
 
 		if (maxRelativeSpeed > 0.f)
 		{
-			const float minDistanceToTravel = FMath::Abs(
-				FVector::Distance(emitterLocation, worldListener->GetComponentLocation()) - cullRange);
-			const float nextLoopCullTime = currentTime + minDistanceToTravel / maxRelativeSpeed;
+			const float minDistanceToTravel = FMath::Abs(FVector::Distance(emitterLocation, listener.Position) - cullRange);
+			const double nextLoopCullTime = currentTime + minDistanceToTravel / maxRelativeSpeed;
 
 			if (nextLoopCullTime < Loop.NextCullTime)
 			{
@@ -631,47 +637,84 @@ float USoundEmitterComponent::CalculateAndSetNextLoopCullTime(FPlayingAudioLoop&
 		}
 	}
 
-	// default listeners
-	if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
+	return Loop.NextCullTime;
+}
+
+bool USoundEmitterComponent::AddLoopsToCullingBatch(FCullingLoopBatch& LoopBatch, TArray<int32>& LoopIndices)
+{
+	if (!m_culledPlayingLoops.IsValidIndex(m_nextCullIndex) || m_isMuted || !bUseDistanceCulling || AttenuationScalingFactor <= 0.f)
 	{
-		maxRelativeSpeed = emitterMaxSpeed + s_listenerManager->GetDefaultListenerMaxSpeed();
+		return false;
+	}
 
-		if (maxRelativeSpeed > 0.f)
-		{
-			for (TWeakObjectPtr<UAkComponent> defaultListener : AkAudioDevice->GetDefaultListeners())
-			{
-				if (defaultListener.Get() == AkAudioDevice->GetSpatialAudioListener())
-				{
-					continue;
-				}
+#if !UE_BUILD_SHIPPING
+	if (Private_SoundEmitterComponent::bDebugPoll) { return false; }
+#endif
 
-				const float minDistanceToTravel = FMath::Abs(
-					FVector::Distance(emitterLocation, defaultListener->GetComponentLocation()) - cullRange);
-				const float nextLoopCullTime = currentTime + minDistanceToTravel / maxRelativeSpeed;
+	const int32 firstLoop = m_bMustRecalculateAllLoopCullTimes ? 0 : m_nextCullIndex;
+	const int32 lastLoop = m_bMustRecalculateAllLoopCullTimes ? m_culledPlayingLoops.Num() - 1 : m_nextCullIndex;
 
-				if (nextLoopCullTime < Loop.NextCullTime)
-				{
-					Loop.NextCullTime = nextLoopCullTime;
-				}
-			}
+	for (int32 i = firstLoop; i <= lastLoop; i++)
+	{
+		if (!IsValid(m_culledPlayingLoops[i].AkEvent) || m_culledPlayingLoops[i].AkEvent->MaxAttenuationRadius == 0)
+		{
+			return false;
 		}
 	}
 
-	// spatial audio listener
-	maxRelativeSpeed = emitterMaxSpeed + s_listenerManager->GetDistanceProbeMaxSpeed();
-	if (maxRelativeSpeed > 0.f)
+	const FVector cullingLocation = GetCullingLocation();
+	const float emitterMaxSpeed = bCanMove ? m_emitterMaxSpeed : 0.f;
+
+	for (int32 i = firstLoop; i <= lastLoop; i++)
 	{
-		const float minDistanceToTravel = FMath::Abs(
-			FMath::Sqrt(s_listenerManager->GetSquaredDistanceToDistanceProbe(emitterLocation)) - cullRange);
-		const float nextLoopCullTime = currentTime + minDistanceToTravel / maxRelativeSpeed;
+		const FPlayingAudioLoop& loop = m_culledPlayingLoops[i];
+		const float cullRange = loop.AkEvent->MaxAttenuationRadius * AttenuationScalingFactor + innerRadius + loop.AttenuationRangeBuffer;
 
-		if (nextLoopCullTime < Loop.NextCullTime)
+		LoopBatch.Add(cullingLocation, cullRange, emitterMaxSpeed);
+		LoopIndices.Add(i);
+	}
+
+	return true;
+}
+
+void USoundEmitterComponent::ApplyCullingBatchResults(
+	const FCullingLoopBatch& LoopBatch, const TArray<int32>& LoopIndices, int32 FirstRecord, int32 NumRecords)
+{
+	const double currentTime = GetWorld()->GetTimeSeconds();
+
+	for (int32 record = FirstRecord; record < FirstRecord + NumRecords; record++)
+	{
+		const int32 loopIndex = LoopIndices[record];
+		if (!m_culledPlayingLoops.IsValidIndex(loopIndex)) { continue; }
+
+		FPlayingAudioLoop& loop = m_culledPlayingLoops[loopIndex];
+
+		// only the cued loop is (de)virtualized, like in CullByDistance
+		if (loopIndex == m_nextCullIndex)
 		{
-			Loop.NextCullTime = nextLoopCullTime;
+			const bool bInRange = LoopBatch.bInRange[record] != 0;
+
+			if (loop.bIsVirtual && bInRange)
+			{
+				DevirtualizeLoop(loop);
+			}
+			else if (!loop.bIsVirtual && !bInRange)
+			{
+				VirtualizeLoop(loop);
+			}
 		}
+
+		loop.NextCullTime = currentTime + LoopBatch.NextCullTime[record];
 	}
 
-	return Loop.NextCullTime;
+	if (bCanMove && (UseParentLocationForCulling() && IsValid(m_characterMovementData.MovementComp)))
+	{
+		m_characterMovementData.LastCulledMaxSpeed = m_emitterMaxSpeed;
+		m_characterMovementData.HasReculled = true;
+	}
+
+	m_bMustRecalculateAllLoopCullTimes = false;
+	UpdateNextCullTimeAndLoopIndex();
 }
 
 void USoundEmitterComponent::UpdateNextCullTimeAndLoopIndex()
@@ -714,8 +757,22 @@ void USoundEmitterComponent::UpdateNextCullTimeAndLoopIndex()
 	ScheduleNextDistanceCulling();
 }
 
+void USoundEmitterComponent::RequestRecullAllLoops()
+{
+	if (UDistanceCullingManager* distanceCullingManager = GetDistanceCullingManager())
+	{
+		distanceCullingManager->QueueRecull(this);
+	}
+	else
+	{
+		RecullAllLoops();
+	}
+}
+
 void USoundEmitterComponent::RecullAllLoops()
 {
+	m_bRecullPending = false;
+
 	if (m_culledPlayingLoops.IsEmpty())
 	{
 		return;
@@ -776,7 +833,7 @@ void USoundEmitterComponent::OnListenersUpdated()
 
 	if (!m_culledPlayingLoops.IsEmpty())
 	{
-		RecullAllLoops();
+		RequestRecullAllLoops();
 	}
 }
 #pragma endregion
@@ -916,7 +973,7 @@ void USoundEmitterComponent::SetRtpcByPlayingID(UAkRtpc* AkRtpc, int32 PlayingID
 		}
 	}
 
-	if (IsValid(m_AkComp))
+	if (HasGameObject())
 	{
 		if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
 		{
@@ -945,7 +1002,7 @@ int32 USoundEmitterComponent::PostLoop(UAkAudioEvent* LoopAkEvent, float Activat
 			QueryAndPostEnvironmentSwitches();
 		}
 
-		Loop.InitialPlayingID = m_AkComp->PostAkEvent(LoopAkEvent, 0, FOnAkPostEventCallback());
+		Loop.InitialPlayingID = PostAkEventOnGameObject(LoopAkEvent);
 		Loop.bIsVirtual = false;
 	}
 	else
@@ -1112,9 +1169,9 @@ int32 USoundEmitterComponent::StopLoopUsingStopEvent(
 
 			if (Loop.AkEvent == LoopAkEvent && (PlayingID == 0 || PlayingID == Loop.InitialPlayingID || PlayingID == Loop.LastPlayingID))
 			{
-				if (!Loop.bIsVirtual && IsValid(m_AkComp))
+				if (!Loop.bIsVirtual && HasGameObject())
 				{
-					pID = m_AkComp->PostAkEvent(StopAkEvent, CallbackMask, PostEventCallback);
+					pID = PostAkEventOnGameObject(StopAkEvent, CallbackMask, PostEventCallback);
 				}
 
 				if (/*s_debugToConsole && */s_logEvents)
@@ -1148,9 +1205,9 @@ int32 USoundEmitterComponent::StopLoopUsingStopEvent(
 
 			if (PlayingID == Loop.InitialPlayingID || PlayingID == Loop.LastPlayingID)
 			{
-				if (!Loop.bIsVirtual && IsValid(m_AkComp))
+				if (!Loop.bIsVirtual && HasGameObject())
 				{
-					pID = m_AkComp->PostAkEvent(StopAkEvent, CallbackMask, PostEventCallback);
+					pID = PostAkEventOnGameObject(StopAkEvent, CallbackMask, PostEventCallback);
 				}
 
 				if (/*s_debugToConsole && */s_logEvents)
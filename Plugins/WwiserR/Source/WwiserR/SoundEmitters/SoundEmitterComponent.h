@@ -6,6 +6,7 @@
 #include "SoundEmitterComponentBase.h"
 #include "SoundEmitterComponent.generated.h"
 
+struct FCullingLoopBatch;
 
 // keeps track culling on CharacterMovementComponents
 USTRUCT()
@@ -29,7 +30,8 @@ public:
 	* - handles distance culling
 	*    - one shots: distance check on post event
 	*    - loops:
-			- timer/event based checks based on maximum speed of this emitter and the spatial audio listener
+			- scheduled checks based on maximum speed of this emitter and the spatial audio listener, batched per world by the
+			  DistanceCullingManager
 			- maximum speed of this component is - by default - calculated automatically and updated when either increased or reaching zero.
 			As this requires ticking, this is intended as a fall-back mechanism to ensure correct behaviour, and should be manually
 			overriden whenever possible
@@ -38,14 +40,16 @@ public:
 	* - an AkComponent is spawned only when a sound is posted and within culling range, and destroyed when it's no longer needed
 	*    - a cooldown time can be set to prevent spamming spawning/unspawning AkComponents (e.g. footsteps), or the distance culling system can
 		   be forcibly ignored entirely
-	*    - a simple emitter pool can trivially be implemented later on, however, this comes at the cost of game objects not being named
-		   according to their parent actor/component in the Wwise authoring tool
+	*    - AkComponents are taken from a per world pool when enabled (see AkComponentPoolManager), and renamed after their parent
+		   actor/component in the Wwise profiler on reuse
 **/
 UCLASS(ClassGroup = "WwiserR" , meta = (BlueprintSpawnableComponent))
 class WWISERR_API USoundEmitterComponent : public USoundEmitterComponentBase
 {
 	GENERATED_BODY()
 
+	friend class UDistanceCullingManager;
+
 #pragma region Class Properties
 public:
 	/** Destroys the emiiter when all (at least one) events have stopped playing */
@@ -99,11 +103,13 @@ public:
 #pragma region Member Variables
 private:
 	TArray<FPlayingAudioLoop> m_culledPlayingLoops{};
-	FTimerHandle m_timerNextDistanceCull{};
+	UPROPERTY(Transient) class UDistanceCullingManager* m_distanceCullingManager = nullptr;
+	uint32	m_distanceCullSerial = 0;	// invalidates previously scheduled distance culling passes
+	bool	m_bRecullPending = false;	// queued for a full recull, distance culling state is stale until then
 
 	FVector m_lastCullingLocation = FVector::ZeroVector;
 	bool	m_bMustRecalculateAllLoopCullTimes = false;
-	float	m_nextCullTime = INFINITY;
+	double	m_nextCullTime = INFINITY;
 	int		m_nextCullIndex = 0;
 
 	FCharachterMovementData m_characterMovementData{};
@@ -152,6 +158,7 @@ private:
 
 	/** schedules the next distance culling pass for loop m_culledPlayingLoops[m_NextCullIndex] at time m_nextCullTime */
 	bool ScheduleNextDistanceCulling();
+	UDistanceCullingManager* GetDistanceCullingManager();
 
 	/** culls the currently cued loop, and selects the next loop to be culled */
 	virtual void DistanceCull();
@@ -161,11 +168,18 @@ private:
 	void VirtualizeLoop(FPlayingAudioLoop& Loop);
 	int32 DevirtualizeLoop(FPlayingAudioLoop& Loop);
 
-	float CalculateAndSetNextLoopCullTime(FPlayingAudioLoop& Loop);
+	double CalculateAndSetNextLoopCullTime(FPlayingAudioLoop& Loop);
 	void OnListenersUpdated() override;
 
+	/** adds the loop(s) due for culling to the distance culling batch. Returns false if this emitter must be culled individually */
+	virtual bool AddLoopsToCullingBatch(FCullingLoopBatch& LoopBatch, TArray<int32>& LoopIndices);
+	/** applies batch results: (de)virtualizes the cued loop, sets next cull times (batch results are intervals) and reschedules */
+	void ApplyCullingBatchResults(const FCullingLoopBatch& LoopBatch, const TArray<int32>& LoopIndices, int32 FirstRecord, int32 NumRecords);
+
 protected:
 	virtual void RecullAllLoops();
+	/** queues a recull of all loops on the distance culling manager, amortized over multiple frames with other emitters */
+	void RequestRecullAllLoops();
 	virtual void UpdateDistanceCullingRelativeMaxSpeed();
 #pragma endregion
 
@@ -183,6 +197,9 @@ public:
 	UFUNCTION(BlueprintCosmetic)
 	virtual void OnListenerTeleported();
 
+	/** true while a queued recull of all loops is pending, e.g. after the listener teleported */
+	FORCEINLINE bool IsDistanceCullingStale() const { return m_bRecullPending; }
+
 	/** gets the most recent PlayingId of a loop event posted on this emitter */
 	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category = "WwiserR|Sound Emitter|Events|Loop")
 	virtual int32 GetLoopLastPlayingID(int32 InitialPlayingID);
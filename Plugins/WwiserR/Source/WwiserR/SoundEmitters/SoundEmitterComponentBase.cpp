@@ -8,10 +8,21 @@
 #include "AkSwitchValue.h"
 #include "AkAuxBus.h"
 #include "AkSpotReflector.h"
+#include "AkRtpc.h"
+#include "AkTrigger.h"
+#include "AkComponentCallbackManager.h"
 #include "WwiseSoundEngine/Public/Wwise/API/WwiseSoundEngineAPI.h"
+#include "Wwise/API/WwiseSpatialAudioAPI.h"
+#include "Engine/LatentActionManager.h"
+#include "Async/Async.h"
 #include "Core/AudioSubsystem.h"
 #include "Core/AudioUtils.h"
 #include "Managers/SoundListenerManager.h"
+#include "Managers/AkComponentPoolManager.h"
+#include "Managers/GameObjectPositionManager.h"
+#include "Managers/OneShotQueueManager.h"
+#include "Managers/RepeatingOneShotManager.h"
+#include "Managers/RtpcFlushManager.h"
 #include "WorldSoundListenerComponent.h"
 //#include "SpatialAudio/SpatialAudioVolume.h"
 
@@ -21,6 +32,9 @@
 #include "Kismet/GameplayStatics.h"
 #endif
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rtpcs Written"), STAT_WwiserR_RtpcsWritten, STATGROUP_WwiserR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rtpcs Sent"), STAT_WwiserR_RtpcsSent, STATGROUP_WwiserR);
+
 #pragma region CVars
 namespace Private_SoundEmitterComponentBase
 {
@@ -102,11 +116,13 @@ URepeatingOneShot::URepeatingOneShot()
 
 void URepeatingOneShot::BeginDestroy()
 {
-	if (UWorld* world = GetWorld())
+	if (URepeatingOneShotManager* repeatingOneShotManager = GetRepeatingOneShotManager())
 	{
-		world->GetTimerManager().ClearAllTimersForObject(this);
+		repeatingOneShotManager->Remove(m_handle);
 	}
 
+	m_handle.Invalidate();
+
 	if (IsValid(OwningSoundEmitterComponent))
 	{
 		OwningSoundEmitterComponent->m_repeatingOneShots.Remove(this);
@@ -140,6 +156,11 @@ void URepeatingOneShot::OnAkPostEventCallback(EAkCallbackType CallbackType, UAkC
 {
 	if (CallbackType == EAkCallbackType::EndOfEvent)
 	{
+		if (URepeatingOneShotManager* repeatingOneShotManager = GetRepeatingOneShotManager())
+		{
+			repeatingOneShotManager->OnOneShotEnded(m_handle);
+		}
+
 		OnEndOneShot(CallbackInfo);
 		ActivePlayingID = AK_INVALID_PLAYING_ID;
 	}
@@ -212,85 +233,32 @@ void URepeatingOneShot::OnEndRepeatingOneShot()
 		WR_DBG_FUNC(Log, "Repeating OneShot ended: %s", *RepeatableOneShot.AkEvent->GetName());
 	}
 
-	RepeatingOneShotEndedCallback.ExecuteIfBound(this);
-	ConditionalBeginDestroy();
-}
-
-void URepeatingOneShot::PostRepeatingOneShotInternal()
-{
-	// this should not happen, just keeping it here for a while to check
-	if (!IsValid(RepeatableOneShot.AkEvent))
-	{
-		WR_DBG_FUNC(Error, "AkEvent invalid");
-		return;
-	}
-
-	// this should not happen, just keeping it here for a while to check
-	if (!IsValid(OwningSoundEmitterComponent))
+	if (URepeatingOneShotManager* repeatingOneShotManager = GetRepeatingOneShotManager())
 	{
-		WR_DBG_FUNC(Error, "OwningSoundEmitterComponent invalid");
-		return;
-	}
-
-	bool bShouldBlockOverlap = false;
-	if (RepeatableOneShot.bBlockOverlaps)
-	{
-		if (ActivePlayingID != AK_INVALID_PLAYING_ID)
-		{
-			bShouldBlockOverlap = true;
-		}
+		repeatingOneShotManager->Remove(m_handle);
 	}
 
-	if (!bShouldBlockOverlap)
-	{
-		const int callbackMask = bPostAkPostEventCallbackOnEndOfEvent ? CallbackMask : CallbackMask + 1;
-
-		ActivePlayingID = OwningSoundEmitterComponent->PostOneShot(RepeatableOneShot.AkEvent, callbackMask,
-			AkPostEventCallbackInternal, AttenuationRangeBuffer, bQueryAndPostEnvironmentSwitches);
+	m_handle.Invalidate();
 
-		if (RepetitionsLeft > 0)
-		{
-			RepetitionsLeft--;
-		}
-
-		if (ActivePlayingID != AK_INVALID_PLAYING_ID)
-		{
-			OnStartOneShot(ActivePlayingID);
-		}
-		else if (RepetitionsLeft == 0)
-		{
-			OnEndRepeatingOneShot();
-		}
-	}
+	RepeatingOneShotEndedCallback.ExecuteIfBound(this);
+	ConditionalBeginDestroy();
+}
 
-	if (!RepeatableOneShot.bShouldRepeat)
-	{
-		RepetitionsLeft = 0;
-	}
+void URepeatingOneShot::OnScheduledOneShotPosted(AkPlayingID PlayingID, int32 a_RepetitionsLeft)
+{
+	ActivePlayingID = PlayingID;
+	RepetitionsLeft = a_RepetitionsLeft;
 
-	if (RepetitionsLeft != 0)
+	if (ActivePlayingID != AK_INVALID_PLAYING_ID)
 	{
-		ScheduleNextRepeatingOneShot();
+		OnStartOneShot(ActivePlayingID);
 	}
 }
 
-void URepeatingOneShot::ScheduleNextRepeatingOneShot()
+URepeatingOneShotManager* URepeatingOneShot::GetRepeatingOneShotManager() const
 {
-	const float timeBeforePostingNextEvent = FMath::RandRange(RepeatableOneShot.MinTimeInterval, RepeatableOneShot.MaxTimeInterval);
-
-	if (UWorld* world = GetWorld())
-	{
-		if (timeBeforePostingNextEvent > 0.f)
-		{
-			world->GetTimerManager().SetTimer(m_nextPostAkEventTimeHandle, this, &URepeatingOneShot::PostRepeatingOneShotInternal,
-				timeBeforePostingNextEvent, false);
-		}
-		else
-		{
-			world->GetTimerManager().ClearTimer(m_nextPostAkEventTimeHandle);
-			world->GetTimerManager().SetTimerForNextTick(this, &URepeatingOneShot::PostRepeatingOneShotInternal);
-		}
-	}
+	UAudioSubsystem* audioSubsystem = UAudioSubsystem::Get(OwningSoundEmitterComponent);
+	return audioSubsystem ? audioSubsystem->GetRepeatingOneShotManager() : nullptr;
 }
 
 void URepeatingOneShot::Initialize(USoundEmitterComponentBase* a_Owner, UAkAudioEvent* a_AkEvent, int32 a_CallbackMask,
@@ -340,32 +308,35 @@ void URepeatingOneShot::Initialize(USoundEmitterComponentBase* a_Owner, const FR
 
 bool URepeatingOneShot::Play()
 {
-	if (IsValid(OwningSoundEmitterComponent) && IsValid(RepeatableOneShot.AkEvent))
-	{
-		static const FName funcOnAkPostEventCallback = FName(TEXT("OnAkPostEventCallback"));
-		AkPostEventCallbackInternal.BindUFunction(this, funcOnAkPostEventCallback);
+	if (!IsValid(OwningSoundEmitterComponent) || !IsValid(RepeatableOneShot.AkEvent)) { return false; }
 
-		OnStartRepeatingOneShot();
-		PostRepeatingOneShotInternal();
-		return true;
-	}
+	URepeatingOneShotManager* repeatingOneShotManager = GetRepeatingOneShotManager();
+	if (!IsValid(repeatingOneShotManager)) { return false; }
 
-	return false;
+	static const FName funcOnAkPostEventCallback = FName(TEXT("OnAkPostEventCallback"));
+	AkPostEventCallbackInternal.BindUFunction(this, funcOnAkPostEventCallback);
+
+	OnStartRepeatingOneShot();
+
+	FRepeatingOneShotEntry entry(OwningSoundEmitterComponent, RepeatableOneShot, AttenuationRangeBuffer, bQueryAndPostEnvironmentSwitches);
+	entry.RepetitionsLeft = RepetitionsLeft;
+	entry.Wrapper = this;
+	repeatingOneShotManager->Start(MoveTemp(entry));
+
+	return true;
 }
 
 void URepeatingOneShot::Pause(bool bStopPlayingEventImmediately, int32 TransitionDurationInMs, EAkCurveInterpolation FadeCurve)
 {
 	bIsPaused = RepetitionsLeft != 0;
-	GetWorld()->GetTimerManager().ClearTimer(m_nextPostAkEventTimeHandle);
+	const bool bIsPlaying = IsPlaying();
 
-	if (IsPlaying())
+	if (URepeatingOneShotManager* repeatingOneShotManager = GetRepeatingOneShotManager())
 	{
-		if (bStopPlayingEventImmediately)
-		{
-			OwningSoundEmitterComponent->StopOneShotByPlayingId(ActivePlayingID, TransitionDurationInMs, FadeCurve);
-		}
+		repeatingOneShotManager->Pause(m_handle, bStopPlayingEventImmediately, TransitionDurationInMs, FadeCurve);
 	}
-	else
+
+	if (!bIsPlaying)
 	{
 		OnPauseRepeatingOneShot();
 	}
@@ -377,7 +348,11 @@ bool URepeatingOneShot::Resume()
 	{
 		bIsPaused = false;
 		OnResumeRepeatingOneShot();
-		ScheduleNextRepeatingOneShot();
+
+		if (URepeatingOneShotManager* repeatingOneShotManager = GetRepeatingOneShotManager())
+		{
+			repeatingOneShotManager->Resume(m_handle);
+		}
 
 		return true;
 	}
@@ -393,16 +368,12 @@ bool URepeatingOneShot::End(bool bStopPlayingEventImmediately, int32 TransitionD
 	}
 
 	RepetitionsLeft = 0;
-	GetWorld()->GetTimerManager().ClearTimer(m_nextPostAkEventTimeHandle);
 
-	if (IsPlaying())
-	{
-		if (bStopPlayingEventImmediately)
-		{
-			OwningSoundEmitterComponent->StopOneShotByPlayingId(ActivePlayingID, TransitionDurationInMs, FadeCurve);
-		}
-	}
-	else
+	URepeatingOneShotManager* repeatingOneShotManager = GetRepeatingOneShotManager();
+
+	// ends through OnEndRepeatingOneShot, now or when the playing one shot ended
+	if (!IsValid(repeatingOneShotManager) || !repeatingOneShotManager->End(m_handle, bStopPlayingEventImmediately, TransitionDurationInMs,
+		FadeCurve))
 	{
 		OnEndRepeatingOneShot();
 	}
@@ -424,6 +395,9 @@ USoundEmitterComponentBase::USoundEmitterComponentBase()
 	PrimaryComponentTick.bAllowTickOnDedicatedServer = false;
 	PrimaryComponentTick.bStartWithTickEnabled = false;
 
+	// enabled while a lightweight game object is registered, to push its position
+	bWantsOnUpdateTransform = false;
+
 #if !UE_BUILD_SHIPPING
 	m_debugOneShotEvents.Empty();
 #endif
@@ -472,9 +446,9 @@ void USoundEmitterComponentBase::InitializeInitialSwitches()
 	{
 		m_activeSwitches.Add(switchValue->GetGroupID(), switchValue);
 
-		if (IsValid(m_AkComp))
+		if (HasGameSyncTargets())
 		{
-			m_AkComp->SetSwitch(switchValue, FString(), FString());
+			SetSwitchOnGameObject(switchValue);
 		}
 	}
 }
@@ -490,16 +464,37 @@ void USoundEmitterComponentBase::EndPlay(const EEndPlayReason::Type EndPlayReaso
 		GetListenerManager()->OnListenersUpdated.RemoveAll(this);
 		GetListenerManager()->OnAllWorldListenersRemoved.RemoveAll(this);
 
+		StopDeferringPositionUploads();
+
 		if (bStopWhenOwnerDestroyed)
 		{
-			if (IsValid(m_AkComp))
+			if (HasGameObject())
 			{
-				if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
+				StopGameObject();
+				DestroyAkComponent();
+			}
+		}
+		else if (IsLightweightGameObjectRegistered())
+		{
+			// events of an unregistered game object play out at its last position
+			UnregisterLightweightGameObject();
+		}
+		else if (m_isAkCompPooled && IsValid(m_AkComp))
+		{
+			// let the pooled AkComponent finish playing before it returns to the pool
+			if (UAudioSubsystem* audioSubsystem = UAudioSubsystem::Get(this))
+			{
+				if (UAkComponentPoolManager* akComponentPoolManager = audioSubsystem->GetAkComponentPoolManager())
 				{
-					AkAudioDevice->StopGameObject(m_AkComp);
-				}
+					if (m_AkComp->OnAllEventsEnded.IsBoundToObject(this))
+					{
+						m_AkComp->OnAllEventsEnded.Unbind();
+					}
 
-				DestroyAkComponent();
+					akComponentPoolManager->ReleaseAkComponentWhenDone(m_AkComp);
+					m_AkComp = nullptr;
+					m_isAkCompPooled = false;
+				}
 			}
 		}
 
@@ -511,6 +506,19 @@ void USoundEmitterComponentBase::EndPlay(const EEndPlayReason::Type EndPlayReaso
 		{
 			repeatingOneShot->EndPlay();
 		}
+
+		if (!m_scheduledRepeatingOneShots.IsEmpty())
+		{
+			if (URepeatingOneShotManager* repeatingOneShotManager = UAudioSubsystem::Get(this)->GetRepeatingOneShotManager())
+			{
+				TArray<FRepeatingOneShotHandle> toStop = MoveTemp(m_scheduledRepeatingOneShots);
+
+				for (const FRepeatingOneShotHandle& handle : toStop)
+				{
+					repeatingOneShotManager->End(handle, true, 0, EAkCurveInterpolation::Log1);
+				}
+			}
+		}
 	}
 
 	Super::EndPlay(EndPlayReason);
@@ -561,6 +569,45 @@ void USoundEmitterComponentBase::TickComponent(float DeltaTime, ELevelTick TickT
 #endif
 }
 
+bool USoundEmitterComponentBase::TryQueueOneShot(UAkAudioEvent* AkEvent, bool bQueryAndPostEnvironmentSwitches)
+{
+	UAudioSubsystem* audioSubsystem = UAudioSubsystem::Get(this);
+	UOneShotQueueManager* oneShotQueueManager = audioSubsystem ? audioSubsystem->GetOneShotQueueManager() : nullptr;
+	if (!IsValid(oneShotQueueManager)) { return false; }
+
+	oneShotQueueManager->QueueOneShot(this, AkEvent, bQueryAndPostEnvironmentSwitches);
+
+#if !UE_BUILD_SHIPPING
+	if (s_debugToConsole && s_logEvents)
+	{
+		WR_DBG_FUNC(Log, "OneShot queued: %s", *AkEvent->GetName());
+	}
+#endif
+
+	return true;
+}
+
+AkPlayingID USoundEmitterComponentBase::PostQueuedOneShot(UAkAudioEvent* AkEvent, bool bQueryAndPostEnvironmentSwitches)
+{
+	CreateAkComponentIfNeeded();
+
+	if (bQueryAndPostEnvironmentSwitches)
+	{
+		QueryAndPostEnvironmentSwitches();
+	}
+
+	const AkPlayingID playingID = PostAkEventOnGameObject(AkEvent);
+
+#if !UE_BUILD_SHIPPING
+	if (s_debugDraw && Private_SoundEmitterComponentBase::fDebugDrawEvents > 0.f)
+	{
+		m_debugOneShotEvents.Add(FPlayingOneShot(AkEvent, playingID));
+	}
+#endif
+
+	return playingID;
+}
+
 bool USoundEmitterComponentBase::IsInListenerRange(UAkAudioEvent* AkEvent, float RangeBuffer)
 {
 #if WITH_EDITOR // play sounds in (animation sequence) editor
@@ -576,71 +623,48 @@ bool USoundEmitterComponentBase::IsInListenerRange(UAkAudioEvent* AkEvent, float
 	{
 		const float cullRange = AkEvent->MaxAttenuationRadius * AttenuationScalingFactor + innerRadius + RangeBuffer;
 		const float cullRangeSquared = cullRange * cullRange;
+		const FVector cullingLocation = GetCullingLocation();
 
-		// world listeners
-		for (TWeakObjectPtr<UWorldSoundListener> worldListener : GetWorldListeners())
+		// world listeners, default listeners and spatial audio listener
+		for (const FListenerSnapshotEntry& listener : GetListenerManager()->GetListenerSnapshot().Listeners)
 		{
-			if (FVector::DistSquared(GetCullingLocation(), worldListener->GetComponentLocation()) < cullRangeSquared)
+			if (FVector::DistSquared(cullingLocation, listener.Position) < cullRangeSquared)
 			{
 				return true;
 			}
 		}
 
-		// default listeners
-		if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
-		{
-			for (TWeakObjectPtr<UAkComponent> defaultListener : AkAudioDevice->GetDefaultListeners())
-			{
-				if (defaultListener.Get() == AkAudioDevice->GetSpatialAudioListener())
-				{
-					continue;
-				}
-
-				if (FVector::DistSquared(GetCullingLocation(), defaultListener->GetComponentLocation()) < cullRangeSquared)
-				{
-					return true;
-				}
-			}
-		}
-
-		// spatial audio listener
-		return GetListenerManager()->GetSquaredDistanceToDistanceProbe(GetCullingLocation()) < cullRangeSquared;
+		return false;
 	}
 
 	return false;
 }
-TSet<TWeakObjectPtr<UWorldSoundListener>> USoundEmitterComponentBase::GetWorldListeners()
+const TSet<TWeakObjectPtr<UWorldSoundListener>>& USoundEmitterComponentBase::GetWorldListeners()
 {
 	WR_ASSERT(IsValid(GetListenerManager()), "no valid listener manager!")
 	return s_listenerManager->GetWorldListeners();
 }
 void USoundEmitterComponentBase::InitializeListeners()
 {
-	const TSet<TWeakObjectPtr<UWorldSoundListener>> worldListeners = GetWorldListeners();
-	if (worldListeners.IsEmpty()) { return; }
+	const FListenerSnapshot& listenerSnapshot = GetListenerManager()->GetListenerSnapshot();
+	if (listenerSnapshot.NumWorldListeners == 0) { return; }
 
-	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
 	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
-	if (UNLIKELY(!AkAudioDevice || !SoundEngine)) { return; }
-
-	const UAkComponentSet defaultListeners = AkAudioDevice->GetDefaultListeners();
-	const int numDefaultListeners = defaultListeners.Num();
-	const int numWorldListeners = worldListeners.Num();
-	const int numListeners = numDefaultListeners + numWorldListeners;
-
-	auto pListenerIds = (AkGameObjectID*)alloca(numListeners * sizeof(AkGameObjectID));
+	if (UNLIKELY(!SoundEngine)) { return; }
 
-	for (int i = 0; i < numDefaultListeners; i++)
-	{
-		pListenerIds[i] = defaultListeners.Array()[i]->GetAkGameObjectID();
-	}
+	auto pListenerIds = (AkGameObjectID*)alloca(listenerSnapshot.Listeners.Num() * sizeof(AkGameObjectID));
+	int numListeners = 0;
 
-	for (int i = 0; i < numWorldListeners; i++)
+	for (const FListenerSnapshotEntry& listener : listenerSnapshot.Listeners)
 	{
-		pListenerIds[i + numWorldListeners] = worldListeners.Array()[i]->GetAkGameObjectID();
+		if (listener.GameObjectID != AK_INVALID_GAME_OBJECT)
+		{
+			pListenerIds[numListeners] = listener.GameObjectID;
+			numListeners++;
+		}
 	}
 
-	SoundEngine->SetListeners(m_AkComp->GetAkGameObjectID(), pListenerIds, numListeners);
+	SoundEngine->SetListeners(GetAkGameObjectID(), pListenerIds, numListeners);
 }
 #pragma endregion
 
@@ -660,207 +684,674 @@ bool USoundEmitterComponentBase::CreateAkComponentIfNeeded()
 		m_isPendingUnregistration = false;
 	}
 
-	if (IsValid(m_AkComp))
+	if (HasGameObject())
+	{
+		return false;
+	}
+
+	if (CanUseLightweightGameObject())
+	{
+		RegisterLightweightGameObject();
+		if (!IsLightweightGameObjectRegistered()) { return false; }
+
+		DeferPositionUploads();
+		InitializeLightweightGameObject();
+
+#if !UE_BUILD_SHIPPING
+		OnDebugDrawChanged();
+#endif
+
+		return true;
+	}
+
+	UAkComponentPoolManager* akComponentPoolManager = nullptr;
+
+	if (UAudioSubsystem* audioSubsystem = UAudioSubsystem::Get(this))
+	{
+		akComponentPoolManager = audioSubsystem->GetAkComponentPoolManager();
+	}
+
+	m_isAkCompPooled = IsValid(akComponentPoolManager) && IsValid(world);
+
+	if (m_isAkCompPooled)
+	{
+		m_AkComp = akComponentPoolManager->AcquireAkComponent(this);
+		check(m_AkComp);
+	}
+	else
+	{
+		m_AkComp = NewObject<UAkComponent>(this, *GetName());
+		check(m_AkComp);
+
+		if (IsValid(world))
+		{
+			m_AkComp->RegisterComponentWithWorld(world);
+		}
+		else
+		{
+			m_AkComp->RegisterComponent();
+		}
+
+		m_AkComp->AttachToComponent(this, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+	}
+
+	DeferPositionUploads();
+
+	if (!IsUnregistrationForbidden() && !m_AkComp->OnAllEventsEnded.IsBoundToObject(this))
+	{
+		m_AkComp->OnAllEventsEnded.BindUObject(this, &USoundEmitterComponentBase::ScheduleUnregistration);
+	}
+
+	InitializeAkComponent();
+
+	//*** tick for visual debugging ***/
+#if !UE_BUILD_SHIPPING
+	OnDebugDrawChanged();
+#endif
+
+	return true;
+}
+
+bool USoundEmitterComponentBase::DestroyAkComponent()
+{
+	StopDeferringPositionUploads();
+
+	if (IsLightweightGameObjectRegistered())
+	{
+		UnregisterLightweightGameObject();
+
+		if (s_debugToConsole)
+		{
+			WR_DBG_FUNC(Log, "lightweight game object unregistered");
+		}
+
+#if !UE_BUILD_SHIPPING
+		OnDebugDrawChanged();
+#endif
+
+		return true;
+	}
+
+	if (!IsValid(m_AkComp))
+	{
+		return false;
+	}
+
+	if (m_AkComp->OnAllEventsEnded.IsBoundToObject(this))
+	{
+		m_AkComp->OnAllEventsEnded.Unbind();
+	}
+
+	UAkComponentPoolManager* akComponentPoolManager = nullptr;
+
+	if (UAudioSubsystem* audioSubsystem = UAudioSubsystem::Get(this))
+	{
+		akComponentPoolManager = audioSubsystem->GetAkComponentPoolManager();
+	}
+
+	if (m_isAkCompPooled && IsValid(akComponentPoolManager))
+	{
+		akComponentPoolManager->ReleaseAkComponent(m_AkComp);
+	}
+	else
+	{
+		m_AkComp->DestroyComponent();
+	}
+
+	m_AkComp = nullptr;
+	m_isAkCompPooled = false;
+
+	if (s_debugToConsole)
+	{
+		WR_DBG_FUNC(Log, "AkComponent destroyed");
+	}
+
+#if !UE_BUILD_SHIPPING
+	//SetComponentTickEnabled(false);
+	OnDebugDrawChanged();
+#endif
+
+	return true;
+}
+
+void USoundEmitterComponentBase::ScheduleUnregistration(const UAkComponent* AkComponent)
+{
+	WR_ASSERT(AkComponent == m_AkComp, "trying to unregister an AkComponent that was not registered");
+
+#if !UE_BUILD_SHIPPING
+	m_debugOneShotEvents.Empty();
+#endif
+
+	if (m_isPendingUnregistration || IsUnregistrationForbidden())
+	{
+		return;
+	}
+
+	if (UnregistrationCooldown <= 0.f)
+	{
+		UnregisterEmitterIfInactive();
+	}
+	else
+	{
+		FTimerDelegate timerDelegate;
+		GetWorld()->GetTimerManager().SetTimer(
+			m_timerNextUnregistration, this, &USoundEmitterComponentBase::CallUnregisterEmitterIfInactive, UnregistrationCooldown, false);
+
+		m_isPendingUnregistration = true;
+	}
+}
+
+bool USoundEmitterComponentBase::UnregisterEmitterIfInactive()
+{
+	if (IsUnregistrationForbidden() || !HasGameObject() || HasActiveGameObjectEvents())
+	{
+		return false;
+	}
+
+	DestroyAkComponent();
+	m_isPendingUnregistration = false;
+	return true;
+}
+
+void USoundEmitterComponentBase::InitializeAkComponent()
+{
+	m_AkComp->SetAutoDestroy(false);
+	m_AkComp->SetStopWhenOwnerDestroyed(bStopWhenOwnerDestroyed);
+/*
+#if !WITH_EDITOR
+	m_AkComp->SetListeners(UAudioUtils::WeakObjectPtrSetToArray(m_listeners));
+#endif*/
+
+
+	if (AttenuationScalingFactor >= 0.f && AttenuationScalingFactor != 1.0f) // && AttenuationScalingFactor > 0.f)
+	{
+		m_AkComp->SetAttenuationScalingFactor(AttenuationScalingFactor);
+	}
+
+	m_AkComp->OcclusionCollisionChannel = OcclusionCollisionChannel;
+	m_AkComp->OcclusionRefreshInterval = OcclusionRefreshInterval;
+	m_AkComp->bUseReverbVolumes = bUseReverbVolumes;
+	m_AkComp->SetEnableSpotReflectors(bEnableSpotReflectors);
+	m_AkComp->SetGameObjectRadius(outerRadius, innerRadius);
+
+	m_AkComp->DrawFirstOrderReflections = DrawFirstOrderReflections;
+	m_AkComp->DrawSecondOrderReflections = DrawSecondOrderReflections;
+	m_AkComp->DrawHigherOrderReflections = DrawHigherOrderReflections;
+	m_AkComp->DrawDiffraction = DrawDiffraction;
+
+	//InitializeListeners();
+	UWorldSoundListener::UpdateSoundEmitterSendLevels(m_AkComp);
+
+	if (s_debugToConsole)
+	{
+		WR_DBG_FUNC(Log, "AkComponent initialized");
+	}
+
+	InitializeGameSynchs();
+}
+
+void USoundEmitterComponentBase::InitializeGameSynchs()
+{
+	WR_ASSERT(HasGameObject(), "trying to initialize gamesynchs without a registered game object");
+
+	/*for (const UAkSwitchValue* Switch : PersistentSwitches)
+	{
+		m_AkComp->SetSwitch(Switch, FString(), FString());
+
+		if (s_debugToConsole && Private_SoundEmitterComponentBase::bLogGameSynchs)
+		{
+			WR_DBG_FUNC(Log, "initializing persistent Switch: %s ", *Switch->GetFullName());
+		}
+	}*/
+
+	for (const TPair<AkSwitchGroupID, UAkSwitchValue*>& activeSwitch : m_activeSwitches)
+	{
+		SetSwitchOnGameObject(activeSwitch.Value);
+
+		if (s_debugToConsole && Private_SoundEmitterComponentBase::bLogGameSynchs)
+		{
+			WR_DBG_FUNC(Log, "initializing Switch: %s ", *activeSwitch.Value->GetFullName());
+		}
+	}
+
+	// replays the latest values, including those not flushed yet
+	for (const FEmitterRtpc& rtpc : m_rtpcs.Entries)
+	{
+		SetRtpcOnGameObject(rtpc.ShortID, rtpc.Value, 0);
+
+		if (s_debugToConsole && Private_SoundEmitterComponentBase::bLogGameSynchs)
+		{
+			WR_DBG_FUNC(Log, "initializing Rtpc: %s: %f", *rtpc.Rtpc->GetFullName(), rtpc.Value);
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_WwiserR_RtpcsSent, m_rtpcs.Entries.Num());
+	m_rtpcs.ClearDirty();
+}
+
+void USoundEmitterComponentBase::OnListenersUpdated()
+{
+	if (IsValid(m_AkComp))
+	{
+		UWorldSoundListener::UpdateSoundEmitterSendLevels(m_AkComp);
+		//GetListenerManager()->UpdateListeners(m_AkComp);
+	}
+	else if (IsLightweightGameObjectRegistered())
+	{
+		UWorldSoundListener::UpdateSoundEmitterSendLevels(m_lightweightGameObjectID, GetComponentLocation());
+	}
+}
+
+void USoundEmitterComponentBase::OnAllWorldListenersRemoved()
+{
+	if (HasGameObject())
+	{
+		IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+		if (UNLIKELY(SoundEngine == nullptr)) { return; }
+
+		SoundEngine->ResetListenersToDefault(GetAkGameObjectID());
+	}
+}
+#pragma endregion
+
+
+#pragma region Internal - Game Object
+namespace Private_SoundEmitterComponentBase
+{
+	static AkPlayingID PostEventWithCallbackPackage(const AkUniqueID EventShortID, const AkGameObjectID GameObjectID,
+		IAkUserEventCallbackPackage* CallbackPackage, FAkComponentCallbackManager* CallbackManager, AkCallbackFunc Callback)
+	{
+		IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+		if (UNLIKELY(!SoundEngine || !CallbackPackage)) { return AK_INVALID_PLAYING_ID; }
+
+		const AkPlayingID playingID = SoundEngine->PostEvent(EventShortID, GameObjectID, CallbackPackage->uUserFlags | AK_EndOfEvent,
+			Callback, CallbackPackage);
+
+		if (playingID == AK_INVALID_PLAYING_ID)
+		{
+			CallbackManager->RemoveCallbackPackage(CallbackPackage, GameObjectID);
+		}
+
+		return playingID;
+	}
+} // namespace Private_SoundEmitterComponentBase
+
+AkGameObjectID USoundEmitterComponentBase::GetAkGameObjectID() const
+{
+	return IsValid(m_AkComp) ? m_AkComp->GetAkGameObjectID() : m_lightweightGameObjectID;
+}
+
+bool USoundEmitterComponentBase::HasActiveGameObjectEvents() const
+{
+	if (IsValid(m_AkComp))
+	{
+		return m_AkComp->HasActiveEvents();
+	}
+
+	if (IsLightweightGameObjectRegistered())
+	{
+		if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
+		{
+			if (FAkComponentCallbackManager* callbackManager = AkAudioDevice->GetCallbackManager())
+			{
+				return callbackManager->HasActiveEvents(m_lightweightGameObjectID);
+			}
+		}
+	}
+
+	return false;
+}
+
+AkPlayingID USoundEmitterComponentBase::PostAkEventOnGameObject(UAkAudioEvent* AkEvent, int32 CallbackMask,
+	const FOnAkPostEventCallback& PostEventCallback)
+{
+	// events start with the Rtpc values set earlier this frame
+	FlushRtpcs();
+
+	if (IsValid(m_AkComp))
+	{
+		return m_AkComp->PostAkEvent(AkEvent, CallbackMask, PostEventCallback);
+	}
+
+	if (!IsLightweightGameObjectRegistered()) { return AK_INVALID_PLAYING_ID; }
+
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	if (UNLIKELY(!AkAudioDevice)) { return AK_INVALID_PLAYING_ID; }
+
+	FAkComponentCallbackManager* callbackManager = AkAudioDevice->GetCallbackManager();
+	if (UNLIKELY(!callbackManager)) { return AK_INVALID_PLAYING_ID; }
+
+	// the callback manager also keeps track of the active events on the game object
+	IAkUserEventCallbackPackage* callbackPackage =
+		callbackManager->CreateCallbackPackage(PostEventCallback, CallbackMask, m_lightweightGameObjectID, false);
+
+	return Private_SoundEmitterComponentBase::PostEventWithCallbackPackage(
+		AkEvent->GetShortID(), m_lightweightGameObjectID, callbackPackage, callbackManager, &USoundEmitterComponentBase::LightweightGameObjectCallback);
+}
+
+AkPlayingID USoundEmitterComponentBase::PostAkEventOnGameObjectAndWaitForEnd(UAkAudioEvent* AkEvent, FLatentActionInfo LatentInfo)
+{
+	FlushRtpcs();
+
+	if (IsValid(m_AkComp))
+	{
+		return m_AkComp->PostAkEventAndWaitForEnd(AkEvent, LatentInfo);
+	}
+
+	if (!IsLightweightGameObjectRegistered()) { return AK_INVALID_PLAYING_ID; }
+
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	if (UNLIKELY(!AkAudioDevice)) { return AK_INVALID_PLAYING_ID; }
+
+	FAkComponentCallbackManager* callbackManager = AkAudioDevice->GetCallbackManager();
+	if (UNLIKELY(!callbackManager)) { return AK_INVALID_PLAYING_ID; }
+
+	FLatentActionManager& latentActionManager = GetWorld()->GetLatentActionManager();
+	FWaitEndOfEventAction* latentAction =
+		latentActionManager.FindExistingAction<FWaitEndOfEventAction>(LatentInfo.CallbackTarget, LatentInfo.UUID);
+
+	if (latentAction != nullptr) { return AK_INVALID_PLAYING_ID; }
+
+	latentAction = new FWaitEndOfEventAction(LatentInfo);
+	latentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, latentAction);
+
+	IAkUserEventCallbackPackage* callbackPackage = callbackManager->CreateCallbackPackage(latentAction, m_lightweightGameObjectID, false);
+
+	const AkPlayingID playingID = Private_SoundEmitterComponentBase::PostEventWithCallbackPackage(
+		AkEvent->GetShortID(), m_lightweightGameObjectID, callbackPackage, callbackManager, &USoundEmitterComponentBase::LightweightGameObjectCallback);
+
+	if (playingID == AK_INVALID_PLAYING_ID)
+	{
+		latentAction->EventFinished = true;
+	}
+
+	return playingID;
+}
+
+void USoundEmitterComponentBase::SetSwitchOnGameObject(const UAkSwitchValue* AkSwitchValue)
+{
+	if (IsValid(m_AkComp))
+	{
+		m_AkComp->SetSwitch(AkSwitchValue, FString(), FString());
+	}
+	else if (IsLightweightGameObjectRegistered())
+	{
+		SetSwitchOnGameObject(AkSwitchValue->GetGroupID(), AkSwitchValue->GetShortID());
+	}
+}
+
+void USoundEmitterComponentBase::SetSwitchOnGameObject(AkSwitchGroupID SwitchGroupID, AkSwitchStateID SwitchStateID)
+{
+	if (IsValid(m_AkComp))
+	{
+		if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
+		{
+			AkAudioDevice->SetSwitch(SwitchGroupID, SwitchStateID, m_AkComp);
+		}
+	}
+	else if (IsLightweightGameObjectRegistered())
+	{
+		if (IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get())
+		{
+			SoundEngine->SetSwitch(SwitchGroupID, SwitchStateID, m_lightweightGameObjectID);
+		}
+	}
+}
+
+void USoundEmitterComponentBase::SetRtpcOnGameObject(AkRtpcID RtpcID, float Value, int32 InterpolationTimeMs)
+{
+	if (!HasGameObject()) { return; }
+
+	if (IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get())
+	{
+		SoundEngine->SetRTPCValue(RtpcID, Value, GetAkGameObjectID(), InterpolationTimeMs);
+	}
+}
+
+void USoundEmitterComponentBase::ResetRtpcOnGameObject(AkRtpcID RtpcID)
+{
+	if (!HasGameObject()) { return; }
+
+	if (IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get())
 	{
-		return false;
+		SoundEngine->ResetRTPCValue(RtpcID, GetAkGameObjectID());
 	}
+}
 
-	m_AkComp = NewObject<UAkComponent>(this, *GetName());
-	check(m_AkComp);
+void USoundEmitterComponentBase::RequestRtpcFlush()
+{
+	if (m_isRtpcFlushPending) { return; }
 
-	if (IsValid(world))
+	UAudioSubsystem* audioSubsystem = UAudioSubsystem::Get(this);
+	URtpcFlushManager* rtpcFlushManager = audioSubsystem ? audioSubsystem->GetRtpcFlushManager() : nullptr;
+
+	if (IsValid(rtpcFlushManager))
 	{
-		m_AkComp->RegisterComponentWithWorld(world);
+		rtpcFlushManager->AddDirtyEmitter(this);
+		m_isRtpcFlushPending = true;
 	}
 	else
 	{
-		m_AkComp->RegisterComponent();
+		FlushRtpcs();
 	}
+}
 
-	m_AkComp->AttachToComponent(this, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+void USoundEmitterComponentBase::FlushRtpcs()
+{
+	if (!m_rtpcs.HasDirtyEntries()) { return; }
 
-	if (!IsUnregistrationForbidden() && !m_AkComp->OnAllEventsEnded.IsBoundToObject(this))
+	// without a game object, the values are replayed once one is registered
+	if (HasGameSyncTargets())
 	{
-		m_AkComp->OnAllEventsEnded.BindUObject(this, &USoundEmitterComponentBase::ScheduleUnregistration);
-	}
-
-	InitializeAkComponent();
+		for (const FEmitterRtpc& rtpc : m_rtpcs.Entries)
+		{
+			if (rtpc.bDirty)
+			{
+				SetRtpcOnGameObject(rtpc.ShortID, rtpc.Value, rtpc.InterpolationTimeMs);
+			}
+		}
 
-	//*** tick for visual debugging ***/
-#if !UE_BUILD_SHIPPING
-	OnDebugDrawChanged();
-#endif
+		INC_DWORD_STAT_BY(STAT_WwiserR_RtpcsSent, m_rtpcs.NumDirty);
+	}
 
-	return true;
+	m_rtpcs.ClearDirty();
 }
 
-bool USoundEmitterComponentBase::DestroyAkComponent()
+void USoundEmitterComponentBase::StopGameObject()
 {
-	if (!IsValid(m_AkComp))
-	{
-		return false;
-	}
-
-	if (m_AkComp->OnAllEventsEnded.IsBoundToObject(this))
+	if (IsValid(m_AkComp))
 	{
-		m_AkComp->OnAllEventsEnded.Unbind();
+		if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
+		{
+			AkAudioDevice->StopGameObject(m_AkComp);
+		}
 	}
-
-	m_AkComp->DestroyComponent();
-	m_AkComp = nullptr;
-
-	if (s_debugToConsole)
+	else if (IsLightweightGameObjectRegistered())
 	{
-		WR_DBG_FUNC(Log, "AkComponent destroyed");
+		if (IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get())
+		{
+			SoundEngine->StopAll(m_lightweightGameObjectID);
+		}
 	}
-
-#if !UE_BUILD_SHIPPING
-	//SetComponentTickEnabled(false);
-	OnDebugDrawChanged();
-#endif
-
-	return true;
 }
 
-void USoundEmitterComponentBase::ScheduleUnregistration(const UAkComponent* AkComponent)
+void USoundEmitterComponentBase::RegisterLightweightGameObject()
 {
-	WR_ASSERT(AkComponent == m_AkComp, "trying to unregister an AkComponent that was not registered");
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	if (UNLIKELY(!AkAudioDevice)) { return; }
 
-#if !UE_BUILD_SHIPPING
-	m_debugOneShotEvents.Empty();
-#endif
+	// same convention as UAkGameObject, the game object ID is the address of its owner
+	const AkGameObjectID gameObjectID = (AkGameObjectID)this;
 
-	if (m_isPendingUnregistration || IsUnregistrationForbidden())
+	if (AkAudioDevice->RegisterGameObject(gameObjectID, GetFullComponentName()) != AK_Success)
 	{
+		WR_DBG_FUNC(Warning, "could not register lightweight game object");
 		return;
 	}
 
-	if (UnregistrationCooldown <= 0.f)
+	if (FAkComponentCallbackManager* callbackManager = AkAudioDevice->GetCallbackManager())
 	{
-		UnregisterEmitterIfInactive();
+		callbackManager->RegisterGameObject(gameObjectID);
 	}
-	else
-	{
-		FTimerDelegate timerDelegate;
-		GetWorld()->GetTimerManager().SetTimer(
-			m_timerNextUnregistration, this, &USoundEmitterComponentBase::CallUnregisterEmitterIfInactive, UnregistrationCooldown, false);
 
-		m_isPendingUnregistration = true;
+	m_lightweightGameObjectID = gameObjectID;
+	s_lightweightEmitters.Add(gameObjectID, this);
+	bWantsOnUpdateTransform = true;
+
+#if !UE_BUILD_SHIPPING
+	s_dbgNumLightweightGameObjects++;
+
+	if (s_debugToConsole)
+	{
+		WR_DBG_FUNC(Log, "lightweight game object registered (%i registered)", s_dbgNumLightweightGameObjects);
 	}
+#endif
 }
 
-bool USoundEmitterComponentBase::UnregisterEmitterIfInactive()
+void USoundEmitterComponentBase::UnregisterLightweightGameObject()
 {
-	if (IsUnregistrationForbidden() || !IsValid(m_AkComp) || m_AkComp->HasActiveEvents())
+	if (!IsLightweightGameObjectRegistered()) { return; }
+
+	if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
 	{
-		return false;
+		AkAudioDevice->UnregisterComponent(m_lightweightGameObjectID);
 	}
 
-	DestroyAkComponent();
-	m_isPendingUnregistration = false;
-	return true;
+	s_lightweightEmitters.Remove(m_lightweightGameObjectID);
+	m_lightweightGameObjectID = AK_INVALID_GAME_OBJECT;
+	bWantsOnUpdateTransform = false;
+
+#if !UE_BUILD_SHIPPING
+	s_dbgNumLightweightGameObjects--;
+#endif
 }
 
-void USoundEmitterComponentBase::InitializeAkComponent()
+void USoundEmitterComponentBase::InitializeLightweightGameObject()
 {
-	m_AkComp->SetAutoDestroy(false);
-	m_AkComp->SetStopWhenOwnerDestroyed(bStopWhenOwnerDestroyed);
-/*
-#if !WITH_EDITOR
-	m_AkComp->SetListeners(UAudioUtils::WeakObjectPtrSetToArray(m_listeners));
-#endif*/
-
-
-	if (AttenuationScalingFactor >= 0.f && AttenuationScalingFactor != 1.0f) // && AttenuationScalingFactor > 0.f)
+	if (!m_isPositionUploadDeferred)
 	{
-		m_AkComp->SetAttenuationScalingFactor(AttenuationScalingFactor);
+		UpdateLightweightGameObjectPosition();
 	}
 
-	m_AkComp->OcclusionCollisionChannel = OcclusionCollisionChannel;
-	m_AkComp->OcclusionRefreshInterval = OcclusionRefreshInterval;
-	m_AkComp->bUseReverbVolumes = bUseReverbVolumes;
-	m_AkComp->SetEnableSpotReflectors(bEnableSpotReflectors);
-	m_AkComp->SetGameObjectRadius(outerRadius, innerRadius);
+	if (AttenuationScalingFactor >= 0.f && AttenuationScalingFactor != 1.0f)
+	{
+		if (IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get())
+		{
+			SoundEngine->SetScalingFactor(m_lightweightGameObjectID, AttenuationScalingFactor);
+		}
+	}
 
-	m_AkComp->DrawFirstOrderReflections = DrawFirstOrderReflections;
-	m_AkComp->DrawSecondOrderReflections = DrawSecondOrderReflections;
-	m_AkComp->DrawHigherOrderReflections = DrawHigherOrderReflections;
-	m_AkComp->DrawDiffraction = DrawDiffraction;
+	if (outerRadius > 0.f)
+	{
+		if (IWwiseSpatialAudioAPI* SpatialAudio = IWwiseSpatialAudioAPI::Get())
+		{
+			SpatialAudio->SetGameObjectRadius(m_lightweightGameObjectID, outerRadius, innerRadius);
+		}
+	}
 
-	//InitializeListeners();
-	UWorldSoundListener::UpdateSoundEmitterSendLevels(m_AkComp);
+	UWorldSoundListener::UpdateSoundEmitterSendLevels(m_lightweightGameObjectID, GetComponentLocation());
 
 	if (s_debugToConsole)
 	{
-		WR_DBG_FUNC(Log, "AkComponent initialized");
+		WR_DBG_FUNC(Log, "lightweight game object initialized");
 	}
 
 	InitializeGameSynchs();
 }
 
-void USoundEmitterComponentBase::InitializeGameSynchs()
+void USoundEmitterComponentBase::UpdateLightweightGameObjectPosition()
 {
-	WR_ASSERT(IsValid(m_AkComp), "trying to initialize gamesynchs without a valid AkComponent");
+	FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (UNLIKELY(!AkAudioDevice || !SoundEngine)) { return; }
 
-	/*for (const UAkSwitchValue* Switch : PersistentSwitches)
-	{
-		m_AkComp->SetSwitch(Switch, FString(), FString());
+	AkSoundPosition soundPosition;
+	const FQuat orientation = GetComponentQuat();
+	AkAudioDevice->FVectorsToAKWorldTransform(GetComponentLocation(), orientation.GetForwardVector(), orientation.GetUpVector(), soundPosition);
+	SoundEngine->SetPosition(m_lightweightGameObjectID, soundPosition);
+}
 
-		if (s_debugToConsole && Private_SoundEmitterComponentBase::bLogGameSynchs)
-		{
-			WR_DBG_FUNC(Log, "initializing persistent Switch: %s ", *Switch->GetFullName());
-		}
-	}*/
+void USoundEmitterComponentBase::OnLightweightGameObjectEventEnded()
+{
+	if (!IsLightweightGameObjectRegistered() || IsUnregistrationForbidden() || HasActiveGameObjectEvents()) { return; }
 
-	for (const TPair<AkSwitchGroupID, UAkSwitchValue*>& activeSwitch : m_activeSwitches)
-	{
-		m_AkComp->SetSwitch(activeSwitch.Value, FString(), FString());
+	ScheduleUnregistration(nullptr);
+}
 
-		if (s_debugToConsole && Private_SoundEmitterComponentBase::bLogGameSynchs)
-		{
-			WR_DBG_FUNC(Log, "initializing Switch: %s ", *activeSwitch.Value->GetFullName());
-		}
-	}
+void USoundEmitterComponentBase::LightweightGameObjectCallback(AkCallbackType CallbackType, AkCallbackInfo* CallbackInfo)
+{
+	// keeps track of the active events on the game object and calls the user callbacks
+	FAkComponentCallbackManager::AkComponentCallback(CallbackType, CallbackInfo);
+
+	if (CallbackType != AK_EndOfEvent || CallbackInfo == nullptr) { return; }
 
-	for (const FActiveRtpc& Rtpc : m_activeRtpcs)
+	// lightweight game objects have no AkComponent tick to report the end of their events
+	const AkGameObjectID gameObjectID = CallbackInfo->gameObjID;
+
+	AsyncTask(ENamedThreads::GameThread, [gameObjectID]()
 	{
-		{
-			m_AkComp->SetRTPCValue(Rtpc.Rtpc, Rtpc.Value, 0, FString());
-		}
+		const TWeakObjectPtr<USoundEmitterComponentBase>* emitter = s_lightweightEmitters.Find(gameObjectID);
 
-		if (s_debugToConsole && Private_SoundEmitterComponentBase::bLogGameSynchs)
+		if (emitter != nullptr && emitter->IsValid())
 		{
-			WR_DBG_FUNC(Log, "initializing Rtpc: %s: %f", *Rtpc.Rtpc->GetFullName(), Rtpc.Value);
+			(*emitter)->OnLightweightGameObjectEventEnded();
 		}
-	}
+	});
 }
 
-void USoundEmitterComponentBase::OnListenersUpdated()
+void USoundEmitterComponentBase::DeferPositionUploads()
 {
+	if (!CanDeferPositionUploads()) { return; }
+
+	UAudioSubsystem* audioSubsystem = UAudioSubsystem::Get(this);
+	UGameObjectPositionManager* positionManager = audioSubsystem ? audioSubsystem->GetGameObjectPositionManager() : nullptr;
+	if (!IsValid(positionManager)) { return; }
+
 	if (IsValid(m_AkComp))
 	{
-		UWorldSoundListener::UpdateSoundEmitterSendLevels(m_AkComp);
-		//GetListenerManager()->UpdateListeners(m_AkComp);
+		positionManager->RegisterComponent(m_AkComp);
+		m_isPositionUploadDeferred = true;
+	}
+	else if (IsLightweightGameObjectRegistered())
+	{
+		// the lightweight game object ID is the address of this component
+		positionManager->RegisterComponent(this);
+		m_isPositionUploadDeferred = true;
 	}
 }
 
-void USoundEmitterComponentBase::OnAllWorldListenersRemoved()
+void USoundEmitterComponentBase::StopDeferringPositionUploads()
 {
-	if (IsValid(m_AkComp))
+	if (!m_isPositionUploadDeferred) { return; }
+	m_isPositionUploadDeferred = false;
+
+	UAudioSubsystem* audioSubsystem = UAudioSubsystem::Get(this);
+	UGameObjectPositionManager* positionManager = audioSubsystem ? audioSubsystem->GetGameObjectPositionManager() : nullptr;
+	if (!IsValid(positionManager)) { return; }
+
+	if (m_AkComp)
 	{
-		IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
-		if (UNLIKELY(SoundEngine == nullptr)) { return; }
+		positionManager->UnregisterComponent(m_AkComp);
+	}
+
+	positionManager->UnregisterComponent(this);
+}
+
+void USoundEmitterComponentBase::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
 
-		SoundEngine->ResetListenersToDefault(m_AkComp->GetAkGameObjectID());
+	if (IsLightweightGameObjectRegistered() && !m_isPositionUploadDeferred)
+	{
+		UpdateLightweightGameObjectPosition();
 	}
 }
 #pragma endregion
 
-
 #pragma region Internal - Debug
 void USoundEmitterComponentBase::OnDebugDrawChanged()
 {
-	SetComponentTickEnabled(s_debugDraw && IsValid(m_AkComp));
+	SetComponentTickEnabled(s_debugDraw && HasGameObject());
 }
 
 #if !UE_BUILD_SHIPPING
@@ -885,7 +1376,7 @@ void USoundEmitterComponentBase::DebugDrawOnTick(UWorld* World)
 	FString msgDebugText;
 
 	// add text: distance
-	if (IsValid(m_AkComp) && ShouldDrawDebug(Private_SoundEmitterComponentBase::fDebugDrawDistance, dbgDistSquared))
+	if (HasGameObject() && ShouldDrawDebug(Private_SoundEmitterComponentBase::fDebugDrawDistance, dbgDistSquared))
 	{
 		msgDebugText.Append(FString::Printf(TEXT("%.2f m\n"), dbgDistInMeters));
 		bDrawText = true;
@@ -908,7 +1399,7 @@ void USoundEmitterComponentBase::DebugDrawOnTick(UWorld* World)
 	// draw registered emitters
 	if (ShouldDrawDebug(Private_SoundEmitterComponentBase::fDebugDrawRegistration, dbgDistSquared))
 	{
-		if (IsValid(m_AkComp) && m_AkComp->HasBeenRegisteredWithWwise())
+		if (IsLightweightGameObjectRegistered() || (IsValid(m_AkComp) && m_AkComp->HasBeenRegisteredWithWwise()))
 		{
 			const FVector componentLocation = GetComponentLocation();
 			const float emitterScale = 12.f * dbgEmitterScale / scaleFactor;
@@ -918,7 +1409,7 @@ void USoundEmitterComponentBase::DebugDrawOnTick(UWorld* World)
 
 			if (ShouldDrawDebug(Private_SoundEmitterComponentBase::fDebugDrawGizmos, dbgDistSquared))
 			{
-				const float gizmoSize = (dbgGizmoSize + m_AkComp->outerRadius) * Private_SoundEmitterComponentBase::fDebugDrawGizmoScale;
+				const float gizmoSize = (dbgGizmoSize + outerRadius) * Private_SoundEmitterComponentBase::fDebugDrawGizmoScale;
 				UAudioUtils::DrawDebugGizmo(World, componentLocation, GetComponentRotation(), gizmoSize);
 			}
 		}
@@ -997,7 +1488,7 @@ void USoundEmitterComponentBase::UpdateNeverUnregister()
 				m_AkComp->OnAllEventsEnded.Unbind();
 			}
 		}
-		else
+		else if (!IsLightweightGameObjectRegistered())
 		{
 			CreateAkComponentIfNeeded();
 		}
@@ -1012,6 +1503,10 @@ void USoundEmitterComponentBase::UpdateNeverUnregister()
 
 			UnregisterEmitterIfInactive();
 		}
+		else if (IsLightweightGameObjectRegistered())
+		{
+			UnregisterEmitterIfInactive();
+		}
 	}
 }
 
@@ -1040,6 +1535,13 @@ void USoundEmitterComponentBase::SetAttenuationScalingFactor(float Value)
 		{
 			m_AkComp->SetAttenuationScalingFactor(Value);
 		}
+		else if (IsLightweightGameObjectRegistered() && AttenuationScalingFactor > 0.f)
+		{
+			if (IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get())
+			{
+				SoundEngine->SetScalingFactor(m_lightweightGameObjectID, Value);
+			}
+		}
 	}
 }
 
@@ -1057,6 +1559,13 @@ void USoundEmitterComponentBase::SetGameObjectRadius(float Outer, float Inner)
 	{
 		m_AkComp->SetGameObjectRadius(Outer, Inner);
 	}
+	else if (IsLightweightGameObjectRegistered())
+	{
+		if (IWwiseSpatialAudioAPI* SpatialAudio = IWwiseSpatialAudioAPI::Get())
+		{
+			SpatialAudio->SetGameObjectRadius(m_lightweightGameObjectID, Outer, Inner);
+		}
+	}
 }
 
 void USoundEmitterComponentBase::SetEnableSpotReflectors(bool bEnable)
@@ -1085,7 +1594,7 @@ void USoundEmitterComponentBase::SetEnableSpotReflectors(bool bEnable)
 
 void USoundEmitterComponentBase::QueryAndPostEnvironmentSwitches()
 {
-	if (!IsValid(m_AkComp))
+	if (!HasGameObject())
 	{
 		return;
 	}
@@ -1126,7 +1635,7 @@ void USoundEmitterComponentBase::QueryAndPostEnvironmentSwitches()
 
 		if (s_environmentSwitchDefaultGroupID != AkSwitchGroupID())
 		{
-			AkAudioDevice->SetSwitch(s_environmentSwitchDefaultGroupID, AkSwitchStateID(), m_AkComp);
+			SetSwitchOnGameObject(s_environmentSwitchDefaultGroupID, AkSwitchStateID());
 
 			if (s_debugToConsole && Private_SoundEmitterComponentBase::bLogGameSynchs)
 			{
@@ -1160,6 +1669,11 @@ int32 USoundEmitterComponentBase::PostOneShot(UAkAudioEvent* AkEvent
 		return AK_INVALID_PLAYING_ID;
 	}
 
+	if (bQueueOneShots && CallbackMask == 0 && TryQueueOneShot(AkEvent, bQueryAndPostEnvironmentSwitches))
+	{
+		return AK_INVALID_PLAYING_ID;
+	}
+
 	AkPlayingID playingID = AK_INVALID_PLAYING_ID;
 
 	CreateAkComponentIfNeeded();
@@ -1169,7 +1683,7 @@ int32 USoundEmitterComponentBase::PostOneShot(UAkAudioEvent* AkEvent
 		QueryAndPostEnvironmentSwitches();
 	}
 
-	playingID = m_AkComp->PostAkEvent(AkEvent, CallbackMask, PostEventCallback);
+	playingID = PostAkEventOnGameObject(AkEvent, CallbackMask, PostEventCallback);
 
 #if !UE_BUILD_SHIPPING
 	if (s_debugToConsole && s_logEvents)
@@ -1210,7 +1724,7 @@ int32 USoundEmitterComponentBase::PostOneShotAndWaitForEnd(UAkAudioEvent* AkEven
 		QueryAndPostEnvironmentSwitches();
 	}
 
-	playingID = m_AkComp->PostAkEventAndWaitForEnd(AkEvent, LatentInfo);
+	playingID = PostAkEventOnGameObjectAndWaitForEnd(AkEvent, LatentInfo);
 
 #if !UE_BUILD_SHIPPING
 	if (s_debugToConsole && s_logEvents)
@@ -1281,6 +1795,53 @@ URepeatingOneShot* USoundEmitterComponentBase::PostRepeatableOneShot(const FRepe
 	return repeatingOneShot;
 }
 
+FRepeatingOneShotHandle USoundEmitterComponentBase::StartRepeatingOneShot(const FRepeatableOneShot& RepeatableOneShot,
+	float ActivationRangeBuffer, bool bQueryAndPostEnvironmentSwitches)
+{
+	if (!IsValid(RepeatableOneShot.AkEvent))
+	{
+		WR_DBG_FUNC(Warning, "No Wwise event assigned in RepeatableOneShot");
+		return FRepeatingOneShotHandle();
+	}
+
+	UAudioSubsystem* audioSubsystem = UAudioSubsystem::Get(this);
+	URepeatingOneShotManager* repeatingOneShotManager = audioSubsystem ? audioSubsystem->GetRepeatingOneShotManager() : nullptr;
+	if (!IsValid(repeatingOneShotManager)) { return FRepeatingOneShotHandle(); }
+
+	FRepeatingOneShotEntry entry(this, RepeatableOneShot, ActivationRangeBuffer, bQueryAndPostEnvironmentSwitches);
+	entry.bShouldRepeat = RepeatableOneShot.bShouldRepeat && RepeatableOneShot.MaxTimeInterval > 0.f;
+
+	if (Private_SoundEmitterComponentBase::bLogRepeatingOneShot)
+	{
+		WR_DBG_FUNC(Log, "Repeating OneShot started: %s", *RepeatableOneShot.AkEvent->GetName());
+	}
+
+	return repeatingOneShotManager->Start(MoveTemp(entry));
+}
+
+void USoundEmitterComponentBase::PauseRepeatingOneShotByHandle(const FRepeatingOneShotHandle& Handle, bool bStopPlayingEventImmediately,
+	int32 TransitionDurationInMs, EAkCurveInterpolation FadeCurve)
+{
+	if (URepeatingOneShotManager* repeatingOneShotManager = UAudioSubsystem::Get(this)->GetRepeatingOneShotManager())
+	{
+		repeatingOneShotManager->Pause(Handle, bStopPlayingEventImmediately, TransitionDurationInMs, FadeCurve);
+	}
+}
+
+bool USoundEmitterComponentBase::ResumeRepeatingOneShotByHandle(const FRepeatingOneShotHandle& Handle)
+{
+	URepeatingOneShotManager* repeatingOneShotManager = UAudioSubsystem::Get(this)->GetRepeatingOneShotManager();
+	return IsValid(repeatingOneShotManager) && repeatingOneShotManager->Resume(Handle);
+}
+
+bool USoundEmitterComponentBase::EndRepeatingOneShotByHandle(const FRepeatingOneShotHandle& Handle, bool bStopPlayingEventImmediately,
+	int32 TransitionDurationInMs, EAkCurveInterpolation FadeCurve)
+{
+	URepeatingOneShotManager* repeatingOneShotManager = UAudioSubsystem::Get(this)->GetRepeatingOneShotManager();
+	return IsValid(repeatingOneShotManager) && repeatingOneShotManager->End(Handle, bStopPlayingEventImmediately, TransitionDurationInMs,
+		FadeCurve);
+}
+
 void USoundEmitterComponentBase::PauseRepeatingOneShot(URepeatingOneShot* RepeatingOneShot, bool bStopPlayingEventImmediately,
 	int32 TransitionDurationInMs, EAkCurveInterpolation FadeCurve)
 {
@@ -1320,16 +1881,16 @@ void USoundEmitterComponentBase::StopOneShotByPlayingId(int32 PlayingID, int32 T
 
 bool USoundEmitterComponentBase::SeekOnEvent(UAkAudioEvent* AkAudioEvent, int32 SeekPositionMs, bool bSeekToNearestMarker, int32 PlayingID)
 {
-	if (!IsValid(m_AkComp) || !IsValid(AkAudioEvent))
+	if (!HasGameObject() || !IsValid(AkAudioEvent))
 	{
 		return false;
 	}
 
-	if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
+	if (IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get())
 	{
 		const AkUInt32 eventShortID = AkAudioEvent->GetShortID();
-		const AKRESULT result = AkAudioDevice->SeekOnEvent(
-			eventShortID, m_AkComp, SeekPositionMs, bSeekToNearestMarker, (AkPlayingID)PlayingID);
+		const AKRESULT result = SoundEngine->SeekOnEvent(
+			eventShortID, GetAkGameObjectID(), SeekPositionMs, bSeekToNearestMarker, (AkPlayingID)PlayingID);
 
 		if (s_debugToConsole && s_logEvents)
 		{
@@ -1367,7 +1928,18 @@ void USoundEmitterComponentBase::PostTrigger(UAkTrigger* AkTrigger)
 	}
 
 	CreateAkComponentIfNeeded();
-	m_AkComp->PostTrigger(AkTrigger, FString());
+
+	if (IsValid(m_AkComp))
+	{
+		m_AkComp->PostTrigger(AkTrigger, FString());
+	}
+	else if (IsLightweightGameObjectRegistered())
+	{
+		if (IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get())
+		{
+			SoundEngine->PostTrigger(AkTrigger->GetShortID(), m_lightweightGameObjectID);
+		}
+	}
 }
 
 /*void USoundEmitterComponentBase::SetPersistentSwitch(UAkSwitchValue* AkSwitchValue)
@@ -1429,9 +2001,9 @@ void USoundEmitterComponentBase::SetSwitch(UAkSwitchValue* AkSwitchValue)
 		{
 			if (activeSwitch.Value != AkSwitchValue)
 			{
-				if (IsValid(m_AkComp))
+				if (HasGameSyncTargets())
 				{
-					m_AkComp->SetSwitch(AkSwitchValue, FString(), FString());
+					SetSwitchOnGameObject(AkSwitchValue);
 				}
 
 				activeSwitch.Value = AkSwitchValue;
@@ -1444,9 +2016,9 @@ void USoundEmitterComponentBase::SetSwitch(UAkSwitchValue* AkSwitchValue)
 	// new switch group on this emitter
 	m_activeSwitches.Add(AkSwitchValue->GetGroupID(), AkSwitchValue);
 
-	if (IsValid(m_AkComp))
+	if (HasGameSyncTargets())
 	{
-		m_AkComp->SetSwitch(AkSwitchValue, FString(), FString());
+		SetSwitchOnGameObject(AkSwitchValue);
 	}
 }
 
@@ -1472,12 +2044,9 @@ void USoundEmitterComponentBase::ResetSwitchGroup(UAkGroupValue* AkSwitchGroup)
 	{
 		if (activeSwitch.Key == switchGroupID)
 		{
-			if (IsValid(m_AkComp))
+			if (HasGameSyncTargets())
 			{
-				if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
-				{
-					AkAudioDevice->SetSwitch(switchGroupID, AkSwitchStateID(), m_AkComp);
-				}
+				SetSwitchOnGameObject(switchGroupID, AkSwitchStateID());
 			}
 
 			m_activeSwitches.Remove(activeSwitch.Key);
@@ -1515,16 +2084,13 @@ void USoundEmitterComponentBase::ResetSwitchGroup(UAkGroupValue* AkSwitchGroup)
 
 void USoundEmitterComponentBase::ResetAllSwitchGroups()
 {
-	if (IsValid(m_AkComp))
+	if (HasGameSyncTargets())
 	{
-		FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get();
-		if (UNLIKELY(!AkAudioDevice)) { return; }
-
 		for (const TPair<AkSwitchGroupID, UAkSwitchValue*> activeSwitch : m_activeSwitches)
 		{
 			if (!InitialSwitches.Contains(activeSwitch.Value))
 			{
-				AkAudioDevice->SetSwitch(activeSwitch.Key, AkSwitchStateID(), m_AkComp);
+				SetSwitchOnGameObject(activeSwitch.Key, AkSwitchStateID());
 			}
 		}
 	}
@@ -1540,68 +2106,38 @@ void USoundEmitterComponentBase::SetRtpc(UAkRtpc* AkRtpc, float Value, int32 Int
 		return;
 	}
 
-	bool alreadyPosted = false;
-	bool epsilonExceeded = false;
-
-	for (FActiveRtpc& ActiveRtpc : m_activeRtpcs)
-	{
-		// Rtpc has already been posted on this Emitter
-		if (ActiveRtpc.Rtpc == AkRtpc)
-		{
-			// Rtpc value has changed more than Epsilon
-			if (FMath::Abs(Value - ActiveRtpc.Value) > Epsilon)
-			{
-				ActiveRtpc.Value = Value;
-				epsilonExceeded = true;
-			}
-
-			alreadyPosted = true;
-			break;
-		}
-	}
+	INC_DWORD_STAT(STAT_WwiserR_RtpcsWritten);
 
-	if (!alreadyPosted)
-	{
-		m_activeRtpcs.Add(FActiveRtpc{ AkRtpc, Value });
-	}
+	const int32 index = m_rtpcs.Set(AkRtpc, Value, InterpolationTimeMs, Epsilon);
+	if (index == INDEX_NONE || !HasGameSyncTargets()) { return; }
 
-	if ((!alreadyPosted || epsilonExceeded) && IsValid(m_AkComp))
-	{
-		m_AkComp->SetRTPCValue(AkRtpc, Value, InterpolationTimeMs, FString());
-	}
+	m_rtpcs.MarkDirty(index);
+	RequestRtpcFlush();
 }
 
 void USoundEmitterComponentBase::ResetRtpcValue(UAkRtpc* AkRtpc)
 {
-	for (const FActiveRtpc& activeRtpc : m_activeRtpcs)
-	{
-		if (activeRtpc.Rtpc == AkRtpc)
-		{
-			m_activeRtpcs.Remove(activeRtpc);
-			break;
-		}
-	}
+	if (!IsValid(AkRtpc)) { return; }
 
-	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
-	if (UNLIKELY(!SoundEngine)) { return; }
+	m_rtpcs.Remove(AkRtpc->GetShortID());
 
-	SoundEngine->ResetRTPCValue(AkRtpc->GetShortID(), m_AkComp->GetAkGameObjectID());
+	if (HasGameSyncTargets())
+	{
+		ResetRtpcOnGameObject(AkRtpc->GetShortID());
+	}
 }
 
 void USoundEmitterComponentBase::ResetAllRtpcValues()
 {
-	if (IsValid(m_AkComp))
+	if (HasGameSyncTargets())
 	{
-		IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
-		if (UNLIKELY(!SoundEngine)) { return; }
-
-		for (const FActiveRtpc& activeRtpc : m_activeRtpcs)
+		for (const FEmitterRtpc& rtpc : m_rtpcs.Entries)
 		{
-			SoundEngine->ResetRTPCValue(activeRtpc.Rtpc->GetShortID(), m_AkComp->GetAkGameObjectID());
+			ResetRtpcOnGameObject(rtpc.ShortID);
 		}
 	}
 
-	m_activeRtpcs.Empty();
+	m_rtpcs.Empty();
 }
 
 void USoundEmitterComponentBase::MuteEmitter(bool bMute)
@@ -1615,15 +2151,9 @@ void USoundEmitterComponentBase::MuteEmitter(bool bMute)
 
 	if (bMute)
 	{
-		if (IsValid(m_AkComp))
+		if (HasGameObject() && HasActiveGameObjectEvents())
 		{
-			if (m_AkComp->HasActiveEvents())
-			{
-				if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
-				{
-					AkAudioDevice->StopGameObject(m_AkComp);
-				}
-			}
+			StopGameObject();
 		}
 	}
 }
@@ -1631,11 +2161,11 @@ void USoundEmitterComponentBase::MuteEmitter(bool bMute)
 void USoundEmitterComponentBase::StopAll()
 {
 	m_repeatingOneShots.Empty();
-	if (!IsValid(m_AkComp)) { return; }
+	if (!HasGameObject()) { return; }
 
 	if (IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get())
 	{
-		SoundEngine->StopAll(m_AkComp->GetAkGameObjectID());
+		SoundEngine->StopAll(GetAkGameObjectID());
 	}
 }
 
@@ -1656,16 +2186,16 @@ bool USoundEmitterComponentBase::IsPlayingIdActive(UAkAudioEvent* AkEvent, int32
 
 bool USoundEmitterComponentBase::IsPlaying() const
 {
-	return (IsValid(m_AkComp) && m_AkComp->HasActiveEvents());
+	return (HasGameObject() && HasActiveGameObjectEvents());
 }
 
 bool USoundEmitterComponentBase::HasActiveEvents() const
 {
-	return (IsValid(m_AkComp) && m_AkComp->HasActiveEvents()) || !m_repeatingOneShots.IsEmpty(); // || !m_playingLoops.IsEmpty();
+	return (HasGameObject() && HasActiveGameObjectEvents()) || !m_repeatingOneShots.IsEmpty() || !m_scheduledRepeatingOneShots.IsEmpty(); // || !m_playingLoops.IsEmpty();
 }
 
 bool USoundEmitterComponentBase::HasAkComponent() const
 {
-	return IsValid(m_AkComp);
+	return HasGameObject();
 }
 #pragma endregion
@@ -57,15 +57,32 @@ inline bool operator==(const FRepeatableOneShot& a, const FRepeatableOneShot& b)
 	return GetTypeHash(a) == GetTypeHash(b);
 }
 
+// handle to a repeating one shot scheduled by the RepeatingOneShotManager
+struct WWISERR_API FRepeatingOneShotHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Serial = 0;
+
+	FRepeatingOneShotHandle() {}
+	FRepeatingOneShotHandle(int32 a_Index, uint32 a_Serial) : Index(a_Index), Serial(a_Serial) {}
+
+	FORCEINLINE bool IsValid() const { return Index != INDEX_NONE; }
+	FORCEINLINE void Invalidate() { Index = INDEX_NONE; }
+	FORCEINLINE bool operator==(const FRepeatingOneShotHandle& Other) const { return Index == Other.Index && Serial == Other.Serial; }
+};
+
 // Callback when a new repeating one shot is posted
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnOneShotCallback, int32, PlayingID);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnRepeatingOneShotEndedCallback, URepeatingOneShot*, RepeatingOneShot);
 
-// keeps track of repeating one shot events
+// Blueprint wrapper around a repeating one shot scheduled by the RepeatingOneShotManager, forwards Wwise callbacks
 UCLASS(ClassGroup = "WwiserR", BlueprintType, Abstract, Transient) class WWISERR_API URepeatingOneShot : public UObject
 {
 	GENERATED_BODY()
 
+	friend class URepeatingOneShotManager;
+	friend class URtpcFlushManager;
+
 public:
 	UPROPERTY(Transient) USoundEmitterComponentBase* OwningSoundEmitterComponent = nullptr;
 	UPROPERTY(Transient, BlueprintReadWrite) FRepeatableOneShot RepeatableOneShot = FRepeatableOneShot();
@@ -84,7 +101,7 @@ public:
 	UPROPERTY(BlueprintReadOnly) bool bIsPaused = false;
 
 protected:
-	FTimerHandle m_nextPostAkEventTimeHandle = FTimerHandle();
+	FRepeatingOneShotHandle m_handle{};	// scheduling state lives in the RepeatingOneShotManager
 	bool bPostAkPostEventCallbackOnEndOfEvent = false;
 
 	inline static FOnAkPostEventCallback s_dummyAkPostEventCallback{};
@@ -109,10 +126,8 @@ protected:
 	virtual void OnResumeRepeatingOneShot();
 	virtual void OnEndRepeatingOneShot();
 
-	UFUNCTION()
-	void PostRepeatingOneShotInternal();
-
-	void ScheduleNextRepeatingOneShot();
+	void OnScheduledOneShotPosted(AkPlayingID PlayingID, int32 a_RepetitionsLeft);
+	class URepeatingOneShotManager* GetRepeatingOneShotManager() const;
 
 public:
 	virtual void Initialize(USoundEmitterComponentBase* Owner, UAkAudioEvent* a_AkEvent, int32 a_CallbackMask,
@@ -180,8 +195,16 @@ inline bool operator==(const FPlayingOneShot& a, const FPlayingOneShot& b)
 	* - replaces AkComponent
 	* - used to post events and gamesynchs in the 3d world
 	* - an AkComponent is spawned only when a sound should play (e.g. after distance culling by child classes)
-	* - a simple emitter pool can trivially be implemented later on, however, this comes at the cost of game objects not being named
-		according to their parent actor/component in the Wwise authoring tool
+	* - AkComponents are acquired from and released to a per world pool (AkComponentPoolManager) when enabled in the project settings.
+		Pooled game objects are renamed after their parent actor/component in the Wwise profiler on reuse
+	* - optionally registers a bare Wwise game object instead of an AkComponent (bUseLightweightGameObject). Positions are pushed directly
+		to the sound engine on transform updates, and events and game syncs are posted on the game object ID. The game object is
+		unregistered when Wwise reports the end of its last event
+	* - optionally queues one shots (bQueueOneShots) in the OneShotQueueManager, which deduplicates and caps them before posting
+	* - repeating one shots are scheduled by the RepeatingOneShotManager. URepeatingOneShot is only allocated for the Blueprint API,
+		StartRepeatingOneShot returns a lightweight handle
+	* - Rtpcs are kept in a table sorted on short ID. Writes mark entries dirty, changed values are sent in one flush per frame
+		(RtpcFlushManager) or before the next event is posted, and replayed when a game object is registered
 **/
 UCLASS(ClassGroup = "WwiserR", hidecategories	=
 	(Variable, Rendering, Mobility, LOD, Component, ComponentTick, ComponentReplication, Replication, Physics, Activation, Collision))
@@ -190,6 +213,8 @@ UCLASS(ClassGroup = "WwiserR", hidecategories	=
 	GENERATED_BODY()
 
 	friend class URepeatingOneShot;
+	friend class UOneShotQueueManager;
+	friend class URepeatingOneShotManager;
 
 #if !UE_BUILD_SHIPPING
 	DECLARE_MULTICAST_DELEGATE(FOnDebugDrawChanged)
@@ -206,6 +231,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sound Emitter|Distance Culling")
 	bool bUseDistanceCulling = true;
 
+	/** Queue one shots without callbacks and post them at the end of the frame. Posts of the same event close to each other are deduplicated,
+	and the amount of instances per event is capped nearest to a listener first (see project settings). Queued one shots return an invalid
+	playing ID. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sound Emitter|Events")
+	bool bQueueOneShots = false;
+
 	/** Switcfhes to be set when initializing this emitter */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sound Emitter")
 	TSet<class UAkSwitchValue*> InitialSwitches;
@@ -220,6 +251,11 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category = "WwiserR|Sound Emitter|Wwise Registration")
 	virtual void SetNeverUnregister(bool bMustNeverUnregister);
 
+	/** Register a bare Wwise game object instead of an AkComponent. Saves the AkComponent's scene component, tick and obstruction/occlusion
+	updates, for simple point emitters. Occlusion, reverb volumes and spot reflectors are not supported on lightweight game objects. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sound Emitter|Wwise Registration")
+	bool bUseLightweightGameObject = false;
+
 	/** Cooldown time before destroying/unregister the AkComponent when all sounds finished playing.
 	Useful for preventing continuous creation/destruction of the AkComponent, e.g. in the case of footsteps. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sound Emitter|Wwise Registration", meta = (Units = "Seconds"))
@@ -329,6 +365,7 @@ public:
 private:
 	inline static AkSwitchGroupID s_environmentSwitchDefaultGroupID = AkSwitchGroupID();
 	TSet<URepeatingOneShot*>	m_repeatingOneShots{};
+	TArray<FRepeatingOneShotHandle>	m_scheduledRepeatingOneShots{};	// repeating one shots started without a Blueprint wrapper
 	FTimerHandle				m_timerNextUnregistration{};
 	bool						m_isPendingUnregistration = false;
 
@@ -341,9 +378,20 @@ protected:
 
 	TSet<TWeakObjectPtr<UAkComponent>>		m_connectedListeners{};
 	TMap<AkSwitchGroupID, UAkSwitchValue*>	m_activeSwitches{};
-	TSet<FActiveRtpc>						m_activeRtpcs{};
+	FRtpcTable								m_rtpcs{};
+	bool m_isRtpcFlushPending = false;	// queued in the RtpcFlushManager
 	bool m_isMuted = false;
 	bool m_forceRegistration = false;	// allows overriding bNeverUnregister in child classes
+	bool m_isAkCompPooled = false;		// m_AkComp was acquired from the AkComponentPoolManager
+	AkGameObjectID m_lightweightGameObjectID = AK_INVALID_GAME_OBJECT;	// registered instead of m_AkComp when bUseLightweightGameObject
+	bool m_isPositionUploadDeferred = false;	// the position of the game object is uploaded by the GameObjectPositionManager
+
+	// registered lightweight game objects, to find their emitter when Wwise reports the end of an event (game thread only)
+	inline static TMap<AkGameObjectID, TWeakObjectPtr<USoundEmitterComponentBase>> s_lightweightEmitters{};
+
+#if !UE_BUILD_SHIPPING
+	inline static int32 s_dbgNumLightweightGameObjects = 0;
+#endif
 
 public:
 	UPROPERTY(Transient)
@@ -356,7 +404,9 @@ protected:
 		return bNeverUnregister || m_forceRegistration;
 	}
 	bool IsInListenerRange(UAkAudioEvent* AkEvent, float RangeBuffer);
-	virtual TSet<TWeakObjectPtr<class UWorldSoundListener>> GetWorldListeners();
+	bool TryQueueOneShot(UAkAudioEvent* AkEvent, bool bQueryAndPostEnvironmentSwitches);
+	AkPlayingID PostQueuedOneShot(UAkAudioEvent* AkEvent, bool bQueryAndPostEnvironmentSwitches);
+	virtual const TSet<TWeakObjectPtr<class UWorldSoundListener>>& GetWorldListeners();
 	virtual void InitializeListeners();
 	//void SetListeners(const TSet<TWeakObjectPtr<UAkComponent>>& Listeners);
 
@@ -409,6 +459,55 @@ protected:
 	virtual void OnAllWorldListenersRemoved();
 #pragma endregion
 
+#pragma region Internal - Game Object
+protected:
+	/** child classes relying on AkComponent features can opt out of lightweight game objects */
+	virtual bool CanUseLightweightGameObject() const { return bUseLightweightGameObject; }
+
+	FORCEINLINE bool IsLightweightGameObjectRegistered() const { return m_lightweightGameObjectID != AK_INVALID_GAME_OBJECT; }
+
+	/** true if either an AkComponent or a lightweight game object is registered with Wwise */
+	FORCEINLINE bool HasGameObject() const { return IsLightweightGameObjectRegistered() || IsValid(m_AkComp); }
+
+	/** true if switches or Rtpcs are set on this emitter */
+	FORCEINLINE bool HasGameSyncs() const { return !m_activeSwitches.IsEmpty() || !m_rtpcs.Entries.IsEmpty(); }
+
+	/** true if switches and Rtpcs can be sent now, child classes with game objects of their own extend this */
+	virtual bool HasGameSyncTargets() const { return HasGameObject(); }
+
+	AkGameObjectID GetAkGameObjectID() const;
+	bool HasActiveGameObjectEvents() const;
+
+	AkPlayingID PostAkEventOnGameObject(UAkAudioEvent* AkEvent, int32 CallbackMask = 0,
+		const FOnAkPostEventCallback& PostEventCallback = FOnAkPostEventCallback());
+	AkPlayingID PostAkEventOnGameObjectAndWaitForEnd(UAkAudioEvent* AkEvent, FLatentActionInfo LatentInfo);
+	virtual void SetSwitchOnGameObject(const class UAkSwitchValue* AkSwitchValue);
+	virtual void SetSwitchOnGameObject(AkSwitchGroupID SwitchGroupID, AkSwitchStateID SwitchStateID);
+	virtual void SetRtpcOnGameObject(AkRtpcID RtpcID, float Value, int32 InterpolationTimeMs);
+	virtual void ResetRtpcOnGameObject(AkRtpcID RtpcID);
+
+	/** sends the dirty Rtpcs to the game object at the end of the frame, or immediately without an RtpcFlushManager */
+	void RequestRtpcFlush();
+	void FlushRtpcs();
+	void StopGameObject();
+
+	void RegisterLightweightGameObject();
+	void UnregisterLightweightGameObject();
+	virtual void InitializeLightweightGameObject();
+	void UpdateLightweightGameObjectPosition();
+	void OnLightweightGameObjectEventEnded();
+
+	/** Wwise callback for events posted on lightweight game objects, the end of events is marshalled to the game thread */
+	static void LightweightGameObjectCallback(AkCallbackType CallbackType, AkCallbackInfo* CallbackInfo);
+
+	/** hands the position updates of the registered game object over to the GameObjectPositionManager, if there is one */
+	void DeferPositionUploads();
+	void StopDeferringPositionUploads();
+	virtual bool CanDeferPositionUploads() const { return true; }
+
+	void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport) override;
+#pragma endregion
+
 #pragma region Internal - Debug
 protected:
 	FORCEINLINE FString GetFullComponentName() const
@@ -472,6 +571,16 @@ public:
 		const FOnRepeatingOneShotEndedCallback& RepeatingOneShotEndedCallback, float ActivationRangeBuffer = 50.f,
 		bool bQueryAndPostEnvironmentSwitches = false);
 
+	/** starts a repeating one shot without a Blueprint wrapper or callbacks, cheaper for large amounts of ambient repeating one shots */
+	FRepeatingOneShotHandle StartRepeatingOneShot(const FRepeatableOneShot& RepeatableOneShot, float ActivationRangeBuffer = 50.f,
+		bool bQueryAndPostEnvironmentSwitches = false);
+
+	void PauseRepeatingOneShotByHandle(const FRepeatingOneShotHandle& Handle, bool bStopPlayingEventImmediately = false,
+		int32 TransitionDurationInMs = 10, EAkCurveInterpolation FadeCurve = EAkCurveInterpolation::Log1);
+	bool ResumeRepeatingOneShotByHandle(const FRepeatingOneShotHandle& Handle);
+	bool EndRepeatingOneShotByHandle(const FRepeatingOneShotHandle& Handle, bool bStopPlayingEventImmediately = false,
+		int32 TransitionDurationInMs = 10, EAkCurveInterpolation FadeCurve = EAkCurveInterpolation::Log1);
+
 	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category = "WwiserR|Sound Emitter|Events|Repeating OneShot",
 		meta = (AdvancedDisplay = "1"))
 	virtual void PauseRepeatingOneShot(URepeatingOneShot* RepeatingOneShot, bool bStopPlayingEventImmediately = false,
@@ -546,6 +655,7 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category = "WwiserR|Sound Emitter|Utilities")
 	virtual bool HasActiveEvents() const;
 
+	/** true if an AkComponent or lightweight game object is registered with Wwise */
 	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category = "WwiserR|Sound Emitter|Utilities")
 	virtual bool HasAkComponent() const;
 #pragma endregion
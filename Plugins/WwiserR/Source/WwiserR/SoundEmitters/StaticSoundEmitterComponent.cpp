@@ -17,6 +17,19 @@ UStaticSoundEmitterComponent::UStaticSoundEmitterComponent()
 	PrimaryComponentTick.bStartWithTickEnabled = false;
 }
 
+void UStaticSoundEmitterComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	for (UDA_StaticSoundLoop* staticSoundLoop : StaticSoundLoops)
+	{
+		if (IsValid(staticSoundLoop))
+		{
+			PostStaticSoundLoop(staticSoundLoop);
+		}
+	}
+}
+
 void UStaticSoundEmitterComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	if (EndPlayReason == EEndPlayReason::Destroyed || EndPlayReason == EEndPlayReason::RemovedFromWorld)
@@ -64,7 +77,7 @@ void UStaticSoundEmitterComponent::StartPlayAudio(UDA_StaticSoundLoop* StaticSou
 
 	CreateAkComponentIfNeeded();
 
-	const AkPlayingID playingID = m_AkComp->PostAkEvent(StaticSoundLoop->LoopEvent);
+	const AkPlayingID playingID = PostAkEventOnGameObject(StaticSoundLoop->LoopEvent);
 
 	if (playingID != AK_INVALID_PLAYING_ID)
 	{
@@ -22,6 +22,8 @@ class WWISERR_API UStaticSoundEmitterComponent : public USoundEmitterComponentBa
 	GENERATED_BODY()
 
 	friend class AStaticSoundEmitterWorldManager;
+	friend class UStaticSoundEmitterDatabase;
+	friend struct FStaticSoundEmitterInstance;
 
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPlayingStateChanged, bool, bIsPlaying, UDA_StaticSoundLoop*, StaticSoundLoop);
 
@@ -29,14 +31,26 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "WwiserR|StaticSoundEmitterComponent")
 	FOnPlayingStateChanged OnPlayingStateChanged{};
 
+	/** loops posted on BeginPlay, baked into the level's UStaticSoundEmitterDatabase when it's saved */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "WwiserR|StaticSoundEmitterComponent")
+	TArray<UDA_StaticSoundLoop*> StaticSoundLoops{};
+
 protected:
+	UPROPERTY(NonPIEDuplicateTransient)
+	uint32 m_stableID = 0;				// unique within the level, assigned when baking
+
+	UPROPERTY(NonPIEDuplicateTransient)
+	int32 m_bakedSlot = INDEX_NONE;		// first record of this component in the level's UStaticSoundEmitterDatabase
+
 	TSet<UDA_StaticSoundLoop*> m_postedLoops{};
 	TMap<UAkAudioEvent*, AkPlayingID> m_playingLoops{};
+	uint32 m_selectionStamp = 0;	// set by AStaticSoundEmitterWorldManager while diffing a loop's selection with its playing emitters
 
 public:
 	UStaticSoundEmitterComponent();
 
 protected:
+	void BeginPlay() override;
 	void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// called from AStaticSoundEmitterWorldManager
@@ -6,6 +6,7 @@
 #include "Managers/SoundListenerManager.h"
 #include "Core/AudioSubsystem.h"
 #include "Managers/GlobalSoundEmitterManager.h"
+#include "Managers/GameObjectPositionManager.h"
 #include "WwiseSoundEngine/Public/Wwise/API/WwiseSoundEngineAPI.h"
 #include "AkAuxBus.h"
 //#include "WwiseSoundEngine/Public/Wwise/API/WwiseSpatialAudioAPI.h"
@@ -20,6 +21,11 @@ void UWorldSoundListener::BeginPlay()
 
 	UpdatePosition();
 
+	if (UGameObjectPositionManager* positionManager = UAudioSubsystem::Get(this)->GetGameObjectPositionManager())
+	{
+		positionManager->RegisterComponent(this);
+	}
+
 	s_listenerManager = UAudioSubsystem::Get(this)->GetListenerManager();
 	s_listenerManager->AddWorldListener(this);
 	s_worldListenersAuxBusParams.Add(this, TMap<UAkAuxBus*, FAuxBusParams>{});
@@ -57,6 +63,14 @@ void UWorldSoundListener::BeginPlay()
 
 void UWorldSoundListener::EndPlay(EEndPlayReason::Type EndPlayReason)
 {
+	if (UAudioSubsystem* audioSubsystem = UAudioSubsystem::Get(this))
+	{
+		if (UGameObjectPositionManager* positionManager = audioSubsystem->GetGameObjectPositionManager())
+		{
+			positionManager->UnregisterComponent(this);
+		}
+	}
+
 	s_listenerManager->RemoveWorldListener(this);
 	s_worldListenersAuxBusParams.Remove(this);
 	TSet<UAkAuxBus*> keys;
@@ -105,6 +119,11 @@ void UWorldSoundListener::UpdateWorldListener()
 }
 
 void UWorldSoundListener::UpdateSoundEmitterSendLevels(UAkComponent* AkComponent)
+{
+	UpdateSoundEmitterSendLevels(AkComponent->GetAkGameObjectID(), AkComponent->GetComponentLocation());
+}
+
+void UWorldSoundListener::UpdateSoundEmitterSendLevels(AkGameObjectID GameObjectID, const FVector& Location)
 {
 	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
 	if (UNLIKELY(!SoundEngine)) { return; }
@@ -127,7 +146,7 @@ void UWorldSoundListener::UpdateSoundEmitterSendLevels(UAkComponent* AkComponent
 		for (TPair<UAkAuxBus*, FAuxBusParams> auxBusParams : s_worldListenersAuxBusParams[worldListener])
 		{
 			float controlValueFactor = 1.f;
-			const FVector relativePos = AkComponent->GetComponentLocation() - worldListener->GetComponentLocation();
+			const FVector relativePos = Location - worldListener->GetComponentLocation();
 
 			if (auxBusParams.Value.Directivity > 0)
 			{
@@ -145,7 +164,7 @@ void UWorldSoundListener::UpdateSoundEmitterSendLevels(UAkComponent* AkComponent
 		}
 	}
 
-	SoundEngine->SetGameObjectAuxSendValues(AkComponent->GetAkGameObjectID(), pAuxSendValues, auxCount);
+	SoundEngine->SetGameObjectAuxSendValues(GameObjectID, pAuxSendValues, auxCount);
 	//SoundEngine->SetGameObjectOutputBusVolume(GetAkGameObjectID(), GetAkGameObjectID(), 0.f);*/
 }
 
@@ -104,6 +104,7 @@ protected:
 
 public:
 	static void UpdateSoundEmitterSendLevels(UAkComponent* AkComponent);
+	static void UpdateSoundEmitterSendLevels(AkGameObjectID GameObjectID, const FVector& Location);
 	void UpdateAuxEmitterCompConnections(UAkAuxBus* AuxBus);
 
 	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category = "DW|Audio|Listener Manager|WorldSoundListener", meta = (WorldContext = "Context"))